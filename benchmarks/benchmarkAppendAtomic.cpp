@@ -0,0 +1,86 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkAppendAtomicKernels.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+ResultsMap< VALUE_TYPE, 2 > resultsMap;
+
+template< typename POLICY >
+void perElement( benchmark::State & state )
+{
+  AppendAtomic< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.perElement();
+}
+
+template< typename POLICY >
+void range( benchmark::State & state )
+{
+  AppendAtomic< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.range();
+}
+
+INDEX_TYPE const NUM_ARRAYS = (2 << 13) + 573;
+INDEX_TYPE const NUM_ITEMS = 2 << 20;
+
+void registerBenchmarks()
+{
+  forEachArg( []( auto policy )
+  {
+    using POLICY = decltype( policy );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { NUM_ARRAYS, NUM_ITEMS } ), perElement, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { NUM_ARRAYS, NUM_ITEMS } ), range, POLICY );
+  },
+              serialPolicy {}
+  #if defined(USE_OPENMP)
+              , parallelHostPolicy {}
+  #endif
+              );
+}
+
+} // namespace benchmarking
+} // namespace LvArray
+
+int main( int argc, char * * argv )
+{
+  LvArray::benchmarking::registerBenchmarks();
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  LVARRAY_LOG( "VALUE_TYPE = " << LvArray::demangleType< LvArray::benchmarking::VALUE_TYPE >() );
+  LVARRAY_LOG( "INDEX_TYPE = " << LvArray::demangleType< LvArray::benchmarking::INDEX_TYPE >() );
+
+  LVARRAY_LOG( LvArray::benchmarking::NUM_ITEMS << " items appending " << LvArray::benchmarking::VALUES_PER_ITEM <<
+               " values each to " << LvArray::benchmarking::NUM_ARRAYS << " arrays." );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap );
+}
@@ -0,0 +1,88 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkAppendAtomicKernels.hpp"
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+/**
+ * @brief @return The sum of the values of a few of the arrays of @p view, which doesn't depend on their order.
+ * @param view The ArrayOfArraysView that was appended to.
+ */
+VALUE_TYPE checksum( ArrayOfArraysView< VALUE_TYPE, INDEX_TYPE const, false, DEFAULT_BUFFER > const & view )
+{
+  INDEX_TYPE const numArrays = view.size();
+  VALUE_TYPE sum = 0;
+  for( INDEX_TYPE const i : { INDEX_TYPE( 0 ), numArrays / 3, numArrays / 2, numArrays - 1 } )
+  {
+    for( VALUE_TYPE const value : view[ i ] )
+    { sum += value; }
+  }
+
+  return sum;
+}
+
+template< typename POLICY >
+VALUE_TYPE AppendAtomic< POLICY >::
+perElementKernel( ArrayOfArraysView< VALUE_TYPE, INDEX_TYPE const, false, DEFAULT_BUFFER > const & view,
+                  INDEX_TYPE const numItems )
+{
+  using AtomicPolicy = typename RAJAHelper< POLICY >::AtomicPolicy;
+  INDEX_TYPE const numArrays = view.size();
+  forall< POLICY >( numItems, [view, numArrays] ( INDEX_TYPE const item )
+  {
+    INDEX_TYPE const i = arrayOfItem( item, numArrays );
+    for( INDEX_TYPE j = 0; j < VALUES_PER_ITEM; ++j )
+    { view.template emplaceBackAtomic< AtomicPolicy >( i, VALUE_TYPE( VALUES_PER_ITEM * item + j ) ); }
+  } );
+
+  return checksum( view );
+}
+
+template< typename POLICY >
+VALUE_TYPE AppendAtomic< POLICY >::
+rangeKernel( ArrayOfArraysView< VALUE_TYPE, INDEX_TYPE const, false, DEFAULT_BUFFER > const & view,
+             INDEX_TYPE const numItems )
+{
+  using AtomicPolicy = typename RAJAHelper< POLICY >::AtomicPolicy;
+  INDEX_TYPE const numArrays = view.size();
+  forall< POLICY >( numItems, [view, numArrays] ( INDEX_TYPE const item )
+  {
+    INDEX_TYPE const i = arrayOfItem( item, numArrays );
+    VALUE_TYPE values[ VALUES_PER_ITEM ];
+    for( INDEX_TYPE j = 0; j < VALUES_PER_ITEM; ++j )
+    { values[ j ] = VALUES_PER_ITEM * item + j; }
+
+    view.template appendToArrayAtomic< AtomicPolicy >( i, values, values + VALUES_PER_ITEM );
+  } );
+
+  return checksum( view );
+}
+
+template class AppendAtomic< serialPolicy >;
+
+#if defined(USE_OPENMP)
+template class AppendAtomic< parallelHostPolicy >;
+#endif
+
+} // namespace benchmarking
+} // namespace LvArray
@@ -0,0 +1,122 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "benchmarkHelpers.hpp"
+#include "ArrayOfArrays.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+// System includes
+#include <vector>
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+using VALUE_TYPE = double;
+
+using ArrayOfArraysT = ArrayOfArrays< VALUE_TYPE, INDEX_TYPE, DEFAULT_BUFFER >;
+
+constexpr INDEX_TYPE VALUES_PER_ITEM = 8;
+
+#define TIMING_LOOP( KERNEL ) \
+  for( auto _ : m_state ) \
+  { \
+    LVARRAY_UNUSED_VARIABLE( _ ); \
+    m_state.PauseTiming(); \
+    m_array.template resizeFromCapacities< POLICY >( m_numArrays, m_capacities.data() ); \
+    m_state.ResumeTiming(); \
+    m_sum += KERNEL; \
+    ::benchmark::DoNotOptimize( m_sum ); \
+    ::benchmark::ClobberMemory(); \
+  } \
+
+/**
+ * @class AppendAtomic
+ * @brief Times items concurrently appending VALUES_PER_ITEM values each to the arrays of an ArrayOfArrays
+ *   with exactly enough capacity. The per element version calls emplaceBackAtomic for each value, the
+ *   other reserves the space for all the values of an item with a single appendToArrayAtomic.
+ */
+template< typename POLICY >
+class AppendAtomic
+{
+public:
+
+  AppendAtomic( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 2 > & results ):
+    m_state( state ),
+    m_callingFunction( callingFunction ),
+    m_results( results ),
+    m_numArrays( state.range( 0 ) ),
+    m_numItems( state.range( 1 ) ),
+    m_capacities( m_numArrays, 0 ),
+    m_array(),
+    m_sum( 0 )
+  {
+    for( INDEX_TYPE item = 0; item < m_numItems; ++item )
+    { m_capacities[ arrayOfItem( item, m_numArrays ) ] += VALUES_PER_ITEM; }
+  }
+
+  ~AppendAtomic()
+  {
+    registerResult( m_results, { m_numArrays, m_numItems }, m_sum / INDEX_TYPE( m_state.iterations() ), m_callingFunction );
+    m_state.counters[ "Values appended" ] = ::benchmark::Counter( m_numItems * VALUES_PER_ITEM,
+                                                                  ::benchmark::Counter::kIsIterationInvariantRate,
+                                                                  ::benchmark::Counter::OneK::kIs1000 );
+  }
+
+  void perElement()
+  { TIMING_LOOP( perElementKernel( m_array.toView(), m_numItems ) ); }
+
+  void range()
+  { TIMING_LOOP( rangeKernel( m_array.toView(), m_numItems ) ); }
+
+  /**
+   * @brief @return The array that @p item appends to, the items are scattered across the arrays.
+   * @param item The item.
+   * @param numArrays The number of arrays.
+   */
+  LVARRAY_HOST_DEVICE static inline
+  INDEX_TYPE arrayOfItem( INDEX_TYPE const item, INDEX_TYPE const numArrays )
+  { return ( item * 7919 ) % numArrays; }
+
+private:
+
+  static VALUE_TYPE perElementKernel( ArrayOfArraysView< VALUE_TYPE, INDEX_TYPE const, false, DEFAULT_BUFFER > const & view,
+                                      INDEX_TYPE const numItems );
+
+  static VALUE_TYPE rangeKernel( ArrayOfArraysView< VALUE_TYPE, INDEX_TYPE const, false, DEFAULT_BUFFER > const & view,
+                                 INDEX_TYPE const numItems );
+
+  ::benchmark::State & m_state;
+  std::string const m_callingFunction;
+  ResultsMap< VALUE_TYPE, 2 > & m_results;
+  INDEX_TYPE const m_numArrays;
+  INDEX_TYPE const m_numItems;
+  std::vector< INDEX_TYPE > m_capacities;
+  ArrayOfArraysT m_array;
+  VALUE_TYPE m_sum = 0;
+};
+
+#undef TIMING_LOOP
+
+} // namespace benchmarking
+} // namespace LvArray
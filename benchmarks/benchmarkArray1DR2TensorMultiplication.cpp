@@ -105,6 +105,38 @@ void tensorAbstractionSliceNative( benchmark::State & state )
   kernels.tensorAbstractionSlice();
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template< typename PERMUTATION >
+void fortranStaticViewNative( benchmark::State & state )
+{
+  ArrayOfR2TensorsNative< PERMUTATION > const kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.fortranStaticView();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template< typename PERMUTATION >
+void subscriptStaticSliceNative( benchmark::State & state )
+{
+  ArrayOfR2TensorsNative< PERMUTATION > const kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.subscriptStaticSlice();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template< typename PERMUTATION >
+void tensorAbstractionStaticSliceNative( benchmark::State & state )
+{
+  ArrayOfR2TensorsNative< PERMUTATION > const kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.tensorAbstractionStaticSlice();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template< typename PERMUTATION >
+void tiledNative( benchmark::State & state )
+{
+  ArrayOfR2TensorsNative< PERMUTATION > const kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.tiled();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 template< typename PERMUTATION >
 void RAJAViewNative( benchmark::State & state )
@@ -213,6 +245,10 @@ void registerBenchmarks()
     REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, tensorAbstractionArrayNative, PERMUTATION );
     REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, tensorAbstractionViewNative, PERMUTATION );
     REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, tensorAbstractionSliceNative, PERMUTATION );
+    REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, fortranStaticViewNative, PERMUTATION );
+    REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, subscriptStaticSliceNative, PERMUTATION );
+    REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, tensorAbstractionStaticSliceNative, PERMUTATION );
+    REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, tiledNative, PERMUTATION );
     REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, RAJAViewNative, PERMUTATION );
     REGISTER_BENCHMARK_TEMPLATE( { SERIAL_SIZE }, pointerNative, PERMUTATION );
   },
@@ -63,11 +63,11 @@ namespace benchmarking
   RAJA_OUTER_LOOP( N, INNER_LOOP( a_ijl, b_ilk, c_ijk ) )
 
 
-template< typename VALUE_TYPE_CONST, int USD >
+template< typename VALUE_TYPE_CONST, int USD, typename STRIDES >
 inline LVARRAY_HOST_DEVICE constexpr
-void R2TensorMultiply( LvArray::ArraySlice< VALUE_TYPE_CONST, 2, USD, INDEX_TYPE > const & a,
-                       LvArray::ArraySlice< VALUE_TYPE_CONST, 2, USD, INDEX_TYPE > const & b,
-                       LvArray::ArraySlice< VALUE_TYPE, 2, USD, INDEX_TYPE > const & c )
+void R2TensorMultiply( LvArray::ArraySlice< VALUE_TYPE_CONST, 2, USD, INDEX_TYPE, STRIDES > const & a,
+                       LvArray::ArraySlice< VALUE_TYPE_CONST, 2, USD, INDEX_TYPE, STRIDES > const & b,
+                       LvArray::ArraySlice< VALUE_TYPE, 2, USD, INDEX_TYPE, STRIDES > const & c )
 { INNER_LOOP( a( j, l ), b( l, k ), c( j, k ) ) }
 
 
@@ -135,6 +135,63 @@ tensorAbstractionSliceKernel( ArraySlice< VALUE_TYPE const, PERMUTATION > const
                               ArraySlice< VALUE_TYPE, PERMUTATION > const c )
 { OUTER_LOOP( a.size( 0 ), R2TensorMultiply( a[ i ], b[ i ], c[ i ] ); ); }
 
+template< typename PERMUTATION >
+void ArrayOfR2TensorsNative< PERMUTATION >::
+fortranStaticViewKernel( StaticArrayView< VALUE_TYPE const, PERMUTATION > const & a,
+                         StaticArrayView< VALUE_TYPE const, PERMUTATION > const & b,
+                         StaticArrayView< VALUE_TYPE, PERMUTATION > const & c )
+{ KERNEL( a.size( 0 ), a( i, j, l ), b( i, l, k ), c( i, j, k ) ); }
+
+template< typename PERMUTATION >
+void ArrayOfR2TensorsNative< PERMUTATION >::
+subscriptStaticSliceKernel( StaticArraySlice< VALUE_TYPE const, PERMUTATION > const a,
+                            StaticArraySlice< VALUE_TYPE const, PERMUTATION > const b,
+                            StaticArraySlice< VALUE_TYPE, PERMUTATION > const c )
+{ KERNEL( a.size( 0 ), a[ i ][ j ][ l ], b[ i ][ l ][ k ], c[ i ][ j ][ k ] ); }
+
+template< typename PERMUTATION >
+void ArrayOfR2TensorsNative< PERMUTATION >::
+tensorAbstractionStaticSliceKernel( StaticArraySlice< VALUE_TYPE const, PERMUTATION > const a,
+                                    StaticArraySlice< VALUE_TYPE const, PERMUTATION > const b,
+                                    StaticArraySlice< VALUE_TYPE, PERMUTATION > const c )
+{ OUTER_LOOP( a.size( 0 ), R2TensorMultiply( a[ i ], b[ i ], c[ i ] ); ); }
+
+template< typename PERMUTATION >
+void ArrayOfR2TensorsNative< PERMUTATION >::
+tiledKernel( TiledArray::ViewTypeConst & a,
+             TiledArray::ViewTypeConst & b,
+             TiledArray::ViewType & c )
+{
+  INDEX_TYPE const numTiles = a.numTiles();
+  for( INDEX_TYPE t = 0; t < numTiles; ++t )
+  {
+    TiledArray::ViewTypeConst::TileType const aTile = a.tile( t );
+    TiledArray::ViewTypeConst::TileType const bTile = b.tile( t );
+    TiledArray::ViewType::TileType const cTile = c.tile( t );
+
+    // Same as INNER_LOOP but with the lanes of the tile innermost so that it vectorizes.
+    for( INDEX_TYPE j = 0; j < 3; ++j )
+    {
+      for( INDEX_TYPE k = 0; k < 3; ++k )
+      {
+        VALUE_TYPE dot[ TILE_SIZE ] = {};
+        for( INDEX_TYPE l = 0; l < 3; ++l )
+        {
+          for( INDEX_TYPE lane = 0; lane < TILE_SIZE; ++lane )
+          {
+            dot[ lane ] = dot[ lane ] + aTile( lane, j, l ) * bTile( lane, l, k );
+          }
+        }
+
+        for( INDEX_TYPE lane = 0; lane < TILE_SIZE; ++lane )
+        {
+          cTile( lane, j, k ) += dot[ lane ];
+        }
+      }
+    }
+  }
+}
+
 template< typename PERMUTATION >
 void ArrayOfR2TensorsNative< PERMUTATION >::
 RAJAViewKernel( RajaView< VALUE_TYPE const, PERMUTATION > const & a,
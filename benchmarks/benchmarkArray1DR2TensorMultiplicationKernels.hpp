@@ -18,6 +18,7 @@
 
 // Source includes
 #include "benchmarkHelpers.hpp"
+#include "TiledArray.hpp"
 
 // TPL includes
 #include <benchmark/benchmark.h>
@@ -32,6 +33,32 @@ namespace benchmarking
 using VALUE_TYPE = double;
 constexpr unsigned long THREADS_PER_BLOCK = 256;
 
+/// The extents of an array of R2 tensors, only the number of tensors is dynamic.
+using R2_EXTENTS = Extents< DYNAMIC_EXTENT, 3, 3 >;
+
+template< typename T, typename PERMUTATION >
+using StaticArray = LvArray::Array< T, 3, PERMUTATION, INDEX_TYPE, DEFAULT_BUFFER, R2_EXTENTS >;
+
+template< typename T, typename PERMUTATION >
+using StaticArrayView = LvArray::ArrayView< T,
+                                            3,
+                                            getStrideOneDimension( PERMUTATION {} ),
+                                            INDEX_TYPE,
+                                            DEFAULT_BUFFER,
+                                            StaticStrides< PERMUTATION, R2_EXTENTS > >;
+
+template< typename T, typename PERMUTATION >
+using StaticArraySlice = LvArray::ArraySlice< T,
+                                              3,
+                                              getStrideOneDimension( PERMUTATION {} ),
+                                              INDEX_TYPE,
+                                              StaticStrides< PERMUTATION, R2_EXTENTS > >;
+
+/// The number of tensors stored in each tile of a TiledArray, enough for a 512 bit vector of doubles.
+constexpr int TILE_SIZE = 8;
+
+using TiledArray = LvArray::TiledArray< VALUE_TYPE, 3, TILE_SIZE, INDEX_TYPE, DEFAULT_BUFFER >;
+
 #define TIMING_LOOP( KERNEL ) \
   for( auto _ : this->m_state ) \
   { \
@@ -127,6 +154,59 @@ public:
     TIMING_LOOP( tensorAbstractionSliceKernel( a, b, c ) );
   }
 
+  void fortranStaticView() const
+  {
+    StaticArray< VALUE_TYPE, PERMUTATION > a, b, c;
+    copyToStatic( a, b, c );
+    StaticArrayView< VALUE_TYPE const, PERMUTATION > const & aView = a.toViewConst();
+    StaticArrayView< VALUE_TYPE const, PERMUTATION > const & bView = b.toViewConst();
+    StaticArrayView< VALUE_TYPE, PERMUTATION > const & cView = c.toView();
+    TIMING_LOOP( fortranStaticViewKernel( aView, bView, cView ) );
+    copyFromStatic( c );
+  }
+
+  void subscriptStaticSlice() const
+  {
+    StaticArray< VALUE_TYPE, PERMUTATION > a, b, c;
+    copyToStatic( a, b, c );
+    StaticArraySlice< VALUE_TYPE const, PERMUTATION > const aSlice = a.toSliceConst();
+    StaticArraySlice< VALUE_TYPE const, PERMUTATION > const bSlice = b.toSliceConst();
+    StaticArraySlice< VALUE_TYPE, PERMUTATION > const cSlice = c.toSlice();
+    TIMING_LOOP( subscriptStaticSliceKernel( aSlice, bSlice, cSlice ) );
+    copyFromStatic( c );
+  }
+
+  void tensorAbstractionStaticSlice() const
+  {
+    StaticArray< VALUE_TYPE, PERMUTATION > a, b, c;
+    copyToStatic( a, b, c );
+    StaticArraySlice< VALUE_TYPE const, PERMUTATION > const aSlice = a.toSliceConst();
+    StaticArraySlice< VALUE_TYPE const, PERMUTATION > const bSlice = b.toSliceConst();
+    StaticArraySlice< VALUE_TYPE, PERMUTATION > const cSlice = c.toSlice();
+    TIMING_LOOP( tensorAbstractionStaticSliceKernel( aSlice, bSlice, cSlice ) );
+    copyFromStatic( c );
+  }
+
+  void tiled() const
+  {
+    TiledArray a( m_a.size( 0 ), 3, 3 );
+    TiledArray b( m_b.size( 0 ), 3, 3 );
+    TiledArray c( m_c.size( 0 ), 3, 3 );
+    forValuesInSliceWithIndices( m_a.toSliceConst(), [&a, &b, this]( VALUE_TYPE const & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+    {
+      a( i, j, k ) = value;
+      b( i, j, k ) = m_b( i, j, k );
+    } );
+
+    TiledArray::ViewTypeConst & aView = a.toViewConst();
+    TiledArray::ViewTypeConst & bView = b.toViewConst();
+    TiledArray::ViewType & cView = c.toView();
+    TIMING_LOOP( tiledKernel( aView, bView, cView ) );
+
+    forValuesInSliceWithIndices( m_c.toSlice(), [&c]( VALUE_TYPE & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+    { value = c( i, j, k ); } );
+  }
+
   void RAJAView() const
   {
     RajaView< VALUE_TYPE const, PERMUTATION > const a = makeRajaView( m_a );
@@ -154,6 +234,21 @@ protected:
 
 private:
 
+  void copyToStatic( StaticArray< VALUE_TYPE, PERMUTATION > & a,
+                     StaticArray< VALUE_TYPE, PERMUTATION > & b,
+                     StaticArray< VALUE_TYPE, PERMUTATION > & c ) const
+  {
+    a.resizeWithoutInitializationOrDestruction( m_a.size( 0 ), 3, 3 );
+    b.resizeWithoutInitializationOrDestruction( m_b.size( 0 ), 3, 3 );
+    c.resize( m_c.size( 0 ), 3, 3 );
+    std::copy( m_a.data(), m_a.data() + m_a.size(), a.data() );
+    std::copy( m_b.data(), m_b.data() + m_b.size(), b.data() );
+    std::copy( m_c.data(), m_c.data() + m_c.size(), c.data() );
+  }
+
+  void copyFromStatic( StaticArray< VALUE_TYPE, PERMUTATION > const & c ) const
+  { std::copy( c.data(), c.data() + c.size(), m_c.data() ); }
+
   static void fortranArrayKernel( Array< VALUE_TYPE, PERMUTATION > const & a,
                                   Array< VALUE_TYPE, PERMUTATION > const & b,
                                   Array< VALUE_TYPE, PERMUTATION > const & c );
@@ -190,6 +285,22 @@ private:
                                             ArraySlice< VALUE_TYPE const, PERMUTATION > const b,
                                             ArraySlice< VALUE_TYPE, PERMUTATION > const c );
 
+  static void fortranStaticViewKernel( StaticArrayView< VALUE_TYPE const, PERMUTATION > const & a,
+                                       StaticArrayView< VALUE_TYPE const, PERMUTATION > const & b,
+                                       StaticArrayView< VALUE_TYPE, PERMUTATION > const & c );
+
+  static void subscriptStaticSliceKernel( StaticArraySlice< VALUE_TYPE const, PERMUTATION > const a,
+                                          StaticArraySlice< VALUE_TYPE const, PERMUTATION > const b,
+                                          StaticArraySlice< VALUE_TYPE, PERMUTATION > const c );
+
+  static void tensorAbstractionStaticSliceKernel( StaticArraySlice< VALUE_TYPE const, PERMUTATION > const a,
+                                                  StaticArraySlice< VALUE_TYPE const, PERMUTATION > const b,
+                                                  StaticArraySlice< VALUE_TYPE, PERMUTATION > const c );
+
+  static void tiledKernel( TiledArray::ViewTypeConst & a,
+                           TiledArray::ViewTypeConst & b,
+                           TiledArray::ViewType & c );
+
   static void RAJAViewKernel( RajaView< VALUE_TYPE const, PERMUTATION > const & a,
                               RajaView< VALUE_TYPE const, PERMUTATION > const & b,
                               RajaView< VALUE_TYPE, PERMUTATION > const & c );
@@ -0,0 +1,95 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkBuildFromItemsKernels.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+ResultsMap< VALUE_TYPE, 3 > resultsMap;
+
+template< typename POLICY >
+void naive( benchmark::State & state )
+{
+  BuildFromItems< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.naive();
+}
+
+template< typename POLICY >
+void arrayOfArrays( benchmark::State & state )
+{
+  BuildFromItems< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.arrayOfArrays();
+}
+
+template< typename POLICY >
+void arrayOfSets( benchmark::State & state )
+{
+  BuildFromItems< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.arrayOfSets();
+}
+
+INDEX_TYPE const NX = 100;
+INDEX_TYPE const NY = 100;
+INDEX_TYPE const NZ = 100;
+
+void registerBenchmarks()
+{
+  REGISTER_BENCHMARK_TEMPLATE( WRAP( { NX, NY, NZ } ), naive, serialPolicy );
+
+  forEachArg( []( auto policy )
+  {
+    using POLICY = decltype( policy );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { NX, NY, NZ } ), arrayOfArrays, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { NX, NY, NZ } ), arrayOfSets, POLICY );
+  },
+              serialPolicy {}
+  #if defined(USE_OPENMP)
+              , parallelHostPolicy {}
+  #endif
+              );
+}
+
+} // namespace benchmarking
+} // namespace LvArray
+
+int main( int argc, char * * argv )
+{
+  LvArray::benchmarking::registerBenchmarks();
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  LVARRAY_LOG( "INDEX_TYPE = " << LvArray::demangleType< LvArray::benchmarking::INDEX_TYPE >() );
+
+  LVARRAY_LOG( "Node to element map of a " << LvArray::benchmarking::NX << " x " <<
+               LvArray::benchmarking::NY << " x " << LvArray::benchmarking::NZ << " hexahedral mesh." );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap );
+}
@@ -0,0 +1,102 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkBuildFromItemsKernels.hpp"
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+/**
+ * @brief @return A checksum of @p nodeToElemMap that doesn't depend on the order of the elements of a node.
+ * @tparam ARRAY The type of the node to element map, either an ArrayOfArraysT or an ArrayOfSetsT.
+ * @param nodeToElemMap The node to element map that was built.
+ */
+template< typename ARRAY >
+VALUE_TYPE checksum( ARRAY const & nodeToElemMap )
+{
+  INDEX_TYPE const numNodes = nodeToElemMap.size();
+  VALUE_TYPE sum = 0;
+  for( INDEX_TYPE const nodeID : { INDEX_TYPE( 0 ), numNodes / 3, numNodes / 2, numNodes - 1 } )
+  {
+    for( INDEX_TYPE const elemID : nodeToElemMap[ nodeID ] )
+    { sum += elemID + 1; }
+  }
+
+  return sum;
+}
+
+template< typename POLICY >
+VALUE_TYPE BuildFromItems< POLICY >::
+naiveKernel( INDEX_TYPE const numNodes,
+             ArrayView< INDEX_TYPE const, RAJA::PERM_IJ > const & elemToNodeMap )
+{
+  ArrayOfArraysT nodeToElemMap( numNodes, NODES_PER_ELEM );
+  for( INDEX_TYPE elemID = 0; elemID < elemToNodeMap.size( 0 ); ++elemID )
+  {
+    for( int localNode = 0; localNode < NODES_PER_ELEM; ++localNode )
+    { nodeToElemMap.emplaceBack( elemToNodeMap( elemID, localNode ), elemID ); }
+  }
+
+  return checksum( nodeToElemMap );
+}
+
+template< typename POLICY >
+VALUE_TYPE BuildFromItems< POLICY >::
+arrayOfArraysKernel( INDEX_TYPE const numNodes,
+                     ArrayView< INDEX_TYPE const, RAJA::PERM_IJ > const & elemToNodeMap )
+{
+  using AtomicPolicy = typename RAJAHelper< POLICY >::AtomicPolicy;
+  ArrayOfArraysT nodeToElemMap;
+  nodeToElemMap.template buildFromItems< POLICY, AtomicPolicy >( numNodes, elemToNodeMap.size( 0 ),
+                                                                 [elemToNodeMap] ( INDEX_TYPE const elemID, auto && emit )
+  {
+    for( int localNode = 0; localNode < NODES_PER_ELEM; ++localNode )
+    { emit( elemToNodeMap( elemID, localNode ), elemID ); }
+  } );
+
+  return checksum( nodeToElemMap );
+}
+
+template< typename POLICY >
+VALUE_TYPE BuildFromItems< POLICY >::
+arrayOfSetsKernel( INDEX_TYPE const numNodes,
+                   ArrayView< INDEX_TYPE const, RAJA::PERM_IJ > const & elemToNodeMap )
+{
+  using AtomicPolicy = typename RAJAHelper< POLICY >::AtomicPolicy;
+  ArrayOfSetsT nodeToElemMap;
+  nodeToElemMap.template buildFromItems< POLICY, AtomicPolicy >( numNodes, elemToNodeMap.size( 0 ),
+                                                                 [elemToNodeMap] ( INDEX_TYPE const elemID, auto && emit )
+  {
+    for( int localNode = 0; localNode < NODES_PER_ELEM; ++localNode )
+    { emit( elemToNodeMap( elemID, localNode ), elemID ); }
+  } );
+
+  return checksum( nodeToElemMap );
+}
+
+template class BuildFromItems< serialPolicy >;
+
+#if defined(USE_OPENMP)
+template class BuildFromItems< parallelHostPolicy >;
+#endif
+
+} // namespace benchmarking
+} // namespace LvArray
@@ -0,0 +1,143 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "benchmarkHelpers.hpp"
+#include "ArrayOfArrays.hpp"
+#include "ArrayOfSets.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+using VALUE_TYPE = INDEX_TYPE;
+
+using ArrayOfArraysT = ArrayOfArrays< INDEX_TYPE, INDEX_TYPE, DEFAULT_BUFFER >;
+
+using ArrayOfSetsT = ArrayOfSets< INDEX_TYPE, INDEX_TYPE, DEFAULT_BUFFER >;
+
+constexpr int NODES_PER_ELEM = 8;
+
+#define TIMING_LOOP( KERNEL ) \
+  for( auto _ : m_state ) \
+  { \
+    LVARRAY_UNUSED_VARIABLE( _ ); \
+    m_sum += KERNEL; \
+    ::benchmark::DoNotOptimize( m_sum ); \
+    ::benchmark::ClobberMemory(); \
+  } \
+
+/**
+ * @class BuildFromItems
+ * @brief Times building the node to element map of a structured hexahedral mesh from its element to node map.
+ *   The naive version gives every node room for eight elements and appends each element to its nodes one at a
+ *   time, the others use buildFromItems< POLICY > which counts the elements of each node, allocates once and then
+ *   appends concurrently.
+ */
+template< typename POLICY >
+class BuildFromItems
+{
+public:
+
+  BuildFromItems( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 3 > & results ):
+    m_state( state ),
+    m_callingFunction( callingFunction ),
+    m_results( results ),
+    m_numElemsX( state.range( 0 ) ),
+    m_numElemsY( state.range( 1 ) ),
+    m_numElemsZ( state.range( 2 ) ),
+    m_numNodes( ( m_numElemsX + 1 ) * ( m_numElemsY + 1 ) * ( m_numElemsZ + 1 ) ),
+    m_elemToNodeMap( m_numElemsX * m_numElemsY * m_numElemsZ, NODES_PER_ELEM ),
+    m_sum( 0 )
+  {
+    INDEX_TYPE const elemJp = m_numElemsX;
+    INDEX_TYPE const elemKp = elemJp * m_numElemsY;
+
+    INDEX_TYPE const nodeJp = m_numElemsX + 1;
+    INDEX_TYPE const nodeKp = nodeJp * ( m_numElemsY + 1 );
+
+    for( INDEX_TYPE i = 0; i < m_numElemsX; ++i )
+    {
+      for( INDEX_TYPE j = 0; j < m_numElemsY; ++j )
+      {
+        for( INDEX_TYPE k = 0; k < m_numElemsZ; ++k )
+        {
+          INDEX_TYPE const elemIndex = i + elemJp * j + elemKp * k;
+          INDEX_TYPE const firstNodeIndex = i + nodeJp * j + nodeKp * k;
+          m_elemToNodeMap( elemIndex, 0 ) = firstNodeIndex;
+          m_elemToNodeMap( elemIndex, 1 ) = firstNodeIndex + 1;
+          m_elemToNodeMap( elemIndex, 2 ) = firstNodeIndex + 1 + nodeJp;
+          m_elemToNodeMap( elemIndex, 3 ) = firstNodeIndex + nodeJp;
+          m_elemToNodeMap( elemIndex, 4 ) = firstNodeIndex + nodeKp;
+          m_elemToNodeMap( elemIndex, 5 ) = firstNodeIndex + nodeKp + 1;
+          m_elemToNodeMap( elemIndex, 6 ) = firstNodeIndex + nodeKp + 1 + nodeJp;
+          m_elemToNodeMap( elemIndex, 7 ) = firstNodeIndex + nodeKp + nodeJp;
+        }
+      }
+    }
+  }
+
+  ~BuildFromItems()
+  {
+    registerResult( m_results, { m_numElemsX, m_numElemsY, m_numElemsZ },
+                    m_sum / INDEX_TYPE( m_state.iterations() ), m_callingFunction );
+    m_state.counters[ "Items appended" ] = ::benchmark::Counter( m_elemToNodeMap.size(),
+                                                                 ::benchmark::Counter::kIsIterationInvariantRate,
+                                                                 ::benchmark::Counter::OneK::kIs1000 );
+  }
+
+  void naive()
+  { TIMING_LOOP( naiveKernel( m_numNodes, m_elemToNodeMap.toViewConst() ) ); }
+
+  void arrayOfArrays()
+  { TIMING_LOOP( arrayOfArraysKernel( m_numNodes, m_elemToNodeMap.toViewConst() ) ); }
+
+  void arrayOfSets()
+  { TIMING_LOOP( arrayOfSetsKernel( m_numNodes, m_elemToNodeMap.toViewConst() ) ); }
+
+private:
+
+  static VALUE_TYPE naiveKernel( INDEX_TYPE const numNodes,
+                                 ArrayView< INDEX_TYPE const, RAJA::PERM_IJ > const & elemToNodeMap );
+
+  static VALUE_TYPE arrayOfArraysKernel( INDEX_TYPE const numNodes,
+                                         ArrayView< INDEX_TYPE const, RAJA::PERM_IJ > const & elemToNodeMap );
+
+  static VALUE_TYPE arrayOfSetsKernel( INDEX_TYPE const numNodes,
+                                       ArrayView< INDEX_TYPE const, RAJA::PERM_IJ > const & elemToNodeMap );
+
+  ::benchmark::State & m_state;
+  std::string const m_callingFunction;
+  ResultsMap< VALUE_TYPE, 3 > & m_results;
+  INDEX_TYPE const m_numElemsX;
+  INDEX_TYPE const m_numElemsY;
+  INDEX_TYPE const m_numElemsZ;
+  INDEX_TYPE const m_numNodes;
+  Array< INDEX_TYPE, RAJA::PERM_IJ > m_elemToNodeMap;
+  VALUE_TYPE m_sum = 0;
+};
+
+#undef TIMING_LOOP
+
+} // namespace benchmarking
+} // namespace LvArray
@@ -0,0 +1,87 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkCompressKernels.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+ResultsMap< VALUE_TYPE, 2 > resultsMap;
+
+template< typename POLICY >
+void serial( benchmark::State & state )
+{
+  Compress< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.serial();
+}
+
+template< typename POLICY >
+void withPolicy( benchmark::State & state )
+{
+  Compress< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.withPolicy();
+}
+
+INDEX_TYPE const NUM_ROWS = (2 << 18) + 573;
+INDEX_TYPE const NNZ_PER_ROW = 27;
+
+void registerBenchmarks()
+{
+  REGISTER_BENCHMARK_TEMPLATE( WRAP( { NUM_ROWS, NNZ_PER_ROW } ), serial, serialPolicy );
+
+  forEachArg( []( auto policy )
+  {
+    using POLICY = decltype( policy );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { NUM_ROWS, NNZ_PER_ROW } ), withPolicy, POLICY );
+  },
+              serialPolicy {}
+  #if defined(USE_OPENMP)
+              , parallelHostPolicy {}
+  #endif
+              );
+}
+
+} // namespace benchmarking
+} // namespace LvArray
+
+int main( int argc, char * * argv )
+{
+  LvArray::benchmarking::registerBenchmarks();
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  LVARRAY_LOG( "VALUE_TYPE = " << LvArray::demangleType< LvArray::benchmarking::VALUE_TYPE >() );
+  LVARRAY_LOG( "INDEX_TYPE = " << LvArray::demangleType< LvArray::benchmarking::INDEX_TYPE >() );
+
+  LVARRAY_LOG( "Matrices with " << LvArray::benchmarking::NUM_ROWS << " rows and " <<
+               LvArray::benchmarking::NNZ_PER_ROW << " non zeros per row." );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap );
+}
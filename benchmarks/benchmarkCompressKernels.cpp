@@ -0,0 +1,63 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkCompressKernels.hpp"
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+/**
+ * @brief @return The sum of a few of the entries of @p matrix.
+ * @param matrix the matrix that was compressed.
+ */
+VALUE_TYPE checksum( CRSMatrixT const & matrix )
+{
+  INDEX_TYPE const numRows = matrix.numRows();
+  INDEX_TYPE const totalNonZeros = matrix.getOffsets()[ numRows ];
+  VALUE_TYPE const * const entries = matrix.getEntries( 0 );
+  COLUMN_TYPE const * const columns = matrix.getColumns( 0 );
+  return totalNonZeros + entries[ totalNonZeros / 3 ] + entries[ totalNonZeros - 1 ] + columns[ totalNonZeros / 2 ];
+}
+
+template< typename POLICY >
+VALUE_TYPE Compress< POLICY >::
+serialKernel( CRSMatrixT & matrix )
+{
+  matrix.compress();
+  return checksum( matrix );
+}
+
+template< typename POLICY >
+VALUE_TYPE Compress< POLICY >::
+policyKernel( CRSMatrixT & matrix )
+{
+  matrix.template compress< POLICY >();
+  return checksum( matrix );
+}
+
+template class Compress< serialPolicy >;
+
+#if defined(USE_OPENMP)
+template class Compress< parallelHostPolicy >;
+#endif
+
+} // namespace benchmarking
+} // namespace LvArray
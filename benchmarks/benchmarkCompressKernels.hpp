@@ -0,0 +1,113 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "benchmarkHelpers.hpp"
+#include "CRSMatrix.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+using VALUE_TYPE = double;
+
+using COLUMN_TYPE = std::ptrdiff_t;
+
+using CRSMatrixT = CRSMatrix< VALUE_TYPE, COLUMN_TYPE, INDEX_TYPE, DEFAULT_BUFFER >;
+
+#define TIMING_LOOP( KERNEL ) \
+  for( auto _ : m_state ) \
+  { \
+    LVARRAY_UNUSED_VARIABLE( _ ); \
+    m_state.PauseTiming(); \
+    m_matrix = m_original; \
+    m_state.ResumeTiming(); \
+    m_sum += KERNEL; \
+    ::benchmark::DoNotOptimize( m_sum ); \
+    ::benchmark::ClobberMemory(); \
+  } \
+
+/**
+ * @class Compress
+ * @brief Times compressing a CRSMatrix where every row has as much extra capacity as it has non zeros.
+ *   The serial version shifts each row down in place, the other uses compress< POLICY > which relocates
+ *   the rows in place in parallel batches.
+ */
+template< typename POLICY >
+class Compress
+{
+public:
+
+  Compress( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 2 > & results ):
+    m_state( state ),
+    m_callingFunction( callingFunction ),
+    m_results( results ),
+    m_original( state.range( 0 ), state.range( 0 ), 2 * state.range( 1 ) ),
+    m_matrix(),
+    m_sum( 0 )
+  {
+    INDEX_TYPE const numRows = m_original.numRows();
+    INDEX_TYPE const nnzPerRow = state.range( 1 );
+    for( INDEX_TYPE row = 0; row < numRows; ++row )
+    {
+      for( INDEX_TYPE i = 0; i < nnzPerRow; ++i )
+      {
+        COLUMN_TYPE const col = ( row + i * ( numRows / nnzPerRow ) ) % numRows;
+        m_original.insertNonZero( row, col, VALUE_TYPE( row + col ) );
+      }
+    }
+  }
+
+  ~Compress()
+  {
+    registerResult( m_results, { m_original.numRows(), m_state.range( 1 ) },
+                    m_sum / INDEX_TYPE( m_state.iterations() ), m_callingFunction );
+    m_state.counters[ "Non zeros moved" ] = ::benchmark::Counter( m_original.numNonZeros(),
+                                                                  ::benchmark::Counter::kIsIterationInvariantRate,
+                                                                  ::benchmark::Counter::OneK::kIs1000 );
+  }
+
+  void serial()
+  { TIMING_LOOP( serialKernel( m_matrix ) ); }
+
+  void withPolicy()
+  { TIMING_LOOP( policyKernel( m_matrix ) ); }
+
+private:
+
+  static VALUE_TYPE serialKernel( CRSMatrixT & matrix );
+
+  static VALUE_TYPE policyKernel( CRSMatrixT & matrix );
+
+  ::benchmark::State & m_state;
+  std::string const m_callingFunction;
+  ResultsMap< VALUE_TYPE, 2 > & m_results;
+  CRSMatrixT m_original;
+  CRSMatrixT m_matrix;
+  VALUE_TYPE m_sum = 0;
+};
+
+#undef TIMING_LOOP
+
+} // namespace benchmarking
+} // namespace LvArray
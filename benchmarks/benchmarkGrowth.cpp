@@ -0,0 +1,93 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+// Source includes
+#include "benchmarkGrowthKernels.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+ResultsMap< VALUE_TYPE, 2 > resultsMap;
+
+template< typename T >
+void emplaceBack( benchmark::State & state )
+{
+  Growth< T > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.emplaceBack();
+}
+
+template< typename T >
+void resize( benchmark::State & state )
+{
+  Growth< T > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.resize();
+}
+
+template< typename T >
+void appendToArray( benchmark::State & state )
+{
+  Growth< T > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.appendToArray();
+}
+
+INDEX_TYPE const ARRAY_SIZE = (2 << 22) + 573;
+INDEX_TYPE const RESIZE_INCREMENT = 1 << 18;
+INDEX_TYPE const ARRAY_OF_ARRAYS_SIZE = (2 << 17) + 573;
+INDEX_TYPE const NUM_ARRAYS = 256;
+
+void registerBenchmarks()
+{
+  forEachArg( []( auto value )
+  {
+    using T = decltype( value );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { ARRAY_SIZE, 1 } ), emplaceBack, T );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { ARRAY_SIZE, RESIZE_INCREMENT } ), resize, T );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { ARRAY_OF_ARRAYS_SIZE, NUM_ARRAYS } ), appendToArray, T );
+  },
+              VALUE_TYPE {},
+              NonRelocatableDouble {}
+              );
+}
+
+} // namespace benchmarking
+} // namespace LvArray
+
+int main( int argc, char * * argv )
+{
+  LvArray::benchmarking::registerBenchmarks();
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  LVARRAY_LOG( "INDEX_TYPE = " << LvArray::demangleType< LvArray::benchmarking::INDEX_TYPE >() );
+
+  LVARRAY_LOG( "Array problems of size ( " << LvArray::benchmarking::ARRAY_SIZE << " )." );
+  LVARRAY_LOG( "ArrayOfArrays problems of size ( " << LvArray::benchmarking::ARRAY_OF_ARRAYS_SIZE << ", " <<
+               LvArray::benchmarking::NUM_ARRAYS << " )." );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap );
+}
@@ -0,0 +1,94 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+// Source includes
+#include "benchmarkGrowthKernels.hpp"
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+template< typename T >
+VALUE_TYPE Growth< T >::emplaceBackKernel( INDEX_TYPE const numValues )
+{
+  Array1dT< T > array;
+  for( INDEX_TYPE i = 0; i < numValues; ++i )
+  {
+    array.emplace_back( i );
+  }
+
+  VALUE_TYPE sum = 0;
+  for( INDEX_TYPE i = 0; i < array.size(); ++i )
+  {
+    sum += array[ i ];
+  }
+
+  return sum;
+}
+
+template< typename T >
+VALUE_TYPE Growth< T >::resizeKernel( INDEX_TYPE const numValues, INDEX_TYPE const increment )
+{
+  Array1dT< T > array;
+  for( INDEX_TYPE size = 0; size < numValues; size += increment )
+  {
+    INDEX_TYPE const newSize = min( size + increment, numValues );
+
+    // Array::resize only reserves exactly the new size so every increment causes a reallocation.
+    array.resize( newSize );
+    for( INDEX_TYPE i = size; i < newSize; ++i )
+    {
+      array[ i ] = i;
+    }
+  }
+
+  VALUE_TYPE sum = 0;
+  for( INDEX_TYPE i = 0; i < array.size(); ++i )
+  {
+    sum += array[ i ];
+  }
+
+  return sum;
+}
+
+template< typename T >
+VALUE_TYPE Growth< T >::appendToArrayKernel( INDEX_TYPE const numValues, INDEX_TYPE const numArrays )
+{
+  ArrayOfArraysT< T > arrayOfArrays( numArrays );
+  for( INDEX_TYPE i = 0; i < numValues; ++i )
+  {
+    arrayOfArrays.emplaceBack( i % numArrays, i );
+  }
+
+  VALUE_TYPE sum = 0;
+  for( INDEX_TYPE i = 0; i < arrayOfArrays.size(); ++i )
+  {
+    for( T const & value : arrayOfArrays[ i ] )
+    {
+      sum += value;
+    }
+  }
+
+  return sum;
+}
+
+template class Growth< VALUE_TYPE >;
+template class Growth< NonRelocatableDouble >;
+
+} // namespace benchmarking
+} // namespace LvArray
@@ -0,0 +1,143 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "benchmarkHelpers.hpp"
+#include "MallocBuffer.hpp"
+#include "ArrayOfArrays.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+using VALUE_TYPE = double;
+
+/**
+ * @class NonRelocatableDouble
+ * @brief A double with user provided copy and move constructors. Since it isn't trivially copyable
+ *   the buffers have to move it element by element, which is what every type did before
+ *   IsTriviallyRelocatable existed.
+ */
+class NonRelocatableDouble
+{
+public:
+  NonRelocatableDouble( VALUE_TYPE const value=0 ):
+    m_value( value )
+  {}
+
+  NonRelocatableDouble( NonRelocatableDouble const & src ):
+    m_value( src.m_value )
+  {}
+
+  NonRelocatableDouble( NonRelocatableDouble && src ):
+    m_value( src.m_value )
+  {}
+
+  NonRelocatableDouble & operator=( NonRelocatableDouble const & src )
+  {
+    m_value = src.m_value;
+    return *this;
+  }
+
+  NonRelocatableDouble & operator=( NonRelocatableDouble && src )
+  {
+    m_value = src.m_value;
+    return *this;
+  }
+
+  operator VALUE_TYPE() const
+  { return m_value; }
+
+private:
+  VALUE_TYPE m_value;
+};
+
+static_assert( isTriviallyRelocatable< VALUE_TYPE >, "The fast path should be used for VALUE_TYPE." );
+static_assert( !isTriviallyRelocatable< NonRelocatableDouble >, "The fast path should not be used for NonRelocatableDouble." );
+
+template< typename T >
+using Array1dT = LvArray::Array< T, 1, RAJA::PERM_I, INDEX_TYPE, MallocBuffer >;
+
+template< typename T >
+using ArrayOfArraysT = LvArray::ArrayOfArrays< T, INDEX_TYPE, MallocBuffer >;
+
+#define TIMING_LOOP( KERNEL ) \
+  for( auto _ : m_state ) \
+  { \
+    LVARRAY_UNUSED_VARIABLE( _ ); \
+    m_sum += KERNEL; \
+    ::benchmark::DoNotOptimize( m_sum ); \
+    ::benchmark::ClobberMemory(); \
+  } \
+
+template< typename T >
+class Growth
+{
+public:
+
+  Growth( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 2 > & results ):
+    m_state( state ),
+    m_callingFunction( callingFunction ),
+    m_results( results ),
+    m_numValues( state.range( 0 ) ),
+    m_parameter( state.range( 1 ) ),
+    m_sum( 0 )
+  {}
+
+  ~Growth()
+  {
+    registerResult( m_results, { m_numValues, m_parameter }, m_sum / INDEX_TYPE( m_state.iterations() ), m_callingFunction );
+    m_state.counters[ "Values inserted" ] = ::benchmark::Counter( m_numValues,
+                                                                  ::benchmark::Counter::kIsIterationInvariantRate,
+                                                                  ::benchmark::Counter::OneK::kIs1000 );
+  }
+
+  void emplaceBack()
+  { TIMING_LOOP( emplaceBackKernel( m_numValues ) ); }
+
+  void resize()
+  { TIMING_LOOP( resizeKernel( m_numValues, m_parameter ) ); }
+
+  void appendToArray()
+  { TIMING_LOOP( appendToArrayKernel( m_numValues, m_parameter ) ); }
+
+private:
+
+  static VALUE_TYPE emplaceBackKernel( INDEX_TYPE const numValues );
+
+  static VALUE_TYPE resizeKernel( INDEX_TYPE const numValues, INDEX_TYPE const increment );
+
+  static VALUE_TYPE appendToArrayKernel( INDEX_TYPE const numValues, INDEX_TYPE const numArrays );
+
+  ::benchmark::State & m_state;
+  std::string const m_callingFunction;
+  ResultsMap< VALUE_TYPE, 2 > & m_results;
+  INDEX_TYPE const m_numValues;
+  INDEX_TYPE const m_parameter;
+  VALUE_TYPE m_sum = 0;
+};
+
+#undef TIMING_LOOP
+
+} // namespace benchmarking
+} // namespace LvArray
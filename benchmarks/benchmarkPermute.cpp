@@ -0,0 +1,111 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkPermuteKernels.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+ResultsMap< VALUE_TYPE, 2 > resultsMap2D;
+ResultsMap< VALUE_TYPE, 3 > resultsMap3D;
+
+template< typename POLICY >
+void naive2D( benchmark::State & state )
+{
+  Permute< RAJA::PERM_IJ, RAJA::PERM_JI, POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap2D );
+  kernels.naive();
+}
+
+template< typename POLICY >
+void blocked2D( benchmark::State & state )
+{
+  Permute< RAJA::PERM_IJ, RAJA::PERM_JI, POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap2D );
+  kernels.blocked();
+}
+
+template< typename POLICY >
+void naive3D( benchmark::State & state )
+{
+  Permute< RAJA::PERM_IJK, RAJA::PERM_KJI, POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap3D );
+  kernels.naive();
+}
+
+template< typename POLICY >
+void blocked3D( benchmark::State & state )
+{
+  Permute< RAJA::PERM_IJK, RAJA::PERM_KJI, POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap3D );
+  kernels.blocked();
+}
+
+INDEX_TYPE const SIZE_2D_N = (2 << 10) + 17;
+INDEX_TYPE const SIZE_2D_M = (2 << 10) + 31;
+
+INDEX_TYPE const SIZE_3D_N = (2 << 6) + 1;
+INDEX_TYPE const SIZE_3D_M = (2 << 6) + 9;
+INDEX_TYPE const SIZE_3D_P = (2 << 6) + 15;
+
+void registerBenchmarks()
+{
+  forEachArg( []( auto policy )
+  {
+    using POLICY = decltype( policy );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE_2D_N, SIZE_2D_M } ), naive2D, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE_2D_N, SIZE_2D_M } ), blocked2D, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE_3D_N, SIZE_3D_M, SIZE_3D_P } ), naive3D, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE_3D_N, SIZE_3D_M, SIZE_3D_P } ), blocked3D, POLICY );
+  },
+              serialPolicy {}
+  #if defined(USE_OPENMP)
+              , parallelHostPolicy {}
+  #endif
+              );
+}
+
+} // namespace benchmarking
+} // namespace LvArray
+
+int main( int argc, char * * argv )
+{
+  LvArray::benchmarking::registerBenchmarks();
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  LVARRAY_LOG( "VALUE_TYPE = " << LvArray::demangleType< LvArray::benchmarking::VALUE_TYPE >() );
+  LVARRAY_LOG( "INDEX_TYPE = " << LvArray::demangleType< LvArray::benchmarking::INDEX_TYPE >() );
+
+  LVARRAY_LOG( "2D problems of size ( " << LvArray::benchmarking::SIZE_2D_N << ", " <<
+               LvArray::benchmarking::SIZE_2D_M << " )." );
+  LVARRAY_LOG( "3D problems of size ( " << LvArray::benchmarking::SIZE_3D_N << ", " <<
+               LvArray::benchmarking::SIZE_3D_M << ", " << LvArray::benchmarking::SIZE_3D_P << " )." );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  int const result2D = LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap2D );
+  int const result3D = LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap3D );
+  return result2D || result3D;
+}
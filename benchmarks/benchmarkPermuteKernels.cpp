@@ -0,0 +1,71 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkPermuteKernels.hpp"
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+/**
+ * @tparam SLICE the type of @p slice.
+ * @brief @return The sum of a few of the values of @p slice.
+ * @param slice the slice that was copied into.
+ */
+template< typename SLICE >
+VALUE_TYPE checksum( SLICE const & slice )
+{
+  VALUE_TYPE const * const values = slice.dataIfContiguous();
+  INDEX_TYPE const size = slice.size();
+  return values[ 0 ] + values[ size / 3 ] + values[ size / 2 ] + values[ size - 1 ];
+}
+
+template< typename PERMUTATION_SRC, typename PERMUTATION_DST, typename POLICY >
+VALUE_TYPE Permute< PERMUTATION_SRC, PERMUTATION_DST, POLICY >::
+naiveKernel( ArraySlice< VALUE_TYPE const, PERMUTATION_SRC > const src,
+             ArraySlice< VALUE_TYPE, PERMUTATION_DST > const dst )
+{
+  forValuesInSliceWithIndices< POLICY >( src, [dst] ( VALUE_TYPE const & value, auto const ... indices )
+  {
+    dst( indices ... ) = value;
+  } );
+
+  return checksum( dst );
+}
+
+template< typename PERMUTATION_SRC, typename PERMUTATION_DST, typename POLICY >
+VALUE_TYPE Permute< PERMUTATION_SRC, PERMUTATION_DST, POLICY >::
+blockedKernel( ArraySlice< VALUE_TYPE const, PERMUTATION_SRC > const src,
+               ArraySlice< VALUE_TYPE, PERMUTATION_DST > const dst )
+{
+  permuteInto< POLICY >( src, dst );
+  return checksum( dst );
+}
+
+template class Permute< RAJA::PERM_IJ, RAJA::PERM_JI, serialPolicy >;
+template class Permute< RAJA::PERM_IJK, RAJA::PERM_KJI, serialPolicy >;
+
+#if defined(USE_OPENMP)
+template class Permute< RAJA::PERM_IJ, RAJA::PERM_JI, parallelHostPolicy >;
+template class Permute< RAJA::PERM_IJK, RAJA::PERM_KJI, parallelHostPolicy >;
+#endif
+
+} // namespace benchmarking
+} // namespace LvArray
@@ -0,0 +1,113 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "benchmarkHelpers.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+using VALUE_TYPE = double;
+
+#define TIMING_LOOP( KERNEL ) \
+  for( auto _ : m_state ) \
+  { \
+    LVARRAY_UNUSED_VARIABLE( _ ); \
+    m_sum += KERNEL; \
+    ::benchmark::DoNotOptimize( m_sum ); \
+    ::benchmark::ClobberMemory(); \
+  } \
+
+/**
+ * @class Permute
+ * @brief Times copying an Array with permutation PERMUTATION_SRC into an Array with permutation PERMUTATION_DST.
+ *   The naive version iterates over the source in memory order and so strides through the destination, the
+ *   blocked version uses permuteInto.
+ */
+template< typename PERMUTATION_SRC, typename PERMUTATION_DST, typename POLICY >
+class Permute
+{
+public:
+
+  static constexpr int NDIM = getDimension( PERMUTATION_SRC {} );
+
+  Permute( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, NDIM > & results ):
+    m_state( state ),
+    m_callingFunction( callingFunction ),
+    m_results( results ),
+    m_sum( 0 )
+  {
+    INDEX_TYPE dims[ NDIM ];
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      dims[ dim ] = state.range( dim );
+    }
+
+    m_src.resize( NDIM, dims );
+    m_dst.resize( NDIM, dims );
+
+    int iter = 0;
+    initialize( m_src, iter );
+  }
+
+  ~Permute()
+  {
+    std::array< INDEX_TYPE, NDIM > args;
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      args[ dim ] = m_src.size( dim );
+    }
+
+    registerResult( m_results, args, m_sum / INDEX_TYPE( m_state.iterations() ), m_callingFunction );
+    m_state.counters[ "Values permuted" ] = ::benchmark::Counter( m_src.size(),
+                                                                  ::benchmark::Counter::kIsIterationInvariantRate,
+                                                                  ::benchmark::Counter::OneK::kIs1000 );
+  }
+
+  void naive()
+  { TIMING_LOOP( naiveKernel( m_src.toSliceConst(), m_dst.toSlice() ) ); }
+
+  void blocked()
+  { TIMING_LOOP( blockedKernel( m_src.toSliceConst(), m_dst.toSlice() ) ); }
+
+private:
+
+  static VALUE_TYPE naiveKernel( ArraySlice< VALUE_TYPE const, PERMUTATION_SRC > const src,
+                                 ArraySlice< VALUE_TYPE, PERMUTATION_DST > const dst );
+
+  static VALUE_TYPE blockedKernel( ArraySlice< VALUE_TYPE const, PERMUTATION_SRC > const src,
+                                   ArraySlice< VALUE_TYPE, PERMUTATION_DST > const dst );
+
+  ::benchmark::State & m_state;
+  std::string const m_callingFunction;
+  ResultsMap< VALUE_TYPE, NDIM > & m_results;
+  Array< VALUE_TYPE, PERMUTATION_SRC > m_src;
+  Array< VALUE_TYPE, PERMUTATION_DST > m_dst;
+  VALUE_TYPE m_sum = 0;
+};
+
+#undef TIMING_LOOP
+
+} // namespace benchmarking
+} // namespace LvArray
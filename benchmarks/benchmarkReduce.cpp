@@ -78,6 +78,12 @@ void pointerNative( benchmark::State & state )
   kernels.pointer();
 }
 
+void alignedPointerNative( benchmark::State & state )
+{
+  ReduceNative kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.alignedPointer();
+}
+
 template< typename POLICY >
 void fortranArrayRAJA( benchmark::State & state )
 {
@@ -127,6 +133,34 @@ void pointerRAJA( benchmark::State & state )
   kernels.pointer();
 }
 
+template< typename POLICY >
+void fortranViewFirstTouchRAJA( benchmark::State & state )
+{
+  ReduceRAJAFirstTouch< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.fortranView();
+}
+
+template< typename POLICY >
+void pointerFirstTouchRAJA( benchmark::State & state )
+{
+  ReduceRAJAFirstTouch< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.pointer();
+}
+
+template< typename POLICY >
+void reductionsViewRAJA( benchmark::State & state )
+{
+  ReduceLibrary< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.view();
+}
+
+template< typename POLICY >
+void reductionsSliceRAJA( benchmark::State & state )
+{
+  ReduceLibrary< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.slice();
+}
+
 INDEX_TYPE const SERIAL_SIZE = (2 << 20) + 573;
 #if defined(USE_OPENMP)
 INDEX_TYPE const OMP_SIZE = SERIAL_SIZE;
@@ -146,6 +180,7 @@ void registerBenchmarks()
   REGISTER_BENCHMARK( { SERIAL_SIZE }, subscriptSliceNative );
   REGISTER_BENCHMARK( { SERIAL_SIZE }, rajaViewNative );
   REGISTER_BENCHMARK( { SERIAL_SIZE }, pointerNative );
+  REGISTER_BENCHMARK( { SERIAL_SIZE }, alignedPointerNative );
 
   // Register the RAJA benchmarks.
   forEachArg( []( auto tuple )
@@ -167,6 +202,34 @@ void registerBenchmarks()
               , std::make_tuple( CUDA_SIZE, parallelDevicePolicy< THREADS_PER_BLOCK > {} )
   #endif
               );
+
+  // Register the host RAJA benchmarks again with the Array first touched by the same policy.
+  forEachArg( []( auto tuple )
+  {
+    INDEX_TYPE const size = std::get< 0 >( tuple );
+    using POLICY = std::tuple_element_t< 1, decltype( tuple ) >;
+    REGISTER_BENCHMARK_TEMPLATE( { size }, fortranViewFirstTouchRAJA, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( { size }, pointerFirstTouchRAJA, POLICY );
+  },
+              std::make_tuple( SERIAL_SIZE, serialPolicy {} )
+  #if defined(USE_OPENMP)
+              , std::make_tuple( OMP_SIZE, parallelHostPolicy {} )
+  #endif
+              );
+
+  // Register the host benchmarks of the library reductions.
+  forEachArg( []( auto tuple )
+  {
+    INDEX_TYPE const size = std::get< 0 >( tuple );
+    using POLICY = std::tuple_element_t< 1, decltype( tuple ) >;
+    REGISTER_BENCHMARK_TEMPLATE( { size }, reductionsViewRAJA, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( { size }, reductionsSliceRAJA, POLICY );
+  },
+              std::make_tuple( SERIAL_SIZE, serialPolicy {} )
+  #if defined(USE_OPENMP)
+              , std::make_tuple( OMP_SIZE, parallelHostPolicy {} )
+  #endif
+              );
 }
 
 } // namespace benchmarking
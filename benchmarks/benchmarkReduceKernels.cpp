@@ -65,6 +65,13 @@ VALUE_TYPE ReduceNative::pointerKernel( VALUE_TYPE const * const LVARRAY_RESTRIC
                                         INDEX_TYPE const N )
 { REDUCE_KERNEL( N, a[ i ] ); }
 
+VALUE_TYPE ReduceNative::alignedPointerKernel( VALUE_TYPE const * const LVARRAY_RESTRICT a,
+                                               INDEX_TYPE const N )
+{
+  VALUE_TYPE const * const LVARRAY_RESTRICT aligned = LVARRAY_ASSUME_ALIGNED( a, CACHE_LINE_SIZE );
+  REDUCE_KERNEL( N, aligned[ i ] );
+}
+
 template< class POLICY >
 VALUE_TYPE ReduceRAJA< POLICY >::fortranViewKernel( ArrayView< VALUE_TYPE const, RAJA::PERM_I > const & a )
 { REDUCE_KERNEL_RAJA( a.size(), a( i ) ); }
@@ -100,6 +107,20 @@ template class ReduceRAJA< parallelHostPolicy >;
 template class ReduceRAJA< RAJA::cuda_exec< THREADS_PER_BLOCK > >;
 #endif
 
+template< class POLICY >
+VALUE_TYPE ReduceLibrary< POLICY >::viewKernel( ArrayView< VALUE_TYPE const, RAJA::PERM_I > const & a )
+{ return reductions::sum< POLICY >( a ); }
+
+template< class POLICY >
+VALUE_TYPE ReduceLibrary< POLICY >::sliceKernel( ArraySlice< VALUE_TYPE const, RAJA::PERM_I > const a )
+{ return reductions::sum< POLICY >( a ); }
+
+template class ReduceLibrary< serialPolicy >;
+
+#if defined(USE_OPENMP)
+template class ReduceLibrary< parallelHostPolicy >;
+#endif
+
 #undef REDUCE_KERNEL
 #undef REDUCE_KERNEL_RAJA
 
@@ -20,6 +20,8 @@
 
 // Source includes
 #include "benchmarkHelpers.hpp"
+#include "AlignedBuffer.hpp"
+#include "reductions.hpp"
 
 // TPL includes
 #include <benchmark/benchmark.h>
@@ -50,10 +52,15 @@ public:
     m_callingFunction( callingFunction ),
     m_results( results ),
     m_array( state.range( 0 ) ),
+    m_alignedArray( state.range( 0 ) ),
     m_sum( 0 )
   {
     int iter = 0;
     initialize( m_array, iter );
+    for( INDEX_TYPE i = 0; i < m_array.size(); ++i )
+    {
+      m_alignedArray[ i ] = m_array[ i ];
+    }
   }
 
   ~ReduceNative()
@@ -104,12 +111,19 @@ public:
     TIMING_LOOP( pointerKernel( ptr, m_array.size() ) );
   }
 
+  void alignedPointer()
+  {
+    VALUE_TYPE const * const LVARRAY_RESTRICT ptr = m_alignedArray.toViewConst().alignedData();
+    TIMING_LOOP( alignedPointerKernel( ptr, m_alignedArray.size() ) );
+  }
+
 protected:
 
   ::benchmark::State & m_state;
   std::string const m_callingFunction;
   ResultsMap< VALUE_TYPE, 1 > & m_results;
   Array< VALUE_TYPE, RAJA::PERM_I > m_array;
+  LvArray::Array< VALUE_TYPE, 1, RAJA::PERM_I, INDEX_TYPE, CacheLineAlignedBuffer > m_alignedArray;
   VALUE_TYPE m_sum = 0;
 
 private:
@@ -133,6 +147,9 @@ private:
   static VALUE_TYPE pointerKernel( VALUE_TYPE const * const LVARRAY_RESTRICT a,
                                    INDEX_TYPE const N );
 
+  static VALUE_TYPE alignedPointerKernel( VALUE_TYPE const * const LVARRAY_RESTRICT a,
+                                          INDEX_TYPE const N );
+
 };
 
 template< typename POLICY >
@@ -196,6 +213,64 @@ public:
                                    INDEX_TYPE const N );
 };
 
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @brief The ReduceRAJA kernels run on an Array whose pages were first touched with @p POLICY
+ *   instead of by the master thread. On a NUMA machine comparing the two shows the cost of
+ *   remote accesses.
+ */
+template< typename POLICY >
+class ReduceRAJAFirstTouch : public ReduceRAJA< POLICY >
+{
+public:
+
+  ReduceRAJAFirstTouch( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 1 > & results ):
+    ReduceRAJA< POLICY >( state, callingFunction, results )
+  {
+    Array< VALUE_TYPE, RAJA::PERM_I > array;
+    array.template resize< POLICY >( this->m_array.size() );
+
+    // The pages are already placed, so it doesn't matter who copies the values.
+    for( INDEX_TYPE i = 0; i < array.size(); ++i )
+    {
+      array[ i ] = this->m_array[ i ];
+    }
+
+    this->m_array = std::move( array );
+  }
+};
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @brief Sums the Array with reductions::sum instead of a hand written loop.
+ */
+template< typename POLICY >
+class ReduceLibrary : public ReduceNative
+{
+public:
+
+  ReduceLibrary( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 1 > & results ):
+    ReduceNative( state, callingFunction, results )
+  {}
+
+  void view()
+  {
+    ArrayView< VALUE_TYPE const, RAJA::PERM_I > const & view = m_array.toViewConst();
+    TIMING_LOOP( viewKernel( view ) );
+  }
+
+  void slice()
+  {
+    ArraySlice< VALUE_TYPE const, RAJA::PERM_I > const & slice = m_array.toSliceConst();
+    TIMING_LOOP( sliceKernel( slice ) );
+  }
+
+private:
+  static VALUE_TYPE viewKernel( ArrayView< VALUE_TYPE const, RAJA::PERM_I > const & a );
+
+  static VALUE_TYPE sliceKernel( ArraySlice< VALUE_TYPE const, RAJA::PERM_I > const a );
+};
+
 #undef TIMING_LOOP
 
 } // namespace benchmarking
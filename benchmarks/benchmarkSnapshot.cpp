@@ -0,0 +1,91 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkSnapshotKernels.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+ResultsMap< VALUE_TYPE, 2 > resultsMap;
+
+void snapshotMalloc( benchmark::State & state )
+{
+  Snapshot kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.snapshot< MallocBuffer >();
+}
+
+void snapshotCopyOnWrite( benchmark::State & state )
+{
+  Snapshot kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.snapshot< CopyOnWriteBuffer >();
+}
+
+void rollbackMalloc( benchmark::State & state )
+{
+  Snapshot kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.rollback< MallocBuffer >();
+}
+
+void rollbackCopyOnWrite( benchmark::State & state )
+{
+  Snapshot kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.rollback< CopyOnWriteBuffer >();
+}
+
+INDEX_TYPE const SIZE = (2 << 18) + 573;
+
+void registerBenchmarks()
+{
+  for( INDEX_TYPE const numWritten : { INDEX_TYPE( 0 ), INDEX_TYPE( 1 ), NUM_FIELDS } )
+  {
+    REGISTER_BENCHMARK( WRAP( { SIZE, numWritten } ), snapshotMalloc );
+    REGISTER_BENCHMARK( WRAP( { SIZE, numWritten } ), snapshotCopyOnWrite );
+    REGISTER_BENCHMARK( WRAP( { SIZE, numWritten } ), rollbackMalloc );
+    REGISTER_BENCHMARK( WRAP( { SIZE, numWritten } ), rollbackCopyOnWrite );
+  }
+}
+
+} // namespace benchmarking
+} // namespace LvArray
+
+int main( int argc, char * * argv )
+{
+  LvArray::benchmarking::registerBenchmarks();
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  LVARRAY_LOG( "VALUE_TYPE = " << LvArray::demangleType< LvArray::benchmarking::VALUE_TYPE >() );
+  LVARRAY_LOG( "INDEX_TYPE = " << LvArray::demangleType< LvArray::benchmarking::INDEX_TYPE >() );
+
+  LVARRAY_LOG( "Snapshots of " << LvArray::benchmarking::NUM_FIELDS << " fields of size ( " <<
+               LvArray::benchmarking::SIZE << ", " << LvArray::benchmarking::NUM_COMPONENTS << " )." );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap );
+}
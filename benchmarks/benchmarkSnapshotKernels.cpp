@@ -0,0 +1,87 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkSnapshotKernels.hpp"
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+template< template< typename > class BUFFER_TYPE >
+std::vector< Array2dT< BUFFER_TYPE > > Snapshot::createFields( INDEX_TYPE const numValues )
+{
+  std::vector< Array2dT< BUFFER_TYPE > > fields( NUM_FIELDS );
+  for( INDEX_TYPE field = 0; field < NUM_FIELDS; ++field )
+  {
+    fields[ field ].resize( numValues, NUM_COMPONENTS );
+    for( INDEX_TYPE i = 0; i < numValues; ++i )
+    {
+      for( INDEX_TYPE j = 0; j < NUM_COMPONENTS; ++j )
+      {
+        fields[ field ]( i, j ) = field + i + j;
+      }
+    }
+  }
+
+  return fields;
+}
+
+template< template< typename > class BUFFER_TYPE >
+VALUE_TYPE Snapshot::snapshotKernel( std::vector< Array2dT< BUFFER_TYPE > > & fields,
+                                     INDEX_TYPE const numWritten,
+                                     bool const rollback )
+{
+  std::vector< Array2dT< BUFFER_TYPE > > const snapshot( fields );
+
+  VALUE_TYPE sum = 0;
+  for( INDEX_TYPE field = 0; field < numWritten; ++field )
+  {
+    // Touching the field is what detaches a CopyOnWriteBuffer.
+    fields[ field ].move( MemorySpace::CPU );
+    LvArray::ArrayView< VALUE_TYPE, 2, 1, INDEX_TYPE, BUFFER_TYPE > const view = fields[ field ].toView();
+    for( INDEX_TYPE i = 0; i < view.size( 0 ); ++i )
+    {
+      for( INDEX_TYPE j = 0; j < NUM_COMPONENTS; ++j )
+      {
+        view( i, j ) = field * i - j;
+      }
+    }
+
+    sum += view( view.size( 0 ) - 1, NUM_COMPONENTS - 1 );
+  }
+
+  if( rollback )
+  {
+    for( INDEX_TYPE field = 0; field < NUM_FIELDS; ++field )
+    {
+      fields[ field ] = snapshot[ field ];
+    }
+  }
+
+  return sum;
+}
+
+template void Snapshot::snapshot< MallocBuffer >();
+template void Snapshot::snapshot< CopyOnWriteBuffer >();
+template void Snapshot::rollback< MallocBuffer >();
+template void Snapshot::rollback< CopyOnWriteBuffer >();
+
+} // namespace benchmarking
+} // namespace LvArray
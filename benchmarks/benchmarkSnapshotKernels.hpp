@@ -0,0 +1,119 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+#pragma once
+
+// Source includes
+#include "benchmarkHelpers.hpp"
+#include "MallocBuffer.hpp"
+#include "CopyOnWriteBuffer.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+// System includes
+#include <vector>
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+using VALUE_TYPE = double;
+
+/// The number of fields that make up the state.
+constexpr INDEX_TYPE NUM_FIELDS = 8;
+
+/// The number of components of each field.
+constexpr INDEX_TYPE NUM_COMPONENTS = 3;
+
+template< template< typename > class BUFFER_TYPE >
+using Array2dT = LvArray::Array< VALUE_TYPE, 2, RAJA::PERM_IJ, INDEX_TYPE, BUFFER_TYPE >;
+
+#define TIMING_LOOP( KERNEL ) \
+  for( auto _ : m_state ) \
+  { \
+    LVARRAY_UNUSED_VARIABLE( _ ); \
+    m_sum += KERNEL; \
+    ::benchmark::DoNotOptimize( m_sum ); \
+    ::benchmark::ClobberMemory(); \
+  } \
+
+/**
+ * @class Snapshot
+ * @brief Times taking a snapshot of a state made of NUM_FIELDS fields, writing to some of the fields
+ *   and optionally rolling the state back. With a MallocBuffer every snapshot and rollback copies every
+ *   field, with a CopyOnWriteBuffer only the fields that are written to are copied.
+ */
+class Snapshot
+{
+public:
+
+  Snapshot( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 2 > & results ):
+    m_state( state ),
+    m_callingFunction( callingFunction ),
+    m_results( results ),
+    m_numValues( state.range( 0 ) ),
+    m_numWritten( state.range( 1 ) ),
+    m_sum( 0 )
+  {}
+
+  ~Snapshot()
+  {
+    registerResult( m_results, { m_numValues, m_numWritten }, m_sum / INDEX_TYPE( m_state.iterations() ), m_callingFunction );
+    m_state.counters[ "Values snapshotted" ] = ::benchmark::Counter( NUM_FIELDS * NUM_COMPONENTS * m_numValues,
+                                                                     ::benchmark::Counter::kIsIterationInvariantRate,
+                                                                     ::benchmark::Counter::OneK::kIs1000 );
+  }
+
+  template< template< typename > class BUFFER_TYPE >
+  void snapshot()
+  {
+    std::vector< Array2dT< BUFFER_TYPE > > fields = createFields< BUFFER_TYPE >( m_numValues );
+    TIMING_LOOP( snapshotKernel( fields, m_numWritten, false ) );
+  }
+
+  template< template< typename > class BUFFER_TYPE >
+  void rollback()
+  {
+    std::vector< Array2dT< BUFFER_TYPE > > fields = createFields< BUFFER_TYPE >( m_numValues );
+    TIMING_LOOP( snapshotKernel( fields, m_numWritten, true ) );
+  }
+
+private:
+
+  template< template< typename > class BUFFER_TYPE >
+  static std::vector< Array2dT< BUFFER_TYPE > > createFields( INDEX_TYPE const numValues );
+
+  template< template< typename > class BUFFER_TYPE >
+  static VALUE_TYPE snapshotKernel( std::vector< Array2dT< BUFFER_TYPE > > & fields,
+                                    INDEX_TYPE const numWritten,
+                                    bool const rollback );
+
+  ::benchmark::State & m_state;
+  std::string const m_callingFunction;
+  ResultsMap< VALUE_TYPE, 2 > & m_results;
+  INDEX_TYPE const m_numValues;
+  INDEX_TYPE const m_numWritten;
+  VALUE_TYPE m_sum = 0;
+};
+
+#undef TIMING_LOOP
+
+} // namespace benchmarking
+} // namespace LvArray
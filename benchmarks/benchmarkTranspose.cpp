@@ -0,0 +1,101 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkTransposeKernels.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+ResultsMap< VALUE_TYPE, 3 > resultsMap;
+
+template< typename POLICY >
+void serial( benchmark::State & state )
+{
+  Transpose< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.serial();
+}
+
+template< typename POLICY >
+void elemToNode( benchmark::State & state )
+{
+  Transpose< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.elemToNode();
+}
+
+template< typename POLICY >
+void elemToNodeSets( benchmark::State & state )
+{
+  Transpose< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.elemToNodeSets();
+}
+
+template< typename POLICY >
+void nodeToElem( benchmark::State & state )
+{
+  Transpose< POLICY > kernels( state, __PRETTY_FUNCTION__, resultsMap );
+  kernels.nodeToElem();
+}
+
+INDEX_TYPE const SIZE = 100;
+
+void registerBenchmarks()
+{
+  REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE, SIZE, SIZE } ), serial, serialPolicy );
+
+  forEachArg( []( auto policy )
+  {
+    using POLICY = decltype( policy );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE, SIZE, SIZE } ), elemToNode, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE, SIZE, SIZE } ), elemToNodeSets, POLICY );
+    REGISTER_BENCHMARK_TEMPLATE( WRAP( { SIZE, SIZE, SIZE } ), nodeToElem, POLICY );
+  },
+              serialPolicy {}
+  #if defined(USE_OPENMP)
+              , parallelHostPolicy {}
+  #endif
+              );
+}
+
+} // namespace benchmarking
+} // namespace LvArray
+
+int main( int argc, char * * argv )
+{
+  LvArray::benchmarking::registerBenchmarks();
+  ::benchmark::Initialize( &argc, argv );
+  if( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+  {
+    return 1;
+  }
+
+  LVARRAY_LOG( "INDEX_TYPE = " << LvArray::demangleType< LvArray::benchmarking::INDEX_TYPE >() );
+
+  LVARRAY_LOG( "Maps of a " << LvArray::benchmarking::SIZE << " x " << LvArray::benchmarking::SIZE << " x " <<
+               LvArray::benchmarking::SIZE << " hexahedral mesh." );
+
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  return LvArray::benchmarking::verifyResults( LvArray::benchmarking::resultsMap );
+}
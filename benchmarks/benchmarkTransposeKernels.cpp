@@ -0,0 +1,107 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "benchmarkTransposeKernels.hpp"
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+/**
+ * @brief @return The number of entries in @p map plus the sum of i * map[ i ][ j ].
+ * @tparam ARRAY The type of the map, either an ArrayOfArraysT or an ArrayOfSetsT.
+ * @param map The map that was built.
+ * @details The result is the same for a map and its transpose.
+ */
+template< typename ARRAY >
+VALUE_TYPE checksum( ARRAY const & map )
+{
+  VALUE_TYPE sum = 0;
+  for( INDEX_TYPE i = 0; i < map.size(); ++i )
+  {
+    for( INDEX_TYPE const j : map[ i ] )
+    { sum += i * j + 1; }
+  }
+
+  return sum;
+}
+
+template< typename POLICY >
+VALUE_TYPE Transpose< POLICY >::
+serialKernel( INDEX_TYPE const numNodes,
+              ArrayView< INDEX_TYPE const, ELEM_TO_NODE_PERM > const & elemToNodeMap )
+{
+  std::vector< INDEX_TYPE > elemsPerNode( numNodes, 0 );
+  for( INDEX_TYPE elemID = 0; elemID < elemToNodeMap.size( 0 ); ++elemID )
+  {
+    for( INDEX_TYPE localNode = 0; localNode < elemToNodeMap.size( 1 ); ++localNode )
+    { ++elemsPerNode[ elemToNodeMap( elemID, localNode ) ]; }
+  }
+
+  ArrayOfArraysT< INDEX_TYPE > nodeToElemMap;
+  nodeToElemMap.template resizeFromCapacities< serialPolicy >( numNodes, elemsPerNode.data() );
+
+  for( INDEX_TYPE elemID = 0; elemID < elemToNodeMap.size( 0 ); ++elemID )
+  {
+    for( INDEX_TYPE localNode = 0; localNode < elemToNodeMap.size( 1 ); ++localNode )
+    { nodeToElemMap.emplaceBack( elemToNodeMap( elemID, localNode ), elemID ); }
+  }
+
+  return checksum( nodeToElemMap );
+}
+
+template< typename POLICY >
+VALUE_TYPE Transpose< POLICY >::
+elemToNodeKernel( INDEX_TYPE const numNodes,
+                  ArrayView< INDEX_TYPE const, ELEM_TO_NODE_PERM > const & elemToNodeMap )
+{
+  ArrayOfArraysT< INDEX_TYPE > nodeToElemMap;
+  transpose< POLICY, typename RAJAHelper< POLICY >::AtomicPolicy >( elemToNodeMap.toSliceConst(), numNodes, nodeToElemMap );
+  return checksum( nodeToElemMap );
+}
+
+template< typename POLICY >
+VALUE_TYPE Transpose< POLICY >::
+elemToNodeSetsKernel( INDEX_TYPE const numNodes,
+                      ArrayView< INDEX_TYPE const, ELEM_TO_NODE_PERM > const & elemToNodeMap )
+{
+  ArrayOfSetsT< INDEX_TYPE > nodeToElemMap;
+  transpose< POLICY, typename RAJAHelper< POLICY >::AtomicPolicy >( elemToNodeMap.toSliceConst(), numNodes, nodeToElemMap );
+  return checksum( nodeToElemMap );
+}
+
+template< typename POLICY >
+VALUE_TYPE Transpose< POLICY >::
+nodeToElemKernel( INDEX_TYPE const numElems,
+                  ArrayOfArraysViewT< INDEX_TYPE const, true > const & nodeToElemMap )
+{
+  ArrayOfArraysT< INDEX_TYPE > elemToNodeMap;
+  transpose< POLICY, typename RAJAHelper< POLICY >::AtomicPolicy >( nodeToElemMap, numElems, elemToNodeMap );
+  return checksum( elemToNodeMap );
+}
+
+template class Transpose< serialPolicy >;
+
+#if defined(USE_OPENMP)
+template class Transpose< parallelHostPolicy >;
+#endif
+
+} // namespace benchmarking
+} // namespace LvArray
@@ -0,0 +1,109 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "benchmarkSparsityGenerationKernels.hpp"
+#include "ArrayOfSets.hpp"
+#include "transpose.hpp"
+
+// TPL includes
+#include <benchmark/benchmark.h>
+
+namespace LvArray
+{
+namespace benchmarking
+{
+
+using VALUE_TYPE = INDEX_TYPE;
+
+template< typename T >
+using ArrayOfSetsT = ArrayOfSets< T, INDEX_TYPE, DEFAULT_BUFFER >;
+
+#define TIMING_LOOP( KERNEL ) \
+  for( auto _ : m_state ) \
+  { \
+    LVARRAY_UNUSED_VARIABLE( _ ); \
+    m_sum += KERNEL; \
+    ::benchmark::DoNotOptimize( m_sum ); \
+    ::benchmark::ClobberMemory(); \
+  } \
+
+/**
+ * @class Transpose
+ * @brief Times inverting the maps of the structured hexahedral mesh used by the sparsity generation benchmarks.
+ *   The serial version builds the node to element map with a count, a resize and an append in a single loop
+ *   over the elements, the others use transpose< POLICY > to build the node to element map from the element
+ *   to node map or the element to node map from the node to element map.
+ */
+template< typename POLICY >
+class Transpose : public SparsityGenerationNative
+{
+public:
+
+  Transpose( ::benchmark::State & state, char const * const callingFunction, ResultsMap< VALUE_TYPE, 3 > & results ):
+    SparsityGenerationNative( state, false ),
+    m_callingFunction( callingFunction ),
+    m_results( results ),
+    m_sum( 0 )
+  {}
+
+  ~Transpose()
+  {
+    registerResult( m_results, { m_numElemsX, m_numElemsY, m_numElemsZ },
+                    m_sum / INDEX_TYPE( m_state.iterations() ), m_callingFunction );
+    m_state.counters[ "Entries" ] = ::benchmark::Counter( m_elemToNodeMap.size(),
+                                                          ::benchmark::Counter::kIsIterationInvariantRate,
+                                                          ::benchmark::Counter::OneK::kIs1000 );
+  }
+
+  void serial()
+  { TIMING_LOOP( serialKernel( m_numNodes, m_elemToNodeMap.toViewConst() ) ); }
+
+  void elemToNode()
+  { TIMING_LOOP( elemToNodeKernel( m_numNodes, m_elemToNodeMap.toViewConst() ) ); }
+
+  void elemToNodeSets()
+  { TIMING_LOOP( elemToNodeSetsKernel( m_numNodes, m_elemToNodeMap.toViewConst() ) ); }
+
+  void nodeToElem()
+  { TIMING_LOOP( nodeToElemKernel( m_numElems, m_nodeToElemMap.toViewConst() ) ); }
+
+private:
+
+  static VALUE_TYPE serialKernel( INDEX_TYPE const numNodes,
+                                  ArrayView< INDEX_TYPE const, ELEM_TO_NODE_PERM > const & elemToNodeMap );
+
+  static VALUE_TYPE elemToNodeKernel( INDEX_TYPE const numNodes,
+                                      ArrayView< INDEX_TYPE const, ELEM_TO_NODE_PERM > const & elemToNodeMap );
+
+  static VALUE_TYPE elemToNodeSetsKernel( INDEX_TYPE const numNodes,
+                                          ArrayView< INDEX_TYPE const, ELEM_TO_NODE_PERM > const & elemToNodeMap );
+
+  static VALUE_TYPE nodeToElemKernel( INDEX_TYPE const numElems,
+                                      ArrayOfArraysViewT< INDEX_TYPE const, true > const & nodeToElemMap );
+
+  std::string const m_callingFunction;
+  ResultsMap< VALUE_TYPE, 3 > & m_results;
+  VALUE_TYPE m_sum = 0;
+};
+
+#undef TIMING_LOOP
+
+} // namespace benchmarking
+} // namespace LvArray
@@ -0,0 +1,306 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "LvArrayConfig.hpp"
+#include "Macros.hpp"
+#include "bufferManipulation.hpp"
+#include "AllocationRegistry.hpp"
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+
+namespace LvArray
+{
+
+/// The size of a transparent huge page on x86-64 and most aarch64 Linux systems.
+constexpr std::size_t HUGE_PAGE_SIZE = std::size_t( 1 ) << 21;
+
+namespace internal
+{
+
+/**
+ * @brief @return A reference to the minimum allocation size in bytes for which huge pages are requested.
+ */
+inline std::atomic< std::size_t > & hugePageThreshold()
+{
+  static std::atomic< std::size_t > threshold( 0 );
+  return threshold;
+}
+
+} // namespace internal
+
+/**
+ * @brief Request transparent huge pages for AlignedBuffer allocations of at least @p threshold bytes.
+ * @param threshold The minimum size of an allocation that will be backed by huge pages.
+ * @details These allocations are aligned to HUGE_PAGE_SIZE and marked with madvise( MADV_HUGEPAGE ).
+ *   This reduces TLB misses when streaming through large arrays. This is a no-op on systems without
+ *   MADV_HUGEPAGE.
+ */
+inline void enableHugePages( std::size_t const threshold=HUGE_PAGE_SIZE )
+{ internal::hugePageThreshold() = std::max( threshold, std::size_t( 1 ) ); }
+
+/**
+ * @brief Stop requesting huge pages for AlignedBuffer allocations, this is the default.
+ */
+inline void disableHugePages()
+{ internal::hugePageThreshold() = 0; }
+
+/**
+ * @class AlignedBuffer
+ * @brief Implements the Buffer interface using allocations aligned to @p ALIGN bytes.
+ * @tparam T type of data that is contained in the buffer.
+ * @tparam ALIGN The alignment in bytes, must be a power of two and a multiple of sizeof( void * ).
+ * @details Apart from the alignment this behaves like MallocBuffer: both the copy constructor and
+ *   copy assignment constructor perform a shallow copy of the source, the destructor does not
+ *   free the allocation and the allocations of a named buffer are accounted for by the allocation registry. The alignment is published through the alignment member so that
+ *   ArrayView::alignedData can pass it on to the compiler. Since the template takes two parameters
+ *   use an alias such as CacheLineAlignedBuffer as the BUFFER_TYPE of a container.
+ * @note The parent class bufferManipulation::VoidBuffer provides the default execution space related methods.
+ */
+template< typename T, std::size_t ALIGN >
+class AlignedBuffer : public bufferManipulation::VoidBuffer
+{
+public:
+  static_assert( ALIGN != 0 && ( ALIGN & ( ALIGN - 1 ) ) == 0, "ALIGN must be a power of two." );
+  static_assert( ALIGN % sizeof( void * ) == 0, "ALIGN must be a multiple of sizeof( void * )." );
+  static_assert( ALIGN >= alignof( T ), "ALIGN must be at least alignof( T )." );
+
+  /// Alias used in the bufferManipulation functions.
+  using value_type = T;
+
+  /// Signifies that the AlignedBuffer's copy semantics are shallow.
+  static constexpr bool hasShallowCopy = true;
+
+  /// The alignment of the allocation in bytes.
+  static constexpr std::size_t alignment = ALIGN;
+
+  /**
+   * @brief Constructor for creating an empty or uninitialized buffer.
+   * @note An uninitialized AlignedBuffer is equivalent to an empty AlignedBuffer and does
+   *   not need to be free'd.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  AlignedBuffer( bool=true ):
+    m_data( nullptr ),
+    m_capacity( 0 ),
+    m_registration()
+  {}
+
+  /**
+   * @brief Copy constructor, creates a shallow copy.
+   */
+  AlignedBuffer( AlignedBuffer const & ) = default;
+
+  /**
+   * @brief Sized copy constructor, creates a shallow copy.
+   * @param src The buffer to be coppied.
+   */
+  AlignedBuffer( AlignedBuffer const & src, std::ptrdiff_t ):
+    AlignedBuffer( src )
+  {}
+
+  /**
+   * @brief Move constructor, creates a shallow copy.
+   * @param src The buffer to be moved from, is empty after the move.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  AlignedBuffer( AlignedBuffer && src ):
+    m_data( src.m_data ),
+    m_capacity( src.m_capacity ),
+    m_registration( src.m_registration )
+  {
+    src.m_capacity = 0;
+    src.m_data = nullptr;
+    src.m_registration = allocationRegistry::Registration();
+  }
+
+  /**
+   * @brief Copy assignment operator, creates a shallow copy.
+   * @param src The buffer to be copied.
+   * @return *this.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  AlignedBuffer & operator=( AlignedBuffer const & src )
+  {
+    m_capacity = src.m_capacity;
+    m_data = src.m_data;
+    m_registration = src.m_registration;
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator, creates a shallow copy.
+   * @param src The buffer to be moved from, is empty after the move.
+   * @return *this.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  AlignedBuffer & operator=( AlignedBuffer && src )
+  {
+    m_capacity = src.m_capacity;
+    m_data = src.m_data;
+    m_registration = src.m_registration;
+    src.m_capacity = 0;
+    src.m_data = nullptr;
+    src.m_registration = allocationRegistry::Registration();
+    return *this;
+  }
+
+  /**
+   * @brief Reallocate the buffer to the new capacity.
+   * @param size The number of values that are initialized in the buffer.
+   * @param newCapacity The new capacity of the buffer.
+   */
+  void reallocate( std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+  {
+    T * const newPtr = allocate( newCapacity );
+
+    std::ptrdiff_t const overlapAmount = std::min( newCapacity, size );
+    arrayManipulation::uninitializedRelocate( newPtr, overlapAmount, m_data );
+    arrayManipulation::destroy( m_data + overlapAmount, size - overlapAmount );
+
+    m_registration.reallocate( m_capacity * sizeof( T ), newCapacity * sizeof( T ), overlapAmount * sizeof( T ) );
+    std::free( m_data );
+    m_capacity = newCapacity;
+    m_data = newPtr;
+  }
+
+  /**
+   * @brief Free the data in the buffer but does not destroy any values.
+   * @note To destroy the values and free the data call bufferManipulation::free.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void free()
+  {
+#if !defined(__CUDA_ARCH__)
+    m_registration.reallocate( m_capacity * sizeof( T ), 0, 0 );
+    m_registration.setSize( 0 );
+#endif
+    std::free( m_data );
+    m_capacity = 0;
+    m_data = nullptr;
+  }
+
+  /**
+   * @tparam The type of the owning object.
+   * @brief Set the name associated with this buffer, used to account for its allocations.
+   * @param name the name of the buffer.
+   */
+  template< typename=VoidBuffer >
+  void setName( std::string const & name )
+  { m_registration.setName( name, m_capacity * sizeof( T ) ); }
+
+  /**
+   * @brief Set the number of values in the buffer, used to account for the bytes in use.
+   * @param size The number of values in the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void registerSize( std::ptrdiff_t const size )
+  {
+#if !defined(__CUDA_ARCH__)
+    m_registration.setSize( size * sizeof( T ) );
+#else
+    LVARRAY_UNUSED_VARIABLE( size );
+#endif
+  }
+
+  /**
+   * @brief @return Return the capacity of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  std::ptrdiff_t capacity() const
+  { return m_capacity; }
+
+  /**
+   * @brief @return Return a pointer to the beginning of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  T * data() const
+  { return m_data; }
+
+  /**
+   * @tparam INDEX_TYPE the type used to index into the values.
+   * @brief @return The value at position @p i .
+   * @param i The position of the value to access.
+   * @note No bounds checks are performed.
+   */
+  template< typename INDEX_TYPE >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T & operator[]( INDEX_TYPE const i ) const
+  { return m_data[ i ]; }
+
+private:
+
+  /**
+   * @brief @return A new uninitialized allocation of @p capacity values.
+   * @param capacity The number of values to allocate space for.
+   */
+  static T * allocate( std::ptrdiff_t const capacity )
+  {
+    if( capacity == 0 )
+    { return nullptr; }
+
+    std::size_t const bytes = capacity * sizeof( T );
+    std::size_t const threshold = internal::hugePageThreshold();
+    bool const useHugePages = threshold != 0 && bytes >= threshold;
+    std::size_t const allocationAlignment = useHugePages ? std::max( ALIGN, HUGE_PAGE_SIZE ) : ALIGN;
+
+    void * ptr = nullptr;
+    int const error = posix_memalign( &ptr, allocationAlignment, bytes );
+    LVARRAY_ERROR_IF( error != 0, "Failed to allocate " << bytes << " bytes aligned to " << allocationAlignment << "." );
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // This is only advice, if the kernel doesn't support it the allocation is still valid.
+    if( useHugePages )
+    { madvise( ptr, bytes, MADV_HUGEPAGE ); }
+#endif
+
+    return static_cast< T * >( ptr );
+  }
+
+  /// A pointer to the data.
+  T * LVARRAY_RESTRICT m_data = nullptr;
+
+  /// The size of the allocation.
+  std::ptrdiff_t m_capacity = 0;
+
+  /// The registration of the buffer in the allocation registry.
+  allocationRegistry::Registration m_registration;
+};
+
+/// The size of a cache line in bytes, this is also the width of an AVX-512 vector.
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @tparam T type of data that is contained in the buffer.
+ * @brief An AlignedBuffer aligned to a cache line that can be used as the BUFFER_TYPE of a container.
+ */
+template< typename T >
+using CacheLineAlignedBuffer = AlignedBuffer< T, CACHE_LINE_SIZE >;
+
+} // namespace LvArray
@@ -0,0 +1,316 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+// Source includes
+#include "AllocationRegistry.hpp"
+#include "Macros.hpp"
+#include "StringUtilities.hpp"
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace LvArray
+{
+namespace allocationRegistry
+{
+namespace internal
+{
+
+/**
+ * @class Registry
+ * @brief The records of all the names, access is serialized with a mutex.
+ * @details The id of a name is one plus the position of its record in m_records, records are never
+ *   removed so that ids held by buffers remain valid.
+ */
+class Registry
+{
+public:
+
+  /**
+   * @brief @return The id of @p name, the record is created if it doesn't exist.
+   * @param name The name to look up.
+   * @note The lock must be held.
+   */
+  int getId( std::string const & name )
+  {
+    auto const result = m_ids.emplace( name, int( m_records.size() + 1 ) );
+    if( result.second )
+    {
+      m_records.emplace_back();
+      m_records.back().name = name;
+    }
+
+    return result.first->second;
+  }
+
+  /**
+   * @brief @return The record associated with @p id.
+   * @param id The id of the record, must not be zero.
+   * @note The lock must be held.
+   */
+  Record & getRecord( int const id )
+  {
+    LVARRAY_ASSERT_GT( id, 0 );
+    LVARRAY_ASSERT_GE( m_records.size(), std::size_t( id ) );
+    return m_records[ id - 1 ];
+  }
+
+  /// Whether or not new buffers are registered.
+  std::atomic< bool > m_enabled{ false };
+
+  /// The lock which guards the records.
+  std::mutex m_lock;
+
+  /// The id of each name.
+  std::unordered_map< std::string, int > m_ids;
+
+  /// The records indexed by id - 1.
+  std::vector< Record > m_records;
+};
+
+/**
+ * @brief @return The registry shared by all threads.
+ * @details The registry is intentionally leaked so that it outlives buffers freed during static destruction.
+ */
+Registry & getRegistry()
+{
+  static Registry * const registry = new Registry();
+  return *registry;
+}
+
+/**
+ * @brief Add @p bytes to the current allocation of @p record.
+ * @param record The record to update.
+ * @param bytes The number of bytes to add.
+ */
+void addBytes( Record & record, std::size_t const bytes )
+{
+  record.capacityBytes += bytes;
+  record.peakBytes = std::max( record.peakBytes, record.capacityBytes );
+}
+
+/**
+ * @brief Remove @p bytes from the current allocation of @p record.
+ * @param record The record to update.
+ * @param bytes The number of bytes to remove.
+ */
+void removeBytes( Record & record, std::size_t const bytes )
+{
+  LVARRAY_ASSERT_GE( record.capacityBytes, bytes );
+  record.capacityBytes -= std::min( record.capacityBytes, bytes );
+}
+
+/**
+ * @brief Change the number of bytes in use of @p record from @p oldBytes to @p newBytes.
+ * @param record The record to update.
+ * @param oldBytes The number of bytes previously in use.
+ * @param newBytes The number of bytes now in use.
+ */
+void changeSize( Record & record, std::size_t const oldBytes, std::size_t const newBytes )
+{
+  LVARRAY_ASSERT_GE( record.currentBytes, oldBytes );
+  record.currentBytes = record.currentBytes - std::min( record.currentBytes, oldBytes ) + newBytes;
+}
+
+} // namespace internal
+
+///////////////////////////////////////////////////////////////////////////////
+void enable()
+{ internal::getRegistry().m_enabled = true; }
+
+///////////////////////////////////////////////////////////////////////////////
+void disable()
+{ internal::getRegistry().m_enabled = false; }
+
+///////////////////////////////////////////////////////////////////////////////
+bool isEnabled()
+{ return internal::getRegistry().m_enabled; }
+
+///////////////////////////////////////////////////////////////////////////////
+int registerBuffer( int const id,
+                    std::string const & name,
+                    std::size_t const capacityBytes,
+                    std::size_t const sizeBytes )
+{
+  internal::Registry & registry = internal::getRegistry();
+  if( id == 0 && !registry.m_enabled )
+  { return 0; }
+
+  std::lock_guard< std::mutex > lock( registry.m_lock );
+  int const newId = registry.getId( name );
+  if( newId == id )
+  { return newId; }
+
+  Record & newRecord = registry.getRecord( newId );
+  internal::changeSize( newRecord, 0, sizeBytes );
+
+  if( id != 0 )
+  {
+    internal::changeSize( registry.getRecord( id ), sizeBytes, 0 );
+  }
+
+  if( capacityBytes == 0 )
+  { return newId; }
+
+  if( id != 0 )
+  {
+    Record & oldRecord = registry.getRecord( id );
+    internal::removeBytes( oldRecord, capacityBytes );
+    --oldRecord.numAllocations;
+  }
+
+  internal::addBytes( newRecord, capacityBytes );
+  ++newRecord.numAllocations;
+
+  return newId;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void recordReallocation( int const id,
+                         std::size_t const oldBytes,
+                         std::size_t const newBytes,
+                         std::size_t const movedBytes )
+{
+  if( id == 0 || ( oldBytes == 0 && newBytes == 0 ) )
+  { return; }
+
+  internal::Registry & registry = internal::getRegistry();
+  std::lock_guard< std::mutex > lock( registry.m_lock );
+  Record & record = registry.getRecord( id );
+
+  if( oldBytes == 0 )
+  {
+    ++record.numAllocations;
+  }
+  else if( newBytes == 0 )
+  {
+    LVARRAY_ASSERT_GT( record.numAllocations, 0 );
+    --record.numAllocations;
+  }
+  else
+  {
+    ++record.numReallocations;
+    record.bytesMoved += movedBytes;
+  }
+
+  if( newBytes > oldBytes )
+  {
+    internal::addBytes( record, newBytes - oldBytes );
+  }
+  else
+  {
+    internal::removeBytes( record, oldBytes - newBytes );
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void recordSize( int const id, std::size_t const oldBytes, std::size_t const newBytes )
+{
+  if( id == 0 || ( oldBytes == 0 && newBytes == 0 ) )
+  { return; }
+
+  internal::Registry & registry = internal::getRegistry();
+  std::lock_guard< std::mutex > lock( registry.m_lock );
+  internal::changeSize( registry.getRecord( id ), oldBytes, newBytes );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+Record getRecord( std::string const & name )
+{
+  internal::Registry & registry = internal::getRegistry();
+  std::lock_guard< std::mutex > lock( registry.m_lock );
+
+  auto const iter = registry.m_ids.find( name );
+  if( iter == registry.m_ids.end() )
+  {
+    Record record;
+    record.name = name;
+    return record;
+  }
+
+  return registry.getRecord( iter->second );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector< Record > getRecords()
+{
+  std::vector< Record > records;
+
+  {
+    internal::Registry & registry = internal::getRegistry();
+    std::lock_guard< std::mutex > lock( registry.m_lock );
+    records = registry.m_records;
+  }
+
+  std::stable_sort( records.begin(), records.end(), [] ( Record const & lhs, Record const & rhs )
+  {
+    return lhs.peakBytes > rhs.peakBytes;
+  } );
+
+  return records;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string report( std::size_t const maxRecords )
+{
+  std::vector< Record > const records = getRecords();
+
+  std::ostringstream oss;
+  oss << std::setw( 10 ) << "current" << std::setw( 10 ) << "capacity" << std::setw( 10 ) << "peak"
+      << std::setw( 10 ) << "moved" << std::setw( 8 ) << "allocs" << std::setw( 10 ) << "reallocs" << "  name\n";
+
+  for( std::size_t i = 0; i < std::min( maxRecords, records.size() ); ++i )
+  {
+    Record const & record = records[ i ];
+    oss << std::setw( 10 ) << calculateSize( record.currentBytes )
+        << std::setw( 10 ) << calculateSize( record.capacityBytes )
+        << std::setw( 10 ) << calculateSize( record.peakBytes )
+        << std::setw( 10 ) << calculateSize( record.bytesMoved )
+        << std::setw( 8 ) << record.numAllocations
+        << std::setw( 10 ) << record.numReallocations
+        << "  " << ( record.name.empty() ? "<unnamed>" : record.name ) << "\n";
+  }
+
+  if( records.size() > maxRecords )
+  {
+    oss << "... and " << records.size() - maxRecords << " more\n";
+  }
+
+  return oss.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void reset()
+{
+  internal::Registry & registry = internal::getRegistry();
+  std::lock_guard< std::mutex > lock( registry.m_lock );
+
+  for( Record & record : registry.m_records )
+  {
+    record.peakBytes = record.capacityBytes;
+    record.numReallocations = 0;
+    record.bytesMoved = 0;
+  }
+}
+
+} // namespace allocationRegistry
+} // namespace LvArray
@@ -0,0 +1,208 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+/**
+ * @file AllocationRegistry.hpp
+ * This file contains an optional registry which accounts for the allocations of the buffers
+ * by the name given to them with setName. It answers which named containers dominate the memory
+ * and how often they reallocate without depending on Umpire or CHAI. When the registry is disabled,
+ * which is the default, buffers are not registered and the only cost is a branch per allocation.
+ * All buffers given the same name are accounted for together. MallocBuffer, PoolBuffer, AlignedBuffer,
+ * MmapBuffer, SmallBuffer and CopyOnWriteBuffer support the registry, naming any other buffer is not
+ * accounted for.
+ */
+
+#pragma once
+
+// System includes
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace LvArray
+{
+namespace allocationRegistry
+{
+
+/**
+ * @struct Record
+ * @brief The allocation statistics of all the buffers with a given name.
+ */
+struct Record
+{
+  /// The name of the buffers.
+  std::string name;
+
+  /// The number of buffers with this name that currently hold an allocation.
+  std::size_t numAllocations = 0;
+
+  /// The number of bytes currently in use, this is the size of the buffers times the size of a value.
+  std::size_t currentBytes = 0;
+
+  /// The number of bytes currently allocated.
+  std::size_t capacityBytes = 0;
+
+  /// The largest value of capacityBytes.
+  std::size_t peakBytes = 0;
+
+  /// The number of times an existing allocation was resized.
+  std::size_t numReallocations = 0;
+
+  /// The number of bytes copied from an old allocation to a new one during a reallocation.
+  std::size_t bytesMoved = 0;
+};
+
+/**
+ * @brief Start registering buffers when they are named.
+ * @note Buffers named before the registry was enabled are not tracked.
+ */
+void enable();
+
+/**
+ * @brief Stop registering buffers when they are named, this is the default.
+ * @note Buffers that are already registered continue to be tracked so that their records stay consistent.
+ */
+void disable();
+
+/**
+ * @brief @return True iff the registry is enabled.
+ */
+bool isEnabled();
+
+/**
+ * @brief Register a buffer under @p name.
+ * @param id The current id of the buffer, zero if it isn't registered.
+ * @param name The new name of the buffer.
+ * @param capacityBytes The number of bytes currently allocated by the buffer.
+ * @param sizeBytes The number of bytes currently in use by the buffer.
+ * @return The new id of the buffer, zero if the registry is disabled.
+ * @details The current allocation and usage of the buffer are moved from its old record to the new one.
+ */
+int registerBuffer( int const id,
+                    std::string const & name,
+                    std::size_t const capacityBytes,
+                    std::size_t const sizeBytes );
+
+/**
+ * @brief Record that a registered buffer replaced its allocation.
+ * @param id The id of the buffer, if zero this is a no-op.
+ * @param oldBytes The size of the old allocation, zero if there wasn't one.
+ * @param newBytes The size of the new allocation, zero if the buffer was freed.
+ * @param movedBytes The number of bytes copied from the old allocation to the new one.
+ * @note The new allocation may be the same size as the old one, for instance when both round up to a page.
+ */
+void recordReallocation( int const id,
+                         std::size_t const oldBytes,
+                         std::size_t const newBytes,
+                         std::size_t const movedBytes );
+
+/**
+ * @brief Record that a registered buffer changed the number of bytes it uses.
+ * @param id The id of the buffer, if zero this is a no-op.
+ * @param oldBytes The number of bytes previously in use.
+ * @param newBytes The number of bytes now in use.
+ */
+void recordSize( int const id, std::size_t const oldBytes, std::size_t const newBytes );
+
+/**
+ * @brief @return The record of the buffers named @p name, it is empty if there are no such buffers.
+ * @param name The name to query.
+ */
+Record getRecord( std::string const & name );
+
+/**
+ * @brief @return The records of all the names, sorted by decreasing peakBytes.
+ */
+std::vector< Record > getRecords();
+
+/**
+ * @brief @return A table of the records with the largest peak memory use.
+ * @param maxRecords The maximum number of records to include.
+ */
+std::string report( std::size_t const maxRecords=20 );
+
+/**
+ * @brief Reset the peak memory use, the reallocation counts and the bytes moved of every record.
+ * @details The current allocations are kept, so the peak memory use becomes the current capacity.
+ */
+void reset();
+
+/**
+ * @class Registration
+ * @brief The registration of a single buffer, the buffers which support the registry hold one.
+ * @details The buffer reports the size of its allocation while the registration keeps track of the
+ *   number of bytes in use, which the buffer updates through its registerSize method, see
+ *   bufferManipulation::registerSize. The registration is copied along with shallow copies of the buffer.
+ * @note None of the methods may be called on device.
+ */
+class Registration
+{
+public:
+
+  /**
+   * @brief Register the buffer under @p name, see registerBuffer.
+   * @param name The new name of the buffer.
+   * @param capacityBytes The number of bytes currently allocated by the buffer.
+   */
+  void setName( std::string const & name, std::size_t const capacityBytes )
+  { m_id = registerBuffer( m_id, name, capacityBytes, m_sizeBytes ); }
+
+  /**
+   * @brief Record that the buffer replaced its allocation, see recordReallocation.
+   * @param oldBytes The size of the old allocation, zero if there wasn't one.
+   * @param newBytes The size of the new allocation, zero if the buffer was freed.
+   * @param movedBytes The number of bytes copied from the old allocation to the new one.
+   */
+  void reallocate( std::size_t const oldBytes, std::size_t const newBytes, std::size_t const movedBytes ) const
+  { recordReallocation( m_id, oldBytes, newBytes, movedBytes ); }
+
+  /**
+   * @brief Set the number of bytes in use by the buffer.
+   * @param sizeBytes The number of bytes in use.
+   * @details The size is kept even if the buffer isn't registered so that it is accounted for
+   *   if the buffer is named later.
+   */
+  void setSize( std::size_t const sizeBytes )
+  {
+    if( m_id != 0 && sizeBytes != m_sizeBytes )
+    { recordSize( m_id, m_sizeBytes, sizeBytes ); }
+
+    m_sizeBytes = sizeBytes;
+  }
+
+  /**
+   * @brief @return The id of the buffer, zero if it isn't registered.
+   */
+  int id() const
+  { return m_id; }
+
+  /**
+   * @brief @return The number of bytes in use by the buffer.
+   */
+  std::size_t sizeBytes() const
+  { return m_sizeBytes; }
+
+private:
+  /// The id of the buffer in the registry, zero if it isn't registered.
+  int m_id = 0;
+
+  /// The number of bytes in use by the buffer.
+  std::size_t m_sizeBytes = 0;
+};
+
+} // namespace allocationRegistry
+} // namespace LvArray
@@ -28,6 +28,7 @@
 #include "ArrayView.hpp"
 #include "bufferManipulation.hpp"
 #include "StackBuffer.hpp"
+#include "SmallBuffer.hpp"
 
 namespace LvArray
 {
@@ -54,17 +55,23 @@ namespace LvArray
  * @tparam INDEX_TYPE the integer to use for indexing.
  * @tparam BUFFER_TYPE A class that defines how to actually allocate memory for the Array. Must take
  *         one template argument that describes the type of the data being stored (T).
+ * @tparam EXTENTS a camp::idx_seq of length NDIM containing the size of each dimension that is known
+ *         at compile time and DYNAMIC_EXTENT for the others. For example Extents< DYNAMIC_EXTENT, 3, 3 >
+ *         describes an array of 3x3 matrices. The strides that only depend on static extents are
+ *         folded into the index calculation (see StaticStrides) and the static extents can't be resized.
  */
 template< typename T,
           int NDIM,
           typename PERMUTATION,
           typename INDEX_TYPE,
-          template< typename > class BUFFER_TYPE >
+          template< typename > class BUFFER_TYPE,
+          typename EXTENTS=DynamicExtents< NDIM > >
 class Array : public ArrayView< T,
                      NDIM,
   getStrideOneDimension( PERMUTATION {} ),
                      INDEX_TYPE,
-                     BUFFER_TYPE >
+                     BUFFER_TYPE,
+                     StaticStrides< PERMUTATION, EXTENTS > >
 {
 public:
 
@@ -73,6 +80,7 @@ public:
   static_assert( isValidPermutation( PERMUTATION {} ), "The permutation must be valid." );
   static_assert( getDimension( PERMUTATION {} ) == NDIM, "The dimension of the permutation must match the dimension of the Array." );
   static_assert( std::is_integral< INDEX_TYPE >::value, "INDEX_TYPE must be integral." );
+  static_assert( isValidExtents( PERMUTATION {}, EXTENTS {} ), "The extents must be valid." );
 
   /// The dimensionality of the array.
   static constexpr int ndim = NDIM;
@@ -80,11 +88,17 @@ public:
   /// The permutation of the array.
   using permutation = PERMUTATION;
 
+  /// The extents of the array.
+  using extents = EXTENTS;
+
   /// The dimension with unit stride.
   static constexpr int USD = getStrideOneDimension( PERMUTATION {} );
 
+  /// The strides that are known at compile time.
+  using STRIDES = StaticStrides< PERMUTATION, EXTENTS >;
+
   /// Alias for the parent class.
-  using ParentClass = ArrayView< T, NDIM, USD, INDEX_TYPE, BUFFER_TYPE >;
+  using ParentClass = ArrayView< T, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES >;
 
   // Aliasing public methods of ArrayView so we don't have to use this->size etc.
   using ParentClass::toSlice;
@@ -95,10 +109,10 @@ public:
   using ParentClass::operator();
 
   /// The type when all nested arrays are converted to const views to mutable values.
-  using ViewType = ArrayView< typename GetViewType< T >::type, NDIM, USD, INDEX_TYPE, BUFFER_TYPE > const;
+  using ViewType = ArrayView< typename GetViewType< T >::type, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES > const;
 
   /// The type when all nested array arrays are converted to views to const values.
-  using ViewTypeConst = ArrayView< typename GetViewTypeConst< T >::type const, NDIM, USD, INDEX_TYPE, BUFFER_TYPE > const;
+  using ViewTypeConst = ArrayView< typename GetViewTypeConst< T >::type const, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES > const;
 
   /**
    * @brief default constructor
@@ -107,6 +121,12 @@ public:
   inline Array():
     ParentClass( true )
   {
+    constexpr CArray< camp::idx_t, NDIM > staticExtents = asArray( EXTENTS {} );
+    for( int i = 0; i < NDIM; ++i )
+    {
+      m_dims[ i ] = staticExtents[ i ] == DYNAMIC_EXTENT ? 0 : staticExtents[ i ];
+    }
+
     CalculateStrides();
 #if !defined(__CUDA_ARCH__)
     setName( "" );
@@ -180,19 +200,32 @@ public:
    * @brief Copy assignment operator, performs a deep copy of rhs.
    * @param rhs Source for the assignment.
    * @return *this.
+   * @note If the buffer supports sharing (see CopyOnWriteBuffer) both arrays share the values read only
+   *   until one of them is resized or touched with move( MemorySpace::CPU ).
    */
   LVARRAY_HOST_DEVICE
   Array & operator=( Array const & rhs )
   {
-    bufferManipulation::copyInto( m_dataBuffer, size(), rhs.m_dataBuffer, rhs.size() );
+    if( !bufferManipulation::share( m_dataBuffer, size(), rhs.m_dataBuffer ) )
+    { bufferManipulation::copyInto( m_dataBuffer, size(), rhs.m_dataBuffer, rhs.size() ); }
 
-    for( int i = 0; i < NDIM; ++i )
-    {
-      m_dims[ i ] = rhs.m_dims[ i ];
-      m_strides[ i ] = rhs.m_strides[ i ];
-    }
+    setDimsEqualTo( rhs );
+    return *this;
+  }
 
-    setSingleParameterResizeIndex( rhs.getSingleParameterResizeIndex() );
+  /**
+   * @tparam POLICY The RAJA policy used to copy the values, should NOT be a device policy.
+   * @brief Perform a deep copy of rhs, copying the values in parallel.
+   * @param rhs Source for the copy.
+   * @return *this.
+   * @details Trivially copyable values are copied in chunks with std::memcpy,
+   *   see bufferManipulation::uninitializedCopy. The copy is never deferred.
+   */
+  template< typename POLICY >
+  Array & copyFrom( Array const & rhs )
+  {
+    bufferManipulation::copyInto< POLICY >( m_dataBuffer, size(), rhs.m_dataBuffer, rhs.size() );
+    setDimsEqualTo( rhs );
     return *this;
   }
 
@@ -270,6 +303,34 @@ public:
     bufferManipulation::resize( m_dataBuffer, oldSize, size() );
   }
 
+  /**
+   * @brief Resize the array, constructing the new values in parallel.
+   * @tparam POLICY The RAJA policy used to construct the new values, should NOT be a device policy.
+   * @tparam DIMS Variadic list of integral types.
+   * @param newDims The new dimensions, must be of length NDIM.
+   * @details Use this instead of resize( DIMS ... ) for large arrays that are later accessed with
+   *   @p POLICY so that each page is placed on the NUMA node of the thread that uses it.
+   * @note This does not preserve the values in the Array unless NDIM == 1.
+   */
+  template< typename POLICY, typename ... DIMS >
+  std::enable_if_t< sizeof ... ( DIMS ) == NDIM && all_of_t< std::is_integral< DIMS > ... >::value >
+  resize( DIMS const ... newDims )
+  {
+    INDEX_TYPE const oldSize = size();
+
+    int curDim = 0;
+    forEachArg( [&curDim, dims=m_dims]( auto const newDim )
+    {
+      dims[ curDim ] = LvArray::integerConversion< INDEX_TYPE >( newDim );
+      LVARRAY_ERROR_IF_LT( dims[ curDim ], 0 );
+      ++curDim;
+    }, newDims ... );
+
+    CalculateStrides();
+
+    bufferManipulation::resize< POLICY >( m_dataBuffer, oldSize, size() );
+  }
+
   /**
    * @brief Resize the array without initializing any new values or destroying any old values.
    *   Only safe on POD data, however it is much faster for large allocations.
@@ -349,6 +410,51 @@ public:
   void resizeDefault( INDEX_TYPE const newdim, T const & defaultValue = T() )
   { resizeDefaultDimension( newdim, defaultValue ); }
 
+  /**
+   * @brief Resize the default dimension of the Array in parallel.
+   * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+   * @param newdim the new size of the default dimension.
+   * @param defaultValue the value to initialize the new values with.
+   * @details If the default dimension is the first dimension in memory this is the same as the parallel
+   *   resize( DIMS ... ). Otherwise the contiguous blocks are relocated in place in parallel batches,
+   *   see resizeDefaultDimensionInBatches.
+   * @note This preserves the values in the Array.
+   * @note The default dimension is given by m_singleParameterResizeIndex.
+   */
+  template< typename POLICY >
+  void resizeDefault( INDEX_TYPE const newdim, T const & defaultValue = T() )
+  {
+    LVARRAY_ERROR_IF_LT( newdim, 0 );
+
+    INDEX_TYPE const curDimLength = m_dims[ m_singleParameterResizeIndex ];
+    INDEX_TYPE const curDimStride = m_strides[ m_singleParameterResizeIndex ];
+    INDEX_TYPE const curSize = size();
+
+    m_dims[ m_singleParameterResizeIndex ] = newdim;
+    CalculateStrides();
+    INDEX_TYPE const newSize = size();
+
+    if( NDIM == 1 || asArray( PERMUTATION {} )[ 0 ] == m_singleParameterResizeIndex )
+    {
+      bufferManipulation::resize< POLICY >( m_dataBuffer, curSize, newSize, defaultValue );
+      return;
+    }
+
+    if( newSize == curSize ) return;
+
+    INDEX_TYPE const numBlocks = ( newdim > curDimLength ) ? newSize / ( curDimStride * newdim ) :
+                                                            curSize / ( curDimStride * curDimLength );
+    if( newSize > curSize )
+    {
+      bufferManipulation::reserve< POLICY >( m_dataBuffer, curSize, newSize );
+    }
+
+    resizeDefaultDimensionInBatches< POLICY >( numBlocks,
+                                               curDimStride * curDimLength,
+                                               curDimStride * newdim,
+                                               defaultValue );
+  }
+
   /**
    * @brief Reserve space in the Array to hold at least the given number of values.
    * @param newCapacity the number of values to reserve space for. After this call
@@ -357,6 +463,45 @@ public:
   void reserve( INDEX_TYPE const newCapacity )
   { bufferManipulation::reserve( m_dataBuffer, size(), newCapacity ); }
 
+  /**
+   * @brief Reserve space in the Array to hold at least the given number of values and
+   *   first touch the new storage in parallel.
+   * @tparam POLICY The RAJA policy used to touch the new storage, should NOT be a device policy.
+   * @param newCapacity the number of values to reserve space for. After this call
+   *        capacity() >= newCapacity.
+   */
+  template< typename POLICY >
+  void reserve( INDEX_TYPE const newCapacity )
+  { bufferManipulation::reserve< POLICY >( m_dataBuffer, size(), newCapacity ); }
+
+  /**
+   * @brief Reserve space in the Array for the default dimension to grow to the given size.
+   * @param newDimCapacity the size of the default dimension to reserve space for.
+   * @details The values stay contiguous so growing a default dimension that isn't the first dimension in memory
+   *   still moves the values, but as long as it stays within the reserved size it is done in place in a single
+   *   pass without reallocating.
+   * @note The default dimension is given by m_singleParameterResizeIndex.
+   */
+  void reserveDefaultDimension( INDEX_TYPE const newDimCapacity )
+  {
+    INDEX_TYPE otherDims = 1;
+    for( int i = 0; i < NDIM; ++i )
+    {
+      if( i != m_singleParameterResizeIndex )
+      {
+        otherDims *= m_dims[ i ];
+      }
+    }
+
+    reserve( otherDims * newDimCapacity );
+  }
+
+  /**
+   * @brief Free all of the capacity beyond size(), useful after clear() or shrinking the Array.
+   */
+  void shrinkToFit()
+  { bufferManipulation::shrinkToFit( m_dataBuffer, size() ); }
+
   /**
    * @brief @return Return the maximum number of values the Array can hold without reallocation.
    */
@@ -378,6 +523,35 @@ public:
     CalculateStrides();
   }
 
+  /**
+   * @tparam DIMS Variadic list of integral types.
+   * @brief Replace the contents of the Array with the values held by @p buffer.
+   * @param buffer The buffer to take ownership of, the first size() values must be initialized.
+   * @param newDims The dimensions of the values held by @p buffer, must be of length NDIM.
+   * @details The values are neither copied nor initialized, so with an MmapBuffer opened on a
+   *   file this reopens a saved Array in constant time.
+   */
+  template< typename ... DIMS >
+  std::enable_if_t< sizeof ... ( DIMS ) == NDIM && all_of_t< std::is_integral< DIMS > ... >::value >
+  adoptBuffer( BUFFER_TYPE< T > && buffer, DIMS const ... newDims )
+  {
+    INDEX_TYPE const oldSize = size();
+
+    int curDim = 0;
+    forEachArg( [&curDim, dims=m_dims]( auto const newDim )
+    {
+      dims[ curDim ] = LvArray::integerConversion< INDEX_TYPE >( newDim );
+      LVARRAY_ERROR_IF_LT( dims[ curDim ], 0 );
+      ++curDim;
+    }, newDims ... );
+
+    CalculateStrides();
+    LVARRAY_ERROR_IF_GT_MSG( size(), buffer.capacity(), "The buffer does not hold enough values." );
+
+    bufferManipulation::free( m_dataBuffer, oldSize );
+    m_dataBuffer = std::move( buffer );
+  }
+
   /**
    * @brief Construct a value in place at the end of the array.
    * @tparam ARGS A variadic pack of the types to construct the new value from.
@@ -393,6 +567,65 @@ public:
     ++m_dims[ 0 ];
   }
 
+  /**
+   * @brief Append a row to the end of the first dimension, constructing each of its values in place.
+   * @tparam ARGS A variadic pack of the types to construct the new values from.
+   * @param args A variadic pack of values to construct each new value from, they are not forwarded.
+   * @details The capacity grows according to the growth policy (see bufferManipulation::dynamicReserve)
+   *   so building an Array one row at a time takes amortized constant time per row.
+   * @note The first dimension must be the first dimension in memory, so the new row is contiguous.
+   */
+  template< typename ... ARGS >
+  void emplaceBackRow( ARGS && ... args )
+  {
+    static_assert( asArray( PERMUTATION {} )[ 0 ] == 0, "The first dimension must be the first dimension in memory." );
+
+    INDEX_TYPE const curSize = size();
+    INDEX_TYPE const newSize = curSize + rowSize();
+    bufferManipulation::dynamicReserve( m_dataBuffer, curSize, newSize );
+
+    T * const ptr = data();
+    for( INDEX_TYPE i = curSize; i < newSize; ++i )
+    {
+      new ( ptr + i ) T( args ... );
+    }
+
+    ++m_dims[ 0 ];
+    CalculateStrides();
+  }
+
+  /**
+   * @tparam USD_SRC The unit stride dimension of @p rows.
+   * @tparam STRIDES_SRC The static strides of @p rows.
+   * @brief Append copies of the rows of @p rows to the end of the first dimension.
+   * @param rows The rows to append, every dimension except the first must match those of the Array.
+   * @details The capacity grows like emplaceBackRow. @p rows may have any permutation.
+   * @note The first dimension must be the first dimension in memory, so the new rows are contiguous.
+   * @pre @p rows must not refer to the values of this Array, they may be reallocated.
+   */
+  template< int USD_SRC, typename STRIDES_SRC >
+  void appendRows( ArraySlice< T const, NDIM, USD_SRC, INDEX_TYPE, STRIDES_SRC > const & rows )
+  {
+    static_assert( asArray( PERMUTATION {} )[ 0 ] == 0, "The first dimension must be the first dimension in memory." );
+
+    for( int i = 1; i < NDIM; ++i )
+    {
+      LVARRAY_ERROR_IF_NE_MSG( rows.size( i ), m_dims[ i ], "Dimension " << i << " doesn't match." );
+    }
+
+    INDEX_TYPE const curNumRows = m_dims[ 0 ];
+    INDEX_TYPE const curSize = size();
+    bufferManipulation::dynamicReserve( m_dataBuffer, curSize, curSize + rows.size() );
+
+    m_dims[ 0 ] += rows.size( 0 );
+    CalculateStrides();
+
+    forValuesInSliceWithIndices( rows, [curNumRows, dst=this->toSlice()] ( T const & value, INDEX_TYPE const i, auto const ... indices )
+    {
+      new ( &dst( curNumRows + i, indices ... ) ) T( value );
+    } );
+  }
+
   /**
    * @brief Insert a value into the array constructing it in place.
    * @tparam ARGS A variadic pack of the types to construct the new value from.
@@ -496,13 +729,54 @@ private:
   using ParentClass::m_strides;
   using ParentClass::m_singleParameterResizeIndex;
 
+  /**
+   * @brief Set the dimensions, strides and default dimension equal to those of @p rhs.
+   * @param rhs The Array to copy the shape of.
+   */
+  LVARRAY_HOST_DEVICE
+  void setDimsEqualTo( Array const & rhs )
+  {
+    for( int i = 0; i < NDIM; ++i )
+    {
+      m_dims[ i ] = rhs.m_dims[ i ];
+      m_strides[ i ] = rhs.m_strides[ i ];
+    }
+
+    setSingleParameterResizeIndex( rhs.getSingleParameterResizeIndex() );
+  }
+
+  /**
+   * @brief @return The number of values in each index of the first dimension.
+   */
+  LVARRAY_HOST_DEVICE
+  INDEX_TYPE rowSize() const
+  {
+    INDEX_TYPE numValues = 1;
+    for( int i = 1; i < NDIM; ++i )
+    {
+      numValues *= m_dims[ i ];
+    }
+
+    return numValues;
+  }
+
   /**
    * @brief Calculate the strides given the dimensions and permutation.
    * @note Adapted from RAJA::make_permuted_layout.
+   * @note Every resize goes through here so this is where the static extents are checked and the
+   *   new size is given to the buffer, see bufferManipulation::registerSize.
    */
   LVARRAY_HOST_DEVICE
   void CalculateStrides()
   {
+    constexpr CArray< camp::idx_t, NDIM > staticExtents = asArray( EXTENTS {} );
+    for( int i = 0; i < NDIM; ++i )
+    {
+      LVARRAY_ERROR_IF( staticExtents[ i ] != DYNAMIC_EXTENT && m_dims[ i ] != staticExtents[ i ],
+                        "Dimension " << i << " has a static extent of " << staticExtents[ i ] <<
+                        " and can't be resized to " << m_dims[ i ] );
+    }
+
     constexpr CArray< camp::idx_t, NDIM > perm = asArray( PERMUTATION {} );
     INDEX_TYPE foldedStrides[ NDIM ];
 
@@ -519,6 +793,8 @@ private:
     {
       m_strides[ perm[ i ] ] = foldedStrides[ i ];
     }
+
+    bufferManipulation::registerSize( m_dataBuffer, size() );
   }
 
   /**
@@ -617,6 +893,89 @@ private:
       }
     }
   }
+
+  /**
+   * @brief Relocate the contiguous blocks of the Array in place to make room for the resized default dimension.
+   * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+   * @param numBlocks the number of contiguous blocks, one for each index of the dimensions that come before the
+   *   default dimension in memory.
+   * @param curBlockSize the number of values in each block before the resize.
+   * @param newBlockSize the number of values in each block after the resize.
+   * @param defaultValue the value to initialize the new values with.
+   * @details Each block is relocated to its final position and then has its excess values destroyed or its new
+   *   values constructed. The destination of a block can overlap the source of its neighbor, so the blocks are
+   *   processed in batches. When growing the blocks are processed from the back, once the blocks after @c last
+   *   have been moved every block whose destination starts after the source of @c last can be moved along with
+   *   @c last. When shrinking the blocks are processed from the front in the same manner. Batches with fewer than
+   *   bufferManipulation::PARALLEL_COPY_CHUNK_BYTES worth of values are processed serially.
+   * @pre The dimensions and strides must already be those after the resize and the capacity must be large
+   *   enough to hold the resized Array.
+   */
+  template< typename POLICY >
+  void resizeDefaultDimensionInBatches( INDEX_TYPE const numBlocks,
+                                        INDEX_TYPE const curBlockSize,
+                                        INDEX_TYPE const newBlockSize,
+                                        T const & defaultValue )
+  {
+    T * const values = data();
+    INDEX_TYPE const numToRelocate = curBlockSize < newBlockSize ? curBlockSize : newBlockSize;
+    auto const resizeBlock = [values, curBlockSize, newBlockSize, numToRelocate, &defaultValue] ( INDEX_TYPE const block )
+    {
+      T * const src = values + curBlockSize * block;
+      T * const dst = values + newBlockSize * block;
+      arrayManipulation::uninitializedRelocate( dst, numToRelocate, src );
+      arrayManipulation::destroy( src + numToRelocate, curBlockSize - numToRelocate );
+
+      for( INDEX_TYPE i = numToRelocate; i < newBlockSize; ++i )
+      {
+        new ( dst + i ) T( defaultValue );
+      }
+    };
+
+    std::ptrdiff_t const minParallelSize = bufferManipulation::PARALLEL_COPY_CHUNK_BYTES / std::ptrdiff_t( sizeof( T ) );
+    INDEX_TYPE const maxBlockSize = curBlockSize < newBlockSize ? newBlockSize : curBlockSize;
+    auto const resizeBlocks = [&resizeBlock, minParallelSize, maxBlockSize] ( INDEX_TYPE const first, INDEX_TYPE const last )
+    {
+      if( ( last - first ) * maxBlockSize < minParallelSize )
+      {
+        for( INDEX_TYPE block = first; block < last; ++block )
+        { resizeBlock( block ); }
+      }
+      else
+      {
+        RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( first, last ), resizeBlock );
+      }
+    };
+
+    if( newBlockSize > curBlockSize )
+    {
+      INDEX_TYPE last = numBlocks;
+      while( last > 0 )
+      {
+        INDEX_TYPE const endOfSource = curBlockSize * last;
+        INDEX_TYPE const firstFree = ( endOfSource + newBlockSize - 1 ) / newBlockSize;
+        INDEX_TYPE const first = firstFree < last - 1 ? firstFree : last - 1;
+        resizeBlocks( first, last );
+        last = first;
+      }
+    }
+    else
+    {
+      INDEX_TYPE first = 0;
+      while( first < numBlocks )
+      {
+        INDEX_TYPE const lastFree = ( newBlockSize == 0 ) ? numBlocks : curBlockSize * first / newBlockSize;
+        INDEX_TYPE const last = lastFree < first + 1 ? first + 1 : ( lastFree < numBlocks ? lastFree : numBlocks );
+        resizeBlocks( first, last );
+        first = last;
+      }
+    }
+
+    if( numBlocks * newBlockSize > 0 )
+    {
+      m_dataBuffer.registerTouch( MemorySpace::CPU );
+    }
+  }
 };
 
 /**
@@ -631,14 +990,16 @@ constexpr bool isArray = false;
  * @tparam PERMUTATION The way that the data is layed out in memory.
  * @tparam INDEX_TYPE The integral type used as in index.
  * @tparam BUFFER_TYPE The type used to manage the underlying allocation.
+ * @tparam EXTENTS The dimensions that are known at compile time.
  * @brief Specialization of isArray for the Array class.
  */
 template< typename T,
           int NDIM,
           typename PERMUTATION,
           typename INDEX_TYPE,
-          template< typename > class BUFFER_TYPE >
-constexpr bool isArray< Array< T, NDIM, PERMUTATION, INDEX_TYPE, BUFFER_TYPE > > = true;
+          template< typename > class BUFFER_TYPE,
+          typename EXTENTS >
+constexpr bool isArray< Array< T, NDIM, PERMUTATION, INDEX_TYPE, BUFFER_TYPE, EXTENTS > > = true;
 
 namespace internal
 {
@@ -671,6 +1032,32 @@ struct StackArrayHelper
   using type = Array< T, NDIM, PERMUTATION, INDEX_TYPE, BufferType >;
 };
 
+/**
+ * @struct SmallArrayHelper
+ * @tparam T The type stored in the Array.
+ * @tparam NDIM The number of dimensions in the Array.
+ * @tparam PERMUTATION The dimension and permutation of the Array.
+ * @tparam INDEX_TYPE The integer used to index the Array.
+ * @tparam LENGTH The inline capacity of the underlying SmallBuffer.
+ */
+template< typename T,
+          int NDIM,
+          typename PERMUTATION,
+          typename INDEX_TYPE,
+          int LENGTH >
+struct SmallArrayHelper
+{
+  /**
+   * @brief An alias for a SmallBuffer with the given inline capacity.
+   * @tparam U The type contained in the SmallBuffer.
+   */
+  template< typename U >
+  using BufferType = SmallBuffer< U, LENGTH >;
+
+  /// An alias for the Array type.
+  using type = Array< T, NDIM, PERMUTATION, INDEX_TYPE, BufferType >;
+};
+
 } // namespace internal
 
 /**
@@ -688,6 +1075,22 @@ template< typename T,
           int LENGTH >
 using StackArray = typename internal::StackArrayHelper< T, NDIM, PERMUTATION, INDEX_TYPE, LENGTH >::type;
 
+/**
+ * @tparam T The type of the values stored in the Array.
+ * @tparam NDIM The number of dimensions in the Array.
+ * @tparam PERMUTATION The layout of the data in memory.
+ * @tparam INDEX_TYPE The integer used for indexing.
+ * @tparam LENGTH The number of values stored inline.
+ * @brief An alias for a Array backed by a SmallBuffer. Like a StackArray it holds up to
+ *   @p LENGTH values without allocating but it can also grow past @p LENGTH.
+ */
+template< typename T,
+          int NDIM,
+          typename PERMUTATION,
+          typename INDEX_TYPE,
+          int LENGTH >
+using SmallArray = typename internal::SmallArrayHelper< T, NDIM, PERMUTATION, INDEX_TYPE, LENGTH >::type;
+
 } /* namespace LvArray */
 
 #endif /* ARRAY_HPP_ */
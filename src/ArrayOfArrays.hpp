@@ -24,6 +24,11 @@
 
 #include "ArrayOfArraysView.hpp"
 
+// System includes
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 namespace LvArray
 {
 
@@ -66,6 +71,7 @@ public:
   using ParentClass::operator[];
   using ParentClass::operator();
   using ParentClass::emplaceBackAtomic;
+  using ParentClass::appendToArrayAtomic;
   using ParentClass::eraseFromArray;
 
   /**
@@ -106,15 +112,41 @@ public:
    * @brief Copy assignment operator, performs a deep copy.
    * @param src the ArrayOfArrays to copy.
    * @return *this.
+   * @note If the buffers support sharing (see CopyOnWriteBuffer) both share the values read only,
+   *   either one has to be touched with move( MemorySpace::CPU ) before it is modified.
    */
   inline
   ArrayOfArrays & operator=( ArrayOfArrays const & src ) LVARRAY_RESTRICT_THIS
   {
-    ParentClass::setEqualTo( src.m_numArrays,
-                             src.m_offsets[ src.m_numArrays ],
-                             src.m_offsets,
-                             src.m_sizes,
-                             src.m_values );
+    if( !ParentClass::shareWith( src.m_numArrays,
+                                 src.m_offsets,
+                                 src.m_sizes,
+                                 src.m_values ) )
+    {
+      ParentClass::setEqualTo( src.m_numArrays,
+                               src.m_offsets[ src.m_numArrays ],
+                               src.m_offsets,
+                               src.m_sizes,
+                               src.m_values );
+    }
+
+    return *this;
+  }
+
+  /**
+   * @tparam POLICY The RAJA policy used to copy the values, should NOT be a device policy.
+   * @brief Perform a deep copy of @p src, copying the values in parallel.
+   * @param src the ArrayOfArrays to copy.
+   * @return *this.
+   */
+  template< typename POLICY >
+  ArrayOfArrays & copyFrom( ArrayOfArrays const & src ) LVARRAY_RESTRICT_THIS
+  {
+    ParentClass::template setEqualTo< POLICY >( src.m_numArrays,
+                                                src.m_offsets[ src.m_numArrays ],
+                                                src.m_offsets,
+                                                src.m_sizes,
+                                                src.m_values );
     return *this;
   }
 
@@ -142,6 +174,24 @@ public:
     ParentClass::assimilate( reinterpret_cast< ParentClass && >( src ) );
   }
 
+  /**
+   * @brief Replace the contents with the arrays held by the given buffers.
+   * @param numArrays The number of arrays held by the buffers.
+   * @param offsets The offsets of the arrays, must hold at least @p numArrays + 1 values.
+   * @param sizes The sizes of the arrays, must hold at least @p numArrays values.
+   * @param values The values of the arrays.
+   * @details Nothing is copied, so with MmapBuffers opened on the files of a saved ArrayOfArrays
+   *   this reopens it in constant time.
+   */
+  void adoptBuffers( INDEX_TYPE const numArrays,
+                     BUFFER_TYPE< INDEX_TYPE > && offsets,
+                     BUFFER_TYPE< INDEX_TYPE > && sizes,
+                     BUFFER_TYPE< T > && values )
+  {
+    ParentClass::free();
+    ParentClass::adoptBuffers( numArrays, std::move( offsets ), std::move( sizes ), std::move( values ) );
+  }
+
   /**
    * @brief @return Return a reference to *this converted to ArrayOfArraysView<T, INDEX_TYPE const>.
    * @note Duplicated for SFINAE needs.
@@ -199,14 +249,86 @@ public:
   /**
    * @tparam POLICY The RAJA policy used to convert @p capacities into the offsets array.
    *   Should NOT be a device policy.
+   * @tparam FIRST_TOUCH If true the storage of the sub arrays is first touched with @p POLICY.
    * @brief Clears the array and creates a new array with the given number of sub-arrays.
    * @param numSubArrays The new number of arrays.
    * @param capacities A pointer to an array of length @p numSubArrays containing the capacity
    *   of each new sub array.
    */
-  template< typename POLICY >
+  template< typename POLICY, bool FIRST_TOUCH=false >
   void resizeFromCapacities( INDEX_TYPE const numSubArrays, INDEX_TYPE const * const capacities )
-  { ParentClass::template resizeFromCapacities< POLICY >( numSubArrays, capacities ); }
+  { ParentClass::template resizeFromCapacities< POLICY, FIRST_TOUCH >( numSubArrays, capacities ); }
+
+  /**
+   * @tparam POLICY The RAJA policy used to iterate over the items and to compute the offsets.
+   *   Should NOT be a device policy.
+   * @tparam ATOMIC_POLICY The RAJA atomic policy used to count and append the values.
+   * @tparam FUNC The type of @p func.
+   * @brief Clears the array and creates a new array with the given number of sub-arrays
+   *   filled with the values produced by @p func.
+   * @param numSubArrays The new number of arrays.
+   * @param numItems The number of items to call @p func with.
+   * @param func The function that produces the values, it is called as
+   *   @code func( item, emit ) @endcode for each item in [0, @p numItems) where @c emit is called as
+   *   @code emit( i, args ... ) @endcode to append a value constructed from @c args to array @c i.
+   * @details This is done in two passes. The first calls @p func to count the number of values in each
+   *   array, the counts become the capacities passed to resizeFromCapacities and the second pass calls
+   *   @p func again to append the values with emplaceBackAtomic. So @p func must emit the same arrays
+   *   both times it is called for an item. Each array ends up with no extra capacity, and unless
+   *   @p POLICY is sequential the order of the values in an array is unspecified.
+   */
+  template< typename POLICY, typename ATOMIC_POLICY=RAJA::auto_atomic, typename FUNC >
+  void buildFromItems( INDEX_TYPE const numSubArrays, INDEX_TYPE const numItems, FUNC && func )
+  {
+    std::vector< INDEX_TYPE > counts( numSubArrays, 0 );
+    INDEX_TYPE * const countsData = counts.data();
+    RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numItems ),
+                            [&func, numSubArrays, countsData] ( INDEX_TYPE const item )
+    {
+      func( item, [numSubArrays, countsData] ( INDEX_TYPE const i, auto && ... )
+      {
+        LVARRAY_ERROR_IF( !arrayManipulation::isPositive( i ) || i >= numSubArrays,
+                          "Bounds Check Failed: i=" << i << " numSubArrays=" << numSubArrays );
+        RAJA::atomicInc< ATOMIC_POLICY >( countsData + i );
+      } );
+    } );
+
+    resizeFromCapacities< POLICY >( numSubArrays, countsData );
+
+    ArrayOfArraysView< T, INDEX_TYPE const, false, BUFFER_TYPE > const view = toView();
+    RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numItems ),
+                            [&func, &view] ( INDEX_TYPE const item )
+    {
+      func( item, [&view] ( INDEX_TYPE const i, auto && ... args )
+      {
+        view.template emplaceBackAtomic< ATOMIC_POLICY >( i, std::forward< decltype( args ) >( args ) ... );
+      } );
+    } );
+  }
+
+  /**
+   * @tparam POLICY The RAJA policy used to iterate over the pairs and to compute the offsets.
+   *   Should NOT be a device policy.
+   * @tparam ATOMIC_POLICY The RAJA atomic policy used to count and append the values.
+   * @brief Clears the array and creates a new array with the given number of sub-arrays
+   *   where @p values[ j ] is appended to array @p arrays[ j ].
+   * @param numSubArrays The new number of arrays.
+   * @param arrays The array to append each value to.
+   * @param values The values to append, must be the same size as @p arrays.
+   * @note See buildFromItems.
+   */
+  template< typename POLICY, typename ATOMIC_POLICY=RAJA::auto_atomic >
+  void buildFromPairs( INDEX_TYPE const numSubArrays,
+                       ArraySlice< INDEX_TYPE const, 1, 0, INDEX_TYPE > const & arrays,
+                       ArraySlice< T const, 1, 0, INDEX_TYPE > const & values )
+  {
+    LVARRAY_ERROR_IF_NE( arrays.size(), values.size() );
+    buildFromItems< POLICY, ATOMIC_POLICY >( numSubArrays, arrays.size(),
+                                             [arrays, values] ( INDEX_TYPE const j, auto && emit )
+    {
+      emit( arrays[ j ], values[ j ] );
+    } );
+  }
 
   /**
    * @brief Append an array.
@@ -284,6 +406,22 @@ public:
   void compress()
   { ParentClass::compress(); }
 
+  /**
+   * @tparam POLICY The RAJA policy used to relocate the arrays.
+   * @brief Compress the arrays in parallel, the values are relocated into a new allocation of the same capacity.
+   * @note This method doesn't free any memory.
+   */
+  template< typename POLICY >
+  void compress()
+  { ParentClass::template compress< POLICY >(); }
+
+  /**
+   * @brief Compress the arrays and free all of the unused capacity.
+   * @note Growing any array afterwards requires a reallocation.
+   */
+  void shrinkToFit()
+  { ParentClass::shrinkToFit(); }
+
   /**
    * @brief Append a value to an array constructing it in place with the given arguments.
    * @tparam ARGS Variadic pack of types used to construct T.
@@ -381,6 +519,81 @@ public:
   void setCapacityOfArray( INDEX_TYPE const i, INDEX_TYPE const newCapacity )
   { ParentClass::setCapacityOfArray( i, newCapacity ); }
 
+  /**
+   * @brief Set the capacity of many arrays at once, each array is relocated at most once.
+   * @param numArraysToChange the number of arrays to set the capacity of.
+   * @param arrays the arrays to set the capacity of, of length @p numArraysToChange.
+   * @param newCapacities the new capacity of each array in @p arrays, of length @p numArraysToChange.
+   */
+  void setCapacitiesOfArrays( INDEX_TYPE const numArraysToChange,
+                              INDEX_TYPE const * const arrays,
+                              INDEX_TYPE const * const newCapacities )
+  {
+    ParentClass::setCapacitiesOfArrays( numArraysToChange, arrays, newCapacities,
+                                        std::numeric_limits< INDEX_TYPE >::max() );
+  }
+
+  /**
+   * @tparam POLICY The RAJA policy used to append the values to the arrays, should NOT be a device policy.
+   * @brief Move the values held by @p overflow into their arrays and clear it.
+   * @param overflow The values that didn't fit, see ArrayOfArraysView::emplaceBackAtomicOrOverflow.
+   * @details The arrays that overflowed are grown to exactly fit their values with a single call to
+   *   setCapacitiesOfArrays. The values are appended after the existing values of each array in the order
+   *   in which they were added to @p overflow.
+   */
+  template< typename POLICY >
+  void mergeOverflow( ArrayOfArraysOverflow< T, INDEX_TYPE > & overflow )
+  {
+    INDEX_TYPE const numEntries = overflow.size();
+    if( numEntries == 0 )
+    {
+      return;
+    }
+
+    // Group the entries by the array they belong to.
+    std::vector< INDEX_TYPE > order( numEntries );
+    std::iota( order.begin(), order.end(), INDEX_TYPE( 0 ) );
+    std::stable_sort( order.begin(), order.end(), [&overflow] ( INDEX_TYPE const a, INDEX_TYPE const b )
+    {
+      return overflow[ a ].array < overflow[ b ].array;
+    } );
+
+    std::vector< INDEX_TYPE > arrays;
+    std::vector< INDEX_TYPE > newCapacities;
+    std::vector< INDEX_TYPE > firstEntry;
+    for( INDEX_TYPE k = 0; k < numEntries; ++k )
+    {
+      INDEX_TYPE const i = overflow[ order[ k ] ].array;
+      if( arrays.empty() || arrays.back() != i )
+      {
+        arrays.push_back( i );
+        newCapacities.push_back( sizeOfArray( i ) );
+        firstEntry.push_back( k );
+      }
+
+      ++newCapacities.back();
+    }
+    firstEntry.push_back( numEntries );
+
+    INDEX_TYPE const numArraysToChange = arrays.size();
+    setCapacitiesOfArrays( numArraysToChange, arrays.data(), newCapacities.data() );
+
+    ArrayOfArraysView< T, INDEX_TYPE const, false, BUFFER_TYPE > const view = toView();
+    INDEX_TYPE const * const arraysData = arrays.data();
+    INDEX_TYPE const * const orderData = order.data();
+    INDEX_TYPE const * const firstEntryData = firstEntry.data();
+    RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numArraysToChange ),
+                            [&overflow, view, arraysData, orderData, firstEntryData] ( INDEX_TYPE const j )
+    {
+      for( INDEX_TYPE k = firstEntryData[ j ]; k < firstEntryData[ j + 1 ]; ++k )
+      {
+        view.emplaceBack( arraysData[ j ], std::move( overflow[ orderData[ k ] ].value ) );
+      }
+    } );
+
+    overflow.clear();
+  }
+
   /**
    * @brief Set the name to be displayed whenever the underlying Buffer's user call back is called.
    * @param name The name to display.
@@ -0,0 +1,202 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+/**
+ * @file ArrayOfArraysOverflow.hpp
+ */
+
+#pragma once
+
+// Source includes
+#include "Macros.hpp"
+#include "arrayManipulation.hpp"
+
+// System includes
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace LvArray
+{
+
+/**
+ * @class ArrayOfArraysOverflow
+ * @brief Holds the values that didn't fit in their array during a concurrent insertion into an ArrayOfArraysView.
+ * @tparam T the type of the values.
+ * @tparam INDEX_TYPE the integer used to index the arrays.
+ * @details Values are appended concurrently and without locks, each append reserves a slot with a single
+ *   atomic increment. The slots live in chunks that double in size and are allocated the first time a slot
+ *   in them is reserved, so existing values are never moved and an append always succeeds.
+ *   The values are spliced into their arrays with ArrayOfArrays::mergeOverflow.
+ * @note This class can only be used on the host.
+ */
+template< typename T, typename INDEX_TYPE >
+class ArrayOfArraysOverflow
+{
+public:
+
+  /**
+   * @struct Entry
+   * @brief A value and the array it belongs to.
+   */
+  struct Entry
+  {
+    /// The array the value belongs to.
+    INDEX_TYPE array;
+
+    /// The value.
+    T value;
+  };
+
+  /**
+   * @brief Constructor, no memory is allocated until the first append.
+   */
+  ArrayOfArraysOverflow():
+    m_size( 0 ),
+    m_chunks()
+  {
+    for( std::atomic< Storage * > & chunk : m_chunks )
+    {
+      chunk.store( nullptr, std::memory_order_relaxed );
+    }
+  }
+
+  /// Deleted copy constructor.
+  ArrayOfArraysOverflow( ArrayOfArraysOverflow const & ) = delete;
+
+  /// Deleted copy assignment operator.
+  ArrayOfArraysOverflow & operator=( ArrayOfArraysOverflow const & ) = delete;
+
+  /**
+   * @brief Destructor, destroys the values and frees the chunks.
+   */
+  ~ArrayOfArraysOverflow()
+  {
+    clear();
+    for( std::atomic< Storage * > & chunk : m_chunks )
+    {
+      delete[] chunk.load( std::memory_order_relaxed );
+    }
+  }
+
+  /**
+   * @brief @return The number of values held.
+   * @note Only meaningful when no thread is appending.
+   */
+  INDEX_TYPE size() const
+  { return m_size.load( std::memory_order_relaxed ); }
+
+  /**
+   * @brief @return Return the entry at position @p k.
+   * @param k The position of the entry, the order of the entries is the order in which their slots were reserved.
+   */
+  Entry & operator[]( INDEX_TYPE const k )
+  {
+    LVARRAY_ASSERT( arrayManipulation::isPositive( k ) && k < size() );
+    int const chunk = chunkOf( k );
+    return reinterpret_cast< Entry & >( m_chunks[ chunk ].load( std::memory_order_relaxed )[ k - chunkStart( chunk ) ] );
+  }
+
+  /**
+   * @tparam ARGS A variadic pack of types used to construct the new T, the types of @p args.
+   * @brief Append a value that belongs to array @p i, this is thread safe.
+   * @param i The array the value belongs to.
+   * @param args The variadic pack of arguments forwarded to construct the new value.
+   */
+  template< typename ... ARGS >
+  void emplaceBack( INDEX_TYPE const i, ARGS && ... args )
+  {
+    INDEX_TYPE const k = m_size.fetch_add( 1, std::memory_order_relaxed );
+    int const chunk = chunkOf( k );
+    LVARRAY_ERROR_IF_GE_MSG( chunk, NUM_CHUNKS, "The overflow buffer is full." );
+
+    Storage * storage = m_chunks[ chunk ].load( std::memory_order_acquire );
+    if( storage == nullptr )
+    {
+      // Allocate the chunk, if another thread beat us to it use its allocation instead.
+      Storage * const newStorage = new Storage[ chunkStart( chunk + 1 ) - chunkStart( chunk ) ];
+      if( m_chunks[ chunk ].compare_exchange_strong( storage, newStorage, std::memory_order_acq_rel ) )
+      {
+        storage = newStorage;
+      }
+      else
+      {
+        delete[] newStorage;
+      }
+    }
+
+    new ( storage + k - chunkStart( chunk ) ) Entry{ i, T( std::forward< ARGS >( args )... ) };
+  }
+
+  /**
+   * @brief Destroy all the values, the chunks are kept for reuse.
+   * @note Not thread safe.
+   */
+  void clear()
+  {
+    INDEX_TYPE const numEntries = size();
+    for( INDEX_TYPE k = 0; k < numEntries; ++k )
+    {
+      operator[]( k ).~Entry();
+    }
+
+    m_size.store( 0, std::memory_order_relaxed );
+  }
+
+private:
+
+  /// The uninitialized storage for an Entry.
+  using Storage = std::aligned_storage_t< sizeof( Entry ), alignof( Entry ) >;
+
+  /// The number of entries in the first chunk, each following chunk is twice as large as the previous one.
+  static constexpr std::ptrdiff_t FIRST_CHUNK_SIZE = 64;
+
+  /// The maximum number of chunks.
+  static constexpr int NUM_CHUNKS = 40;
+
+  /**
+   * @brief @return The position of the first entry in chunk @p chunk.
+   * @param chunk The chunk.
+   */
+  static std::ptrdiff_t chunkStart( int const chunk )
+  { return FIRST_CHUNK_SIZE * ( ( std::ptrdiff_t( 1 ) << chunk ) - 1 ); }
+
+  /**
+   * @brief @return The chunk that holds the entry at position @p k.
+   * @param k The position of the entry.
+   */
+  static int chunkOf( std::ptrdiff_t const k )
+  {
+    int chunk = 0;
+    while( k >= chunkStart( chunk + 1 ) )
+    {
+      ++chunk;
+    }
+
+    return chunk;
+  }
+
+  /// The number of slots reserved.
+  std::atomic< INDEX_TYPE > m_size;
+
+  /// The chunks, allocated on demand.
+  std::atomic< Storage * > m_chunks[ NUM_CHUNKS ];
+};
+
+} // namespace LvArray
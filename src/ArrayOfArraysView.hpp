@@ -25,6 +25,7 @@
 // Source includes
 #include "bufferManipulation.hpp"
 #include "arrayManipulation.hpp"
+#include "ArrayOfArraysOverflow.hpp"
 #include "ArraySlice.hpp"
 #include "templateHelpers.hpp"
 
@@ -32,7 +33,10 @@
 #include <RAJA/RAJA.hpp>
 
 // System includes
+#include <algorithm>
 #include <cstring>
+#include <limits>
+#include <vector>
 
 #ifdef USE_ARRAY_BOUNDS_CHECK
 
@@ -369,6 +373,45 @@ public:
     arrayManipulation::emplaceBack( ptr, previousSize, std::forward< ARGS >( args ) ... );
   }
 
+  /**
+   * @brief Append a value to an array in a thread safe manner, if the array is full the value is
+   *   appended to @p overflow instead.
+   * @tparam POLICY The RAJA atomic policy to use to increment the size of the array.
+   * @tparam ARGS A variadic pack of types used to construct the new T, the types of @p args.
+   * @param i the array to append to.
+   * @param overflow The buffer that holds the values that don't fit.
+   * @param args The variadic pack of arguments forwared to construct the new value.
+   * @details The size of the array is only incremented if it is less than the capacity, so unlike
+   *   emplaceBackAtomic this never fails. Afterwards ArrayOfArrays::mergeOverflow moves the values
+   *   from @p overflow into their arrays.
+   * @note Since @p overflow lives on the host this can't be called on device.
+   */
+  template< typename POLICY, typename ... ARGS >
+  inline
+  void emplaceBackAtomicOrOverflow( INDEX_TYPE const i,
+                                    ArrayOfArraysOverflow< std::remove_const_t< T >, INDEX_TYPE_NC > & overflow,
+                                    ARGS && ... args ) const LVARRAY_RESTRICT_THIS
+  {
+    ARRAYOFARRAYS_CHECK_BOUNDS( i );
+
+    INDEX_TYPE_NC const capacity = capacityOfArray( i );
+    INDEX_TYPE_NC previousSize = RAJA::atomicLoad< POLICY >( &m_sizes[ i ] );
+    while( previousSize < capacity )
+    {
+      INDEX_TYPE_NC const currentSize = RAJA::atomicCAS< POLICY >( &m_sizes[ i ], previousSize, previousSize + 1 );
+      if( currentSize == previousSize )
+      {
+        T * const ptr = m_values.data() + m_offsets[ i ];
+        arrayManipulation::emplaceBack( ptr, previousSize, std::forward< ARGS >( args ) ... );
+        return;
+      }
+
+      previousSize = currentSize;
+    }
+
+    overflow.emplaceBack( i, std::forward< ARGS >( args ) ... );
+  }
+
   /**
    * @brief Append values to an array.
    * @tparam ITER An iterator, they type of @p first and @p last.
@@ -390,6 +433,32 @@ public:
     m_sizes[ i ] += n;
   }
 
+  /**
+   * @brief Append values to an array in a thread safe manner.
+   * @tparam POLICY The RAJA atomic policy to use to increment the size of the array.
+   * @tparam ITER An iterator, they type of @p first and @p last.
+   * @param i the array to append to.
+   * @param first An iterator to the first value to append.
+   * @param last An iterator to the end of the values to append.
+   * @details Space for all the values is reserved with a single atomic add to the size of the array,
+   *   so the values are contiguous in the array even when other threads append to it concurrently.
+   * @pre Since the ArrayOfArraysView can't do reallocation or shift the offsets it is
+   *   up to the user to ensure that the given array has enough space for the new values.
+   */
+  template< typename POLICY, typename ITER >
+  LVARRAY_HOST_DEVICE inline
+  void appendToArrayAtomic( INDEX_TYPE const i, ITER const first, ITER const last ) const LVARRAY_RESTRICT_THIS
+  {
+    ARRAYOFARRAYS_CHECK_BOUNDS( i );
+
+    T * const ptr = m_values.data() + m_offsets[ i ];
+    INDEX_TYPE const n = iterDistance( first, last );
+    INDEX_TYPE const previousSize = RAJA::atomicAdd< POLICY >( &m_sizes[ i ], n );
+    ARRAYOFARRAYS_ATOMIC_CAPACITY_CHECK( i, previousSize, n );
+
+    arrayManipulation::append( ptr, previousSize, first, last );
+  }
+
   /**
    * @brief Insert a value into an array.
    * @tparam ARGS A variadic pack of types used to construct the new T, the types of @p args.
@@ -535,27 +604,32 @@ protected:
 
         INDEX_TYPE const totalSize = m_offsets[ newSize ];
 
-        INDEX_TYPE const maxOffset = m_offsets[ m_numArrays ];
-        forEachArg( [totalSize, maxOffset]( auto & buffer )
+        forEachArg( [this, totalSize]( auto & buffer )
         {
-          bufferManipulation::reserve( buffer, maxOffset, totalSize );
+          if( totalSize > buffer.capacity() )
+          {
+            setValueCapacity( buffer, m_offsets.data(), totalSize );
+          }
         }, m_values, buffers ... );
       }
     }
 
     m_numArrays = newSize;
+    registerSizes( buffers ... );
   }
 
   /**
    * @tparam POLICY The RAJA policy used to convert @p capacities into the offsets array.
    *   Should NOT be a device policy.
+   * @tparam FIRST_TOUCH If true the storage of the sub arrays is first touched with @p POLICY,
+   *   using the same schedule as a loop over the sub arrays. See bufferManipulation::firstTouch.
    * @brief Clears the array and creates a new array with the given number of sub-arrays.
    * @param numSubArrays The new number of arrays.
    * @param capacities A pointer to an array of length @p numSubArrays containing the capacity
    *   of each new sub array.
    * @param buffers A variadic pack of buffers to treat similarly to m_values.
    */
-  template< typename POLICY, typename ... BUFFERS >
+  template< typename POLICY, bool FIRST_TOUCH=false, typename ... BUFFERS >
   void resizeFromCapacities( INDEX_TYPE const numSubArrays,
                              INDEX_TYPE const * const capacities,
                              BUFFERS & ... buffers )
@@ -589,9 +663,63 @@ protected:
     {
       bufferManipulation::reserve( buffer, 0, maxOffset );
     }, m_values, buffers ... );
+
+    if( FIRST_TOUCH )
+    {
+      INDEX_TYPE const * const offsets = m_offsets.data();
+      forEachArg( [numSubArrays, offsets] ( auto & buffer )
+      {
+        using U = typename std::remove_reference_t< decltype( buffer ) >::value_type;
+        char * const storage = reinterpret_cast< char * >( buffer.data() );
+        RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numSubArrays ),
+                                [storage, offsets] ( INDEX_TYPE const i )
+        {
+          std::memset( storage + offsets[ i ] * sizeof( U ), 0, ( offsets[ i + 1 ] - offsets[ i ] ) * sizeof( U ) );
+        } );
+      }, m_values, buffers ... );
+    }
+
+    registerSizes( buffers ... );
   }
 
 
+  /**
+   * @brief Replace the contents with the arrays held by the given buffers.
+   * @param numArrays The number of arrays held by the buffers.
+   * @param offsets The offsets of the arrays, must hold at least @p numArrays + 1 values
+   *   unless @p numArrays is zero.
+   * @param sizes The sizes of the arrays, must hold at least @p numArrays values.
+   * @param values The values of the arrays, the first sizes[ i ] values of each array must be initialized.
+   * @note The current buffers must already have been free'd.
+   */
+  void adoptBuffers( INDEX_TYPE const numArrays,
+                     BUFFER_TYPE< INDEX_TYPE > && offsets,
+                     BUFFER_TYPE< SIZE_TYPE > && sizes,
+                     BUFFER_TYPE< T > && values )
+  {
+    LVARRAY_ERROR_IF( !arrayManipulation::isPositive( numArrays ), "numArrays must be positive." );
+    LVARRAY_ERROR_IF_LT_MSG( sizes.capacity(), numArrays, "The sizes buffer is too small." );
+    if( numArrays > 0 )
+    {
+      LVARRAY_ERROR_IF_LT_MSG( offsets.capacity(), numArrays + 1, "The offsets buffer is too small." );
+      LVARRAY_ERROR_IF_LT_MSG( values.capacity(), offsets[ numArrays ], "The values buffer is too small." );
+    }
+
+  #ifdef USE_ARRAY_BOUNDS_CHECK
+    for( INDEX_TYPE i = 0; i < numArrays; ++i )
+    {
+      LVARRAY_ERROR_IF_LT( sizes[ i ], 0 );
+      LVARRAY_ERROR_IF_GT( sizes[ i ], offsets[ i + 1 ] - offsets[ i ] );
+    }
+  #endif
+
+    m_numArrays = numArrays;
+    m_offsets = std::move( offsets );
+    m_sizes = std::move( sizes );
+    m_values = std::move( values );
+    registerSizes();
+  }
+
   /**
    * @brief Destroy all the objects held by this array and free all associated memory.
    * @tparam BUFFERS variadic template where each type is a BUFFER_TYPE.
@@ -613,6 +741,47 @@ protected:
   }
 
   /**
+   * @tparam PAIRS_OF_BUFFERS variadic template where each type is an PairOfBuffers.
+   * @brief If the buffers support sharing (see CopyOnWriteBuffer) make this ArrayOfArraysView share the
+   *   allocations of the provided arrays.
+   * @param srcNumArrays The number of arrays in source.
+   * @param srcOffsets the source offsets array.
+   * @param srcSizes the source sizes array.
+   * @param srcValues the source values array.
+   * @param pairs variadic parameter pack where each argument is an PairOfBuffers where each pair
+   *   should be treated similarly to {m_values, srcValues}.
+   * @return True iff the buffers support sharing, otherwise nothing is done and setEqualTo should be used.
+   * @note This is to be use by the non-view derived classes.
+   */
+  template< class ... PAIRS_OF_BUFFERS >
+  bool shareWith( INDEX_TYPE const srcNumArrays,
+                  BUFFER_TYPE< INDEX_TYPE > const & srcOffsets,
+                  BUFFER_TYPE< INDEX_TYPE > const & srcSizes,
+                  BUFFER_TYPE< T > const & srcValues,
+                  PAIRS_OF_BUFFERS && ... pairs )
+  {
+    if( !bufferManipulation::HasMemberFunction_share< BUFFER_TYPE< INDEX_TYPE > > )
+    { return false; }
+
+    destroyValues( 0, m_numArrays, pairs.first ... );
+
+    INDEX_TYPE const offsetsSize = ( m_numArrays == 0 ) ? 0 : m_numArrays + 1;
+    bufferManipulation::share( m_offsets, offsetsSize, srcOffsets );
+    bufferManipulation::share( m_sizes, m_numArrays, srcSizes );
+
+    // The values were destroyed above so the size doesn't matter.
+    forEachArg( [] ( auto & pair )
+    {
+      bufferManipulation::share( pair.first, 0, pair.second );
+    }, PairOfBuffers< T >( m_values, srcValues ), pairs ... );
+
+    m_numArrays = srcNumArrays;
+    registerSizes( pairs.first ... );
+    return true;
+  }
+
+  /**
+   * @tparam POLICY The RAJA policy used to copy the values, should NOT be a device policy.
    * @tparam PAIRS_OF_BUFFERS variadic template where each type is an PairOfBuffers.
    * @brief Set this ArrayOfArraysView equal to the provided arrays.
    * @param srcNumArrays The number of arrays in source.
@@ -622,9 +791,11 @@ protected:
    * @param srcValues the source values array.
    * @param pairs variadic parameter pack where each argument is an PairOfBuffers where each pair
    *   should be treated similarly to {m_values, srcValues}.
+   * @details If the source is compressed its values are copied all at once, otherwise each array is copied
+   *   separately. Either way trivially copyable values are copied with std::memcpy.
    * @note This is to be use by the non-view derived classes.
    */
-  template< class ... PAIRS_OF_BUFFERS >
+  template< typename POLICY=RAJA::loop_exec, class ... PAIRS_OF_BUFFERS >
   void setEqualTo( INDEX_TYPE const srcNumArrays,
                    INDEX_TYPE const srcMaxOffset,
                    BUFFER_TYPE< INDEX_TYPE > const & srcOffsets,
@@ -636,29 +807,48 @@ protected:
 
     INDEX_TYPE const offsetsSize = ( m_numArrays == 0 ) ? 0 : m_numArrays + 1;
 
-    bufferManipulation::copyInto( m_offsets, offsetsSize, srcOffsets, srcNumArrays + 1 );
-    bufferManipulation::copyInto( m_sizes, m_numArrays, srcSizes, srcNumArrays );
+    bufferManipulation::copyInto< POLICY >( m_offsets, offsetsSize, srcOffsets, srcNumArrays + 1 );
+    bufferManipulation::copyInto< POLICY >( m_sizes, m_numArrays, srcSizes, srcNumArrays );
 
-    INDEX_TYPE const maxOffset = m_offsets[ m_numArrays ];
-    forEachArg( [maxOffset, srcMaxOffset]( auto & dstBuffer )
+    // The values were destroyed above so they don't need to be copied if the buffers are reallocated.
+    forEachArg( [srcMaxOffset]( auto & dstBuffer )
     {
-      bufferManipulation::reserve( dstBuffer, maxOffset, srcMaxOffset );
+      bufferManipulation::reserve( dstBuffer, 0, srcMaxOffset );
     }, m_values, pairs.first ... );
 
     m_numArrays = srcNumArrays;
 
-    forEachArg( [this] ( auto & pair )
+    bool isCompressed = true;
+    for( INDEX_TYPE_NC i = 0; i < m_numArrays; ++i )
+    {
+      if( sizeOfArray( i ) != capacityOfArray( i ) )
+      {
+        isCompressed = false;
+        break;
+      }
+    }
+
+    INDEX_TYPE const * const offsets = m_offsets.data();
+    INDEX_TYPE const * const sizes = m_sizes.data();
+    forEachArg( [this, isCompressed, srcMaxOffset, offsets, sizes] ( auto & pair )
     {
-      auto & dstBuffer = pair.first;
-      auto const & srcBuffer = pair.second;
+      auto * const dstValues = pair.first.data();
+      auto const * const srcValuesData = pair.second.data();
 
-      for( INDEX_TYPE_NC i = 0; i < m_numArrays; ++i )
+      if( isCompressed )
       {
-        INDEX_TYPE const offset = m_offsets[i];
-        INDEX_TYPE const arraySize = sizeOfArray( i );
-        arrayManipulation::uninitializedCopy( &srcBuffer[ offset ], &srcBuffer[ offset ] + arraySize, &dstBuffer[ offset ] );
+        bufferManipulation::uninitializedCopy< POLICY >( dstValues, srcMaxOffset, srcValuesData );
+        return;
       }
+
+      RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE_NC >( 0, m_numArrays ),
+                              [dstValues, srcValuesData, offsets, sizes] ( INDEX_TYPE_NC const i )
+      {
+        arrayManipulation::uninitializedCopy( dstValues + offsets[ i ], sizes[ i ], srcValuesData + offsets[ i ] );
+      } );
     }, PairOfBuffers< T >( m_values, srcValues ), pairs ... );
+
+    registerSizes( pairs.first ... );
   }
 
   /**
@@ -693,6 +883,105 @@ protected:
 
     // Update the last offset.
     m_offsets[ m_numArrays ] = m_offsets[ m_numArrays - 1 ] + sizeOfArray( m_numArrays - 1 );
+    registerSizes( buffers ... );
+  }
+
+  /**
+   * @brief Compress the arrays so that the values of each array are contiguous with no extra capacity in between.
+   * @tparam POLICY The RAJA policy used to compute the new offsets and to relocate the arrays.
+   * @tparam BUFFERS variadic template where each type is a BUFFER_TYPE.
+   * @param buffers variadic parameter pack where each argument is a BUFFER_TYPE that should be treated
+   *   similarly to m_values.
+   * @details The new offsets are an exclusive scan of the sizes. Unlike the serial compress the destination of
+   *   an array can overlap the source of a previous array, so the arrays are relocated in place in batches.
+   *   Once the arrays before @c first have been moved all of the memory below their old offset that isn't
+   *   part of their new location is unused, so every subsequent array whose destination ends below the old
+   *   offset of @c first can be moved at the same time as @c first. Batches with fewer than
+   *   bufferManipulation::PARALLEL_COPY_CHUNK_BYTES worth of values are relocated serially.
+   * @note This is to be use by the non-view derived classes.
+   * @note This method doesn't free any memory.
+   * @note POLICY should NOT be a device policy.
+   */
+  template< typename POLICY, class ... BUFFERS >
+  void compress( BUFFERS & ... buffers )
+  {
+    if( m_numArrays == 0 )
+    { return; }
+
+    std::vector< INDEX_TYPE_NC > const oldOffsets( m_offsets.data(), m_offsets.data() + m_numArrays + 1 );
+
+    // const_cast needed until for RAJA bug.
+    RAJA::inclusive_scan< POLICY >( const_cast< INDEX_TYPE_NC * >( m_sizes.data() ),
+                                    const_cast< INDEX_TYPE_NC * >( m_sizes.data() + m_numArrays ),
+                                    m_offsets.data() + 1 );
+
+    // If the total size equals the total capacity there were no gaps and the offsets are unchanged.
+    if( m_offsets[ m_numArrays ] == oldOffsets[ m_numArrays ] )
+    { return; }
+
+    INDEX_TYPE_NC const * const originalOffsets = oldOffsets.data();
+    INDEX_TYPE const * const compressedOffsets = m_offsets.data();
+    SIZE_TYPE const * const sizes = m_sizes.data();
+    forEachArg( [this, originalOffsets, compressedOffsets, sizes] ( auto & buffer )
+    {
+      using U = typename std::remove_reference_t< decltype( buffer ) >::value_type;
+      std::ptrdiff_t const minParallelSize = max( bufferManipulation::PARALLEL_COPY_CHUNK_BYTES / std::ptrdiff_t( sizeof( U ) ),
+                                                  std::ptrdiff_t( 1 ) );
+
+      U * const values = buffer.data();
+      auto const relocateArray = [values, originalOffsets, compressedOffsets, sizes] ( INDEX_TYPE_NC const i )
+      {
+        arrayManipulation::uninitializedRelocate( values + compressedOffsets[ i ], sizes[ i ], values + originalOffsets[ i ] );
+      };
+
+      INDEX_TYPE_NC first = 0;
+      while( first < m_numArrays )
+      {
+        // The batch is first and every array whose new location ends at or before the old offset of first.
+        INDEX_TYPE const * const end = std::upper_bound( compressedOffsets + first + 1,
+                                                         compressedOffsets + m_numArrays + 1,
+                                                         originalOffsets[ first ] );
+        INDEX_TYPE_NC const last = max( first + 1, INDEX_TYPE_NC( end - compressedOffsets - 1 ) );
+
+        if( compressedOffsets[ last ] - compressedOffsets[ first ] < minParallelSize )
+        {
+          for( INDEX_TYPE_NC i = first; i < last; ++i )
+          { relocateArray( i ); }
+        }
+        else
+        {
+          RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE_NC >( first, last ), relocateArray );
+        }
+
+        first = last;
+      }
+    }, m_values, buffers ... );
+
+    registerSizes( buffers ... );
+  }
+
+  /**
+   * @brief Compress the arrays and release all of the unused capacity.
+   * @tparam BUFFERS variadic template where each type is a BUFFER_TYPE.
+   * @param buffers variadic parameter pack where each argument is a BUFFER_TYPE that should be treated
+   *   similarly to m_values.
+   * @note This is to be use by the non-view derived classes.
+   */
+  template< class ... BUFFERS >
+  void shrinkToFit( BUFFERS & ... buffers )
+  {
+    if( m_numArrays > 0 )
+    { compress( buffers ... ); }
+
+    INDEX_TYPE const offsetsSize = ( m_offsets.capacity() == 0 ) ? 0 : m_numArrays + 1;
+    INDEX_TYPE const numValues = ( m_numArrays == 0 ) ? 0 : m_offsets[ m_numArrays ];
+
+    bufferManipulation::shrinkToFit( m_offsets, offsetsSize );
+    bufferManipulation::shrinkToFit( m_sizes, m_numArrays );
+    forEachArg( [numValues] ( auto & buffer )
+    {
+      bufferManipulation::shrinkToFit( buffer, numValues );
+    }, m_values, buffers ... );
   }
 
   /**
@@ -715,10 +1004,12 @@ protected:
   template< class ... BUFFERS >
   void reserveValues( INDEX_TYPE const newValueCapacity, BUFFERS & ... buffers )
   {
-    INDEX_TYPE const maxOffset = m_offsets[ m_numArrays ];
-    forEachArg( [newValueCapacity, maxOffset] ( auto & buffer )
+    forEachArg( [this, newValueCapacity] ( auto & buffer )
     {
-      bufferManipulation::reserve( buffer, maxOffset, newValueCapacity );
+      if( newValueCapacity > buffer.capacity() )
+      {
+        setValueCapacity( buffer, m_offsets.data(), newValueCapacity );
+      }
     }, m_values, buffers ... );
   }
 
@@ -747,8 +1038,22 @@ protected:
       forEachArg(
         [this, i, maxOffset, capacityIncrease]( auto & buffer )
       {
+        using U = typename std::remove_reference_t< decltype( buffer ) >::value_type;
+
         // Increase the size of the buffer.
-        bufferManipulation::dynamicReserve( buffer, maxOffset, maxOffset + capacityIncrease );
+        if( maxOffset + capacityIncrease > buffer.capacity() )
+        {
+          setValueCapacity( buffer, m_offsets.data(),
+                            bufferManipulation::getGrowthPolicy().grow( maxOffset + capacityIncrease, sizeof( U ) ) );
+        }
+
+        // If the values are trivially relocatable the subsequent arrays can be shifted up all at once.
+        if( isTriviallyRelocatable< U > )
+        {
+          INDEX_TYPE const nextOffset = m_offsets[ i + 1 ];
+          arrayManipulation::uninitializedShiftUp( buffer.data() + nextOffset, maxOffset - nextOffset, capacityIncrease );
+          return;
+        }
 
         // Shift up the values.
         for( INDEX_TYPE array = m_numArrays - 1; array > i; --array )
@@ -773,9 +1078,20 @@ protected:
       forEachArg(
         [this, i, capacityDecrease, arrayOffset, newArraySize, prevArraySize] ( auto & buffer )
       {
+        using U = typename std::remove_reference_t< decltype( buffer ) >::value_type;
+
         // Delete the values at the end of the array.
         arrayManipulation::destroy( &buffer[ arrayOffset + newArraySize ], prevArraySize - newArraySize );
 
+        // If the values are trivially relocatable the subsequent arrays can be shifted down all at once.
+        if( isTriviallyRelocatable< U > )
+        {
+          INDEX_TYPE const nextOffset = m_offsets[ i + 1 ];
+          INDEX_TYPE const maxOffset = m_offsets[ m_numArrays ];
+          arrayManipulation::uninitializedShiftDown( buffer.data() + nextOffset, maxOffset - nextOffset, capacityDecrease );
+          return;
+        }
+
         // Shift down the values of subsequent arrays.
         for( INDEX_TYPE array = i + 1; array < m_numArrays; ++array )
         {
@@ -798,6 +1114,115 @@ protected:
     // when the ArrayOfArraysView gets copy constructed it doesn't get touched even though
     // it can then be modified via this method when called from a parent non-view class.
     m_offsets.registerTouch( MemorySpace::CPU );
+    registerSizes( buffers ... );
+  }
+
+  /**
+   * @brief Set the capacity of many arrays at once.
+   * @tparam BUFFERS variadic template where each type is a BUFFER_TYPE.
+   * @param numArraysToChange the number of arrays to set the capacity of.
+   * @param arrays the arrays to set the capacity of, of length @p numArraysToChange.
+   * @param newCapacities the new capacity of each array in @p arrays, of length @p numArraysToChange.
+   * @param maxCapacity the maximum capacity of an array, larger values in @p newCapacities are clamped.
+   * @param buffers variadic parameter pack where each argument is a BUFFER_TYPE that should be treated
+   *        similarly to m_values.
+   * @details Calling setCapacityOfArray for each array shifts all of the subsequent arrays every time, this
+   *   computes all the new offsets in one pass and then relocates each array at most once. The arrays that
+   *   move up are relocated from the back and then the arrays that move down are relocated from the front,
+   *   this way no array is overwritten before it has been moved. If an array appears more than once in
+   *   @p arrays the last capacity given is used.
+   * @note This is to be use by the non-view derived classes.
+   */
+  template< class ... BUFFERS >
+  void setCapacitiesOfArrays( INDEX_TYPE const numArraysToChange,
+                              INDEX_TYPE const * const arrays,
+                              INDEX_TYPE const * const newCapacities,
+                              INDEX_TYPE const maxCapacity,
+                              BUFFERS & ... buffers )
+  {
+    if( numArraysToChange == 0 ) return;
+
+    // Keep a copy of the current offsets and store the new capacity of array i in m_offsets[ i + 1 ].
+    std::vector< INDEX_TYPE_NC > const oldOffsets( m_offsets.data(), m_offsets.data() + m_numArrays + 1 );
+    for( INDEX_TYPE_NC i = 0; i < m_numArrays; ++i )
+    {
+      m_offsets[ i + 1 ] = oldOffsets[ i + 1 ] - oldOffsets[ i ];
+    }
+
+    for( INDEX_TYPE_NC j = 0; j < numArraysToChange; ++j )
+    {
+      INDEX_TYPE const i = arrays[ j ];
+      ARRAYOFARRAYS_CHECK_BOUNDS( i );
+      LVARRAY_ASSERT( arrayManipulation::isPositive( newCapacities[ j ] ) );
+      m_offsets[ i + 1 ] = min( newCapacities[ j ], maxCapacity );
+    }
+
+    // Destroy the values that no longer fit.
+    for( INDEX_TYPE_NC j = 0; j < numArraysToChange; ++j )
+    {
+      INDEX_TYPE const i = arrays[ j ];
+      INDEX_TYPE const newCapacity = m_offsets[ i + 1 ];
+      INDEX_TYPE const arraySize = sizeOfArray( i );
+      if( arraySize <= newCapacity ) continue;
+
+      INDEX_TYPE const arrayOffset = oldOffsets[ i ];
+      forEachArg( [arrayOffset, arraySize, newCapacity] ( auto & buffer )
+      {
+        arrayManipulation::destroy( &buffer[ arrayOffset + newCapacity ], arraySize - newCapacity );
+      }, m_values, buffers ... );
+
+      m_sizes[ i ] = newCapacity;
+    }
+
+    for( INDEX_TYPE_NC i = 0; i < m_numArrays; ++i )
+    {
+      m_offsets[ i + 1 ] += m_offsets[ i ];
+    }
+
+    INDEX_TYPE const * const shiftedOffsets = m_offsets.data();
+    INDEX_TYPE const newMaxOffset = m_offsets[ m_numArrays ];
+    forEachArg( [this, &oldOffsets, shiftedOffsets, newMaxOffset] ( auto & buffer )
+    {
+      using U = typename std::remove_reference_t< decltype( buffer ) >::value_type;
+
+      if( newMaxOffset > buffer.capacity() )
+      {
+        setValueCapacity( buffer, oldOffsets.data(), bufferManipulation::getGrowthPolicy().grow( newMaxOffset, sizeof( U ) ) );
+      }
+
+      // If the values are trivially relocatable adjacent arrays that move by the same amount
+      // are relocated all at once along with the unused capacity in between.
+      for( INDEX_TYPE_NC last = m_numArrays - 1; last >= 0; --last )
+      {
+        INDEX_TYPE const shift = shiftedOffsets[ last ] - oldOffsets[ last ];
+        if( shift <= 0 ) continue;
+
+        INDEX_TYPE_NC first = last;
+        while( isTriviallyRelocatable< U > && first > 0 && shiftedOffsets[ first - 1 ] - oldOffsets[ first - 1 ] == shift )
+        { --first; }
+
+        INDEX_TYPE const numValues = oldOffsets[ last ] + sizeOfArray( last ) - oldOffsets[ first ];
+        arrayManipulation::uninitializedShiftUp( buffer.data() + oldOffsets[ first ], numValues, shift );
+        last = first;
+      }
+
+      for( INDEX_TYPE_NC first = 0; first < m_numArrays; ++first )
+      {
+        INDEX_TYPE const shift = oldOffsets[ first ] - shiftedOffsets[ first ];
+        if( shift <= 0 ) continue;
+
+        INDEX_TYPE_NC last = first;
+        while( isTriviallyRelocatable< U > && last < m_numArrays - 1 && oldOffsets[ last + 1 ] - shiftedOffsets[ last + 1 ] == shift )
+        { ++last; }
+
+        INDEX_TYPE const numValues = oldOffsets[ last ] + sizeOfArray( last ) - oldOffsets[ first ];
+        arrayManipulation::uninitializedShiftDown( buffer.data() + oldOffsets[ first ], numValues, shift );
+        first = last;
+      }
+    }, m_values, buffers ... );
+
+    m_offsets.registerTouch( MemorySpace::CPU );
+    registerSizes( buffers ... );
   }
 
   /**
@@ -829,6 +1254,65 @@ protected:
 
 private:
 
+  /**
+   * @brief Give each buffer the number of values it holds, see bufferManipulation::registerSize.
+   * @tparam BUFFERS variadic template where each type is a BUFFER_TYPE.
+   * @param buffers variadic parameter pack where each argument is a BUFFER_TYPE that should be treated
+   *        similarly to m_values.
+   * @details The values of the arrays are counted up to their capacity, so the unused capacity of the
+   *   values buffers is only what lies beyond the last array.
+   */
+  template< class ... BUFFERS >
+  void registerSizes( BUFFERS & ... buffers )
+  {
+    bufferManipulation::registerSize( m_offsets, ( m_numArrays == 0 ) ? 0 : m_numArrays + 1 );
+    bufferManipulation::registerSize( m_sizes, m_numArrays );
+
+    INDEX_TYPE const maxOffset = ( m_numArrays == 0 ) ? 0 : m_offsets[ m_numArrays ];
+    forEachArg( [maxOffset] ( auto & buffer )
+    {
+      bufferManipulation::registerSize( buffer, maxOffset );
+    }, m_values, buffers ... );
+  }
+
+  /**
+   * @brief Set the capacity of a buffer that holds the values of the arrays.
+   * @tparam BUFFER the buffer type.
+   * @param buffer the buffer, either m_values or a buffer that should be treated similarly.
+   * @param offsets the offsets of the arrays in @p buffer, of length m_numArrays + 1.
+   * @param newCapacity the new capacity of @p buffer.
+   * @details A buffer relocates all of its values, but only the first m_sizes[ i ] values of array i are
+   *   constructed. If the values aren't trivially relocatable the unused capacity of each array can't be
+   *   relocated along with them so the arrays are relocated one at a time through a temporary buffer.
+   */
+  template< typename BUFFER >
+  void setValueCapacity( BUFFER & buffer, INDEX_TYPE const * const offsets, std::ptrdiff_t const newCapacity )
+  {
+    using U = typename BUFFER::value_type;
+
+    INDEX_TYPE const maxOffset = offsets[ m_numArrays ];
+    if( isTriviallyRelocatable< U > )
+    {
+      bufferManipulation::setCapacity( buffer, maxOffset, newCapacity );
+      return;
+    }
+
+    BUFFER tmp( true );
+    bufferManipulation::reserve( tmp, 0, maxOffset );
+    for( INDEX_TYPE_NC i = 0; i < m_numArrays; ++i )
+    {
+      arrayManipulation::uninitializedRelocate( tmp.data() + offsets[ i ], sizeOfArray( i ), buffer.data() + offsets[ i ] );
+    }
+
+    bufferManipulation::setCapacity( buffer, 0, newCapacity );
+    for( INDEX_TYPE_NC i = 0; i < m_numArrays; ++i )
+    {
+      arrayManipulation::uninitializedRelocate( buffer.data() + offsets[ i ], sizeOfArray( i ), tmp.data() + offsets[ i ] );
+    }
+
+    bufferManipulation::free( tmp, 0 );
+  }
+
   /**
    * @brief Destroy the values in arrays in the range [begin, end).
    * @tparam BUFFERS variadic template where each type is a BUFFER_TYPE.
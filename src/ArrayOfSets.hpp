@@ -23,14 +23,11 @@
 #pragma once
 
 #include "ArrayOfSetsView.hpp"
+#include "ArrayOfArrays.hpp"
 
 namespace LvArray
 {
 
-// Forward declaration of the ArrayOfArrays class so that we can define the assimilate method.
-template< typename T, typename INDEX_TYPE, template< typename > class BUFFER_TYPE >
-class ArrayOfArrays;
-
 
 /**
  * @class ArrayOfSets
@@ -103,15 +100,24 @@ public:
    * @brief Copy assignment operator, performs a deep copy.
    * @param src the ArrayOfSets to copy.
    * @return *this.
+   * @note If the buffers support sharing (see CopyOnWriteBuffer) both share the values read only,
+   *   either one has to be touched with move( MemorySpace::CPU ) before it is modified.
    */
   inline
   ArrayOfSets & operator=( ArrayOfSets const & src ) LVARRAY_RESTRICT_THIS
   {
-    ParentClass::setEqualTo( src.m_numArrays,
-                             src.m_offsets[ src.m_numArrays ],
-                             src.m_offsets,
-                             src.m_sizes,
-                             src.m_values );
+    if( !ParentClass::shareWith( src.m_numArrays,
+                                 src.m_offsets,
+                                 src.m_sizes,
+                                 src.m_values ) )
+    {
+      ParentClass::setEqualTo( src.m_numArrays,
+                               src.m_offsets[ src.m_numArrays ],
+                               src.m_offsets,
+                               src.m_sizes,
+                               src.m_values );
+    }
+
     return *this;
   }
 
@@ -163,11 +169,12 @@ public:
   { return ParentClass::size(); }
 
   /**
+   * @tparam POLICY The RAJA policy used to iterate over the sets, should NOT be a device policy.
    * @brief Steal the resources from an ArrayOfArrays and convert it to an ArrayOfSets.
    * @param src the ArrayOfArrays to convert.
    * @param desc describes the type of data in the source.
-   * @note This would be prime for omp parallelism.
    */
+  template< typename POLICY=RAJA::loop_exec >
   inline
   void assimilate( ArrayOfArrays< T, INDEX_TYPE, BUFFER_TYPE > && src,
                    sortedArrayManipulation::Description const desc ) LVARRAY_RESTRICT_THIS
@@ -178,16 +185,16 @@ public:
     INDEX_TYPE const numSets = size();
     if( desc == sortedArrayManipulation::UNSORTED_NO_DUPLICATES )
     {
-      for( INDEX_TYPE i = 0; i < numSets; ++i )
+      RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numSets ), [this] ( INDEX_TYPE const i )
       {
         T * const setValues = getSetValues( i );
         INDEX_TYPE const numValues = sizeOfSet( i );
         std::sort( setValues, setValues + numValues );
-      }
+      } );
     }
     if( desc == sortedArrayManipulation::SORTED_WITH_DUPLICATES )
     {
-      for( INDEX_TYPE i = 0; i < numSets; ++i )
+      RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numSets ), [this] ( INDEX_TYPE const i )
       {
         T * const setValues = getSetValues( i );
         INDEX_TYPE const numValues = sizeOfSet( i );
@@ -195,11 +202,11 @@ public:
         INDEX_TYPE const numUniqueValues = sortedArrayManipulation::removeDuplicates( setValues, setValues + numValues );
         arrayManipulation::resize( setValues, numValues, numUniqueValues );
         m_sizes[ i ] = numUniqueValues;
-      }
+      } );
     }
     if( desc == sortedArrayManipulation::UNSORTED_WITH_DUPLICATES )
     {
-      for( INDEX_TYPE i = 0; i < numSets; ++i )
+      RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numSets ), [this] ( INDEX_TYPE const i )
       {
         T * const setValues = getSetValues( i );
         INDEX_TYPE const numValues = sizeOfSet( i );
@@ -207,7 +214,7 @@ public:
         INDEX_TYPE const numUniqueValues = sortedArrayManipulation::makeSortedUnique( setValues, setValues + numValues );
         arrayManipulation::resize( setValues, numValues, numUniqueValues );
         m_sizes[ i ] = numUniqueValues;
-      }
+      } );
     }
 
 #ifdef ARRAY_BOUNDS_CHECK
@@ -215,6 +222,47 @@ public:
 #endif
   }
 
+  /**
+   * @tparam POLICY The RAJA policy used to iterate over the items and the sets.
+   *   Should NOT be a device policy.
+   * @tparam ATOMIC_POLICY The RAJA atomic policy used to count and append the values.
+   * @tparam FUNC The type of @p func.
+   * @brief Clears the sets and creates the given number of sets filled with the values produced by @p func.
+   * @param numSets The new number of sets.
+   * @param numItems The number of items to call @p func with.
+   * @param func The function that produces the values, see ArrayOfArrays::buildFromItems.
+   * @details The values are gathered with ArrayOfArrays::buildFromItems and then each set is sorted and its
+   *   duplicates are removed in parallel. Each set keeps the capacity it had before the duplicates were removed.
+   */
+  template< typename POLICY, typename ATOMIC_POLICY=RAJA::auto_atomic, typename FUNC >
+  void buildFromItems( INDEX_TYPE const numSets, INDEX_TYPE const numItems, FUNC && func ) LVARRAY_RESTRICT_THIS
+  {
+    ArrayOfArrays< T, INDEX_TYPE, BUFFER_TYPE > arrays;
+    arrays.template buildFromItems< POLICY, ATOMIC_POLICY >( numSets, numItems, std::forward< FUNC >( func ) );
+    assimilate< POLICY >( std::move( arrays ), sortedArrayManipulation::UNSORTED_WITH_DUPLICATES );
+  }
+
+  /**
+   * @tparam POLICY The RAJA policy used to iterate over the pairs and the sets.
+   *   Should NOT be a device policy.
+   * @tparam ATOMIC_POLICY The RAJA atomic policy used to count and append the values.
+   * @brief Clears the sets and creates the given number of sets where @p values[ j ] is inserted
+   *   into set @p sets[ j ].
+   * @param numSets The new number of sets.
+   * @param sets The set to insert each value into.
+   * @param values The values to insert, must be the same size as @p sets.
+   * @note See buildFromItems.
+   */
+  template< typename POLICY, typename ATOMIC_POLICY=RAJA::auto_atomic >
+  void buildFromPairs( INDEX_TYPE const numSets,
+                       ArraySlice< INDEX_TYPE const, 1, 0, INDEX_TYPE > const & sets,
+                       ArraySlice< T const, 1, 0, INDEX_TYPE > const & values ) LVARRAY_RESTRICT_THIS
+  {
+    ArrayOfArrays< T, INDEX_TYPE, BUFFER_TYPE > arrays;
+    arrays.template buildFromPairs< POLICY, ATOMIC_POLICY >( numSets, sets, values );
+    assimilate< POLICY >( std::move( arrays ), sortedArrayManipulation::UNSORTED_WITH_DUPLICATES );
+  }
+
   /**
    * @brief Clear a set.
    * @param i the index of the set to clear.
@@ -254,6 +302,21 @@ public:
   void setCapacityOfSet( INDEX_TYPE const i, INDEX_TYPE newCapacity ) LVARRAY_RESTRICT_THIS
   { ParentClass::setCapacityOfArray( i, newCapacity ); }
 
+  /**
+   * @brief Set the capacity of many sets at once, each set is relocated at most once.
+   * @param numSetsToChange the number of sets to set the capacity of.
+   * @param sets the sets to set the capacity of, of length @p numSetsToChange.
+   * @param newCapacities the new capacity of each set in @p sets, of length @p numSetsToChange.
+   */
+  inline
+  void setCapacitiesOfSets( INDEX_TYPE const numSetsToChange,
+                            INDEX_TYPE const * const sets,
+                            INDEX_TYPE const * const newCapacities ) LVARRAY_RESTRICT_THIS
+  {
+    ParentClass::setCapacitiesOfArrays( numSetsToChange, sets, newCapacities,
+                                        std::numeric_limits< INDEX_TYPE >::max() );
+  }
+
   /**
    * @brief Reserve space in a set.
    * @param i the set to reserve space in.
@@ -274,6 +337,24 @@ public:
   void compress() LVARRAY_RESTRICT_THIS
   { ParentClass::compress(); }
 
+  /**
+   * @tparam POLICY The RAJA policy used to relocate the sets.
+   * @brief Compress the sets in parallel, the values are relocated into a new allocation of the same capacity.
+   * @note This method doesn't free any memory.
+   */
+  template< typename POLICY >
+  inline
+  void compress() LVARRAY_RESTRICT_THIS
+  { ParentClass::template compress< POLICY >(); }
+
+  /**
+   * @brief Compress the sets and free all of the unused capacity.
+   * @note Inserting into any set afterwards requires a reallocation.
+   */
+  inline
+  void shrinkToFit() LVARRAY_RESTRICT_THIS
+  { ParentClass::shrinkToFit(); }
+
   /**
    * @brief Set the number of sets.
    * @param numSubSets The new number of sets.
@@ -84,6 +84,9 @@ DEFINE_GDB_PY_SCRIPT( "scripts/gdb-printers.py" );
 namespace LvArray
 {
 
+template< typename T, int NDIM, int USD, typename INDEX_TYPE >
+class SubArraySlice;
+
 /**
  * @class ArraySlice
  * @brief This class serves to provide a sliced multidimensional interface to the family of LvArray
@@ -93,6 +96,8 @@ namespace LvArray
  * @tparam USD the dimension with a unit stride, in an Array with a standard layout
  *         this is the last dimension.
  * @tparam INDEX_TYPE the integer to use for indexing the components of the array
+ * @tparam STRIDES a camp::idx_seq of the strides that are known at compile time, DYNAMIC_EXTENT for
+ *         the others. These strides are never loaded from memory, see StaticStrides.
  *
  * This class serves as a sliced interface to an array. This is a lightweight class that contains
  * only pointers, and provides an operator[] to create a lower dimensionsal slice and an operator()
@@ -101,12 +106,13 @@ namespace LvArray
  * In general, instantiations of ArraySlice should only result either taking a slice of an an Array or
  * an ArrayView via operator[] or from a direct creation via the toSlice/toSliceConst method.
  */
-template< typename T, int NDIM, int USD, typename INDEX_TYPE >
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES=DynamicStrides< NDIM > >
 class ArraySlice
 {
 public:
 
   static_assert( USD < NDIM, "USD must be less than NDIM." );
+  static_assert( getDimension( STRIDES {} ) == NDIM, "There must be a stride for each dimension." );
 
   /// The number of dimensions.
   static constexpr int ndim = NDIM;
@@ -138,9 +144,9 @@ public:
    */
   template< typename U=T >
   LVARRAY_HOST_DEVICE inline constexpr
-  ArraySlice< T const, NDIM, USD, INDEX_TYPE >
+  ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES >
   toSliceConst() const LVARRAY_RESTRICT_THIS noexcept
-  { return ArraySlice< T const, NDIM, USD, INDEX_TYPE >( m_data, m_dims, m_strides ); }
+  { return ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES >( m_data, m_dims, m_strides ); }
 
   /**
    * @brief @return Return a new immutable slice.
@@ -148,10 +154,21 @@ public:
   template< typename U=T >
   LVARRAY_HOST_DEVICE inline constexpr
   operator std::enable_if_t< !std::is_const< U >::value,
-                             ArraySlice< T const, NDIM, USD, INDEX_TYPE > >
+                             ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES > >
     () const LVARRAY_RESTRICT_THIS noexcept
   { return toSliceConst(); }
 
+  /**
+   * @brief @return Return a slice that loads every stride at runtime.
+   * @note This method is only active when some of the strides are known at compile time.
+   */
+  template< typename U=STRIDES >
+  LVARRAY_HOST_DEVICE inline constexpr
+  operator std::enable_if_t< !std::is_same< U, DynamicStrides< NDIM > >::value,
+                             ArraySlice< T, NDIM, USD, INDEX_TYPE > >
+    () const LVARRAY_RESTRICT_THIS noexcept
+  { return ArraySlice< T, NDIM, USD, INDEX_TYPE >( m_data, m_dims, m_strides ); }
+
   /**
    * @brief @return A raw pointer.
    * @note This method is only active when NDIM == 0 and USD == 0.
@@ -169,13 +186,14 @@ public:
    */
   template< int U=NDIM >
   LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
-  std::enable_if_t< (U > 1), ArraySlice< T, NDIM - 1, USD - 1, INDEX_TYPE > >
+  std::enable_if_t< (U > 1), ArraySlice< T, NDIM - 1, USD - 1, INDEX_TYPE, PopFront< STRIDES > > >
   operator[]( INDEX_TYPE const index ) const noexcept LVARRAY_RESTRICT_THIS
   {
     ARRAY_SLICE_CHECK_BOUNDS( index );
-    return ArraySlice< T, NDIM-1, USD-1, INDEX_TYPE >( m_data + ConditionalMultiply< USD == 0 >::multiply( index, m_strides[ 0 ] ),
-                                                       m_dims + 1,
-                                                       m_strides + 1 );
+    return ArraySlice< T, NDIM-1, USD-1, INDEX_TYPE, PopFront< STRIDES > >(
+      m_data + multiplyByStride< firstStaticStride< USD, STRIDES > >( index, m_strides ),
+      m_dims + 1,
+      m_strides + 1 );
   }
 
   /**
@@ -189,7 +207,7 @@ public:
   operator[]( INDEX_TYPE const index ) const noexcept LVARRAY_RESTRICT_THIS
   {
     ARRAY_SLICE_CHECK_BOUNDS( index );
-    return m_data[ ConditionalMultiply< USD == 0 >::multiply( index, m_strides[ 0 ] ) ];
+    return m_data[ multiplyByStride< firstStaticStride< USD, STRIDES > >( index, m_strides ) ];
   }
 
   /**
@@ -218,7 +236,42 @@ public:
 #ifdef USE_ARRAY_BOUNDS_CHECK
     checkIndices( m_dims, indices ... );
 #endif
-    return getLinearIndex< USD >( m_strides, indices ... );
+    return getLinearIndex< USD, STRIDES >( m_strides, indices ... );
+  }
+
+  /**
+   * @tparam DIM The dimension to restrict.
+   * @brief @return Return a slice of the indices [ @p begin, @p end ) of dimension @p DIM, no values are copied.
+   * @param begin The first index of the range.
+   * @param end One past the last index of the range.
+   * @note The returned SubArraySlice holds its own dimensions and strides, if the range is contiguous
+   *   so is the result (see isContiguous).
+   */
+  template< int DIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  SubArraySlice< T, NDIM, USD, INDEX_TYPE >
+  subRange( INDEX_TYPE const begin, INDEX_TYPE const end ) const LVARRAY_RESTRICT_THIS
+  {
+    static_assert( DIM >= 0 && DIM < NDIM, "DIM must be a dimension of the slice." );
+    return SubArraySlice< T, NDIM, USD, INDEX_TYPE >( *this, DIM, begin, end, 1 );
+  }
+
+  /**
+   * @tparam DIM The dimension to restrict.
+   * @brief @return Return a slice of every @p step index in [ @p begin, @p end ) of dimension @p DIM,
+   *   no values are copied.
+   * @param begin The first index of the range.
+   * @param end One past the last index of the range.
+   * @param step The distance between consecutive indices of the range, must be positive.
+   * @note If @p DIM is the unit stride dimension it no longer has a unit stride so the result doesn't have one.
+   */
+  template< int DIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  SubArraySlice< T, NDIM, ( DIM == USD ) ? -1 : USD, INDEX_TYPE >
+  subRange( INDEX_TYPE const begin, INDEX_TYPE const end, INDEX_TYPE const step ) const LVARRAY_RESTRICT_THIS
+  {
+    static_assert( DIM >= 0 && DIM < NDIM, "DIM must be a dimension of the slice." );
+    return SubArraySlice< T, NDIM, ( DIM == USD ) ? -1 : USD, INDEX_TYPE >( *this, DIM, begin, end, step );
   }
 
   /**
@@ -241,6 +294,19 @@ public:
     return m_dims[dim];
   }
 
+  /**
+   * @brief @return Return the stride of the given dimension.
+   * @param dim the dimension to get the stride of.
+   */
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  INDEX_TYPE stride( int dim ) const noexcept
+  {
+#ifdef USE_ARRAY_BOUNDS_CHECK
+    LVARRAY_ERROR_IF_GE( dim, NDIM );
+#endif
+    return dim == USD ? 1 : m_strides[dim];
+  }
+
   /**
    * @brief @return Return true iff the @p ptr matches the data pointer of this ArraySlice.
    * @param ptr The pointer to check.
@@ -346,6 +412,193 @@ protected:
   /// pointer to array of length NDIM that contains the strides of each array dimension
   INDEX_TYPE const * const LVARRAY_RESTRICT m_strides;
 
+  template< typename, int, int, typename >
+  friend class SubArraySlice;
+};
+
+/**
+ * @class SubArraySlice
+ * @brief A slice of a range of indices of an ArraySlice, it is created by ArraySlice::subRange.
+ * @tparam T type of data that is contained by the array.
+ * @tparam NDIM number of dimensions in array.
+ * @tparam USD the dimension with a unit stride, negative if there is none.
+ * @tparam INDEX_TYPE the integer to use for indexing the components of the array.
+ * @details Unlike an ArraySlice which points to the dimensions and strides of the array it came from
+ *   a SubArraySlice holds them by value, so it can outlive the slice it was created from but not the
+ *   values. Everything other than indexing goes through toSlice(), which returns an ArraySlice pointing
+ *   into this object. Therefore toSlice() and operator[] can't be called on a temporary.
+ */
+template< typename T, int NDIM, int USD, typename INDEX_TYPE >
+class SubArraySlice
+{
+public:
+
+  /// The number of dimensions.
+  static constexpr int ndim = NDIM;
+
+  /// The type of the ArraySlice of this SubArraySlice.
+  using SliceType = ArraySlice< T, NDIM, USD, INDEX_TYPE >;
+
+  /**
+   * @tparam SRC_USD The unit stride dimension of @p src.
+   * @tparam STRIDES The static strides of @p src.
+   * @brief Construct a SubArraySlice of @p src, see ArraySlice::subRange.
+   * @param src The slice to take a range of.
+   * @param dim The dimension to restrict.
+   * @param begin The first index of the range.
+   * @param end One past the last index of the range.
+   * @param step The distance between consecutive indices of the range.
+   */
+  template< int SRC_USD, typename STRIDES >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  SubArraySlice( ArraySlice< T, NDIM, SRC_USD, INDEX_TYPE, STRIDES > const & src,
+                 int const dim,
+                 INDEX_TYPE const begin,
+                 INDEX_TYPE const end,
+                 INDEX_TYPE const step ):
+    m_data( src.m_data ),
+    m_dims{ 0 },
+    m_strides{ 0 }
+  {
+#ifdef USE_ARRAY_BOUNDS_CHECK
+    LVARRAY_ERROR_IF( dim < 0 || dim >= NDIM, "Invalid dimension " << dim );
+    LVARRAY_ERROR_IF( begin < 0 || begin > end || end > src.m_dims[ dim ],
+                      "Invalid range [" << begin << ", " << end << ") of dimension " << dim <<
+                      " which is of length " << src.m_dims[ dim ] );
+#endif
+    LVARRAY_ASSERT_GT( step, 0 );
+
+    for( int i = 0; i < NDIM; ++i )
+    {
+      m_dims[ i ] = src.m_dims[ i ];
+
+      // The stride of the unit stride dimension may not be stored.
+      m_strides[ i ] = ( i == SRC_USD ) ? 1 : src.m_strides[ i ];
+    }
+
+    m_data += begin * m_strides[ dim ];
+    m_dims[ dim ] = ( end - begin + step - 1 ) / step;
+    m_strides[ dim ] *= step;
+  }
+
+  /**
+   * @brief @return Return an ArraySlice of the range.
+   * @note The slice points to the dimensions and strides of this object.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  SliceType toSlice() const & noexcept
+  { return SliceType( m_data, m_dims, m_strides ); }
+
+  /// Deleted since the result would point to the dimensions and strides of a temporary.
+  SliceType toSlice() const && = delete;
+
+  /**
+   * @brief @return Return an ArraySlice of the range.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  operator SliceType() const & noexcept
+  { return toSlice(); }
+
+  /**
+   * @brief @return Return a lower dimensional slice of the range, or a value when NDIM == 1.
+   * @param index The index of the slice to create.
+   */
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  decltype( auto ) operator[]( INDEX_TYPE const index ) const & noexcept
+  { return toSlice()[ index ]; }
+
+  /// Deleted since the result would point to the dimensions and strides of a temporary.
+  void operator[]( INDEX_TYPE const index ) const && = delete;
+
+  /**
+   * @tparam INDICES A variadic pack of integral types.
+   * @brief @return Return a reference to the value at the given multidimensional index.
+   * @param indices The indices of the value to access.
+   */
+  template< typename ... INDICES >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T & operator()( INDICES... indices ) const
+  { return toSlice()( indices ... ); }
+
+  /**
+   * @tparam DIM The dimension to restrict.
+   * @brief @return Return a further restricted SubArraySlice, see ArraySlice::subRange.
+   * @param begin The first index of the range.
+   * @param end One past the last index of the range.
+   */
+  template< int DIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  SubArraySlice subRange( INDEX_TYPE const begin, INDEX_TYPE const end ) const
+  { return toSlice().template subRange< DIM >( begin, end ); }
+
+  /**
+   * @tparam DIM The dimension to restrict.
+   * @brief @return Return a further restricted SubArraySlice, see ArraySlice::subRange.
+   * @param begin The first index of the range.
+   * @param end One past the last index of the range.
+   * @param step The distance between consecutive indices of the range, must be positive.
+   */
+  template< int DIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  SubArraySlice< T, NDIM, ( DIM == USD ) ? -1 : USD, INDEX_TYPE >
+  subRange( INDEX_TYPE const begin, INDEX_TYPE const end, INDEX_TYPE const step ) const
+  { return toSlice().template subRange< DIM >( begin, end, step ); }
+
+  /**
+   * @brief @return Return the total size of the range.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  INDEX_TYPE size() const noexcept
+  { return multiplyAll< NDIM >( m_dims ); }
+
+  /**
+   * @brief @return Return the length of the given dimension.
+   * @param dim the dimension to get the length of.
+   */
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  INDEX_TYPE size( int const dim ) const noexcept
+  { return toSlice().size( dim ); }
+
+  /**
+   * @brief @return Return true iff the range is contiguous in memory, see ArraySlice::isContiguous.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  bool isContiguous() const
+  { return toSlice().isContiguous(); }
+
+  /**
+   * @brief @return Return a pointer to the values.
+   * @pre The range must be contiguous.
+   */
+  LVARRAY_HOST_DEVICE inline
+  T * dataIfContiguous() const
+  { return toSlice().dataIfContiguous(); }
+
+  /**
+   * @brief @return Return a pointer to the values.
+   * @pre The range must be contiguous.
+   */
+  LVARRAY_HOST_DEVICE inline
+  T * begin() const
+  { return dataIfContiguous(); }
+
+  /**
+   * @brief @return Return a pointer to the end of the values.
+   * @pre The range must be contiguous.
+   */
+  LVARRAY_HOST_DEVICE inline
+  T * end() const
+  { return dataIfContiguous() + size(); }
+
+private:
+  /// pointer to the first value of the range.
+  T * m_data;
+
+  /// the lengths of each dimension.
+  INDEX_TYPE m_dims[ NDIM ];
+
+  /// the strides of each dimension.
+  INDEX_TYPE m_strides[ NDIM ];
 };
 
 } // namespace LvArray
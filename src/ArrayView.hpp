@@ -51,6 +51,8 @@ namespace LvArray
  * @tparam INDEX_TYPE the integer to use for indexing.
  * @tparam BUFFER_TYPE A class that defines how to actually allocate memory for the Array. Must take
  *         one template argument that describes the type of the data being stored (T).
+ * @tparam STRIDES a camp::idx_seq of the strides that are known at compile time, DYNAMIC_EXTENT for
+ *         the others, see StaticStrides.
  *
  * When using CHAI the copy copy constructor of this class calls the copy constructor for CHAI
  * which will move the data to the location of the touch (host or device). In general, the
@@ -75,29 +77,34 @@ template< typename T,
           int NDIM,
           int USD,
           typename INDEX_TYPE,
-          template< typename > class BUFFER_TYPE >
+          template< typename > class BUFFER_TYPE,
+          typename STRIDES=DynamicStrides< NDIM > >
 class ArrayView
 {
 public:
 
   static_assert( USD >= 0, "USD must be positive." );
   static_assert( USD < NDIM, "USD must be less than NDIM." );
+  static_assert( getDimension( STRIDES {} ) == NDIM, "There must be a stride for each dimension." );
 
   /// The number of dimensions.
   static constexpr int ndim = NDIM;
 
+  /// The alignment in bytes of data(), as guaranteed by the buffer type.
+  static constexpr std::size_t alignment = bufferManipulation::Alignment< BUFFER_TYPE< T > >::value;
+
   /// The type when all inner array classes are converted to const views.
-  using ViewType = ArrayView< typename GetViewType< T >::type, NDIM, USD, INDEX_TYPE, BUFFER_TYPE > const;
+  using ViewType = ArrayView< typename GetViewType< T >::type, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES > const;
 
   /// The type when all inner array classes are converted to const views and the inner most view's values are also
   /// const.
-  using ViewTypeConst = ArrayView< typename GetViewTypeConst< T >::type const, NDIM, USD, INDEX_TYPE, BUFFER_TYPE > const;
+  using ViewTypeConst = ArrayView< typename GetViewTypeConst< T >::type const, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES > const;
 
   /// The type of the ArrayView when converted to an ArraySlice.
-  using SliceType = ArraySlice< T, NDIM, USD, INDEX_TYPE > const;
+  using SliceType = ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const;
 
   /// The type of the ArrayView when converted to an immutable ArraySlice.
-  using SliceTypeConst = ArraySlice< T const, NDIM, USD, INDEX_TYPE > const;
+  using SliceTypeConst = ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES > const;
 
   /// The type of the value in the ArraySlice.
   using value_type = T;
@@ -269,24 +276,24 @@ public:
    * @brief @return Return an ArraySlice representing this ArrayView.
    */
   inline LVARRAY_HOST_DEVICE constexpr
-  ArraySlice< T, NDIM, USD, INDEX_TYPE >
+  ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES >
   toSlice() const noexcept
-  { return ArraySlice< T, NDIM, USD, INDEX_TYPE >( data(), m_dims, m_strides ); }
+  { return ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES >( data(), m_dims, m_strides ); }
 
   /**
    * @brief @return Return an immutable ArraySlice representing this ArrayView.
    */
   template< typename U=T >
   inline LVARRAY_HOST_DEVICE constexpr
-  ArraySlice< T const, NDIM, USD, INDEX_TYPE >
+  ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES >
   toSliceConst() const noexcept
-  { return ArraySlice< T const, NDIM, USD, INDEX_TYPE >( data(), m_dims, m_strides ); }
+  { return ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES >( data(), m_dims, m_strides ); }
 
   /**
    * @brief @return Return an ArraySlice representing this ArrayView.
    */
   inline LVARRAY_HOST_DEVICE constexpr
-  operator ArraySlice< T, NDIM, USD, INDEX_TYPE >() const noexcept
+  operator ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES >() const noexcept
   { return toSlice(); }
 
   /**
@@ -295,10 +302,36 @@ public:
   template< typename U=T >
   inline LVARRAY_HOST_DEVICE constexpr
   operator std::enable_if_t< !std::is_const< U >::value,
-                             ArraySlice< T const, NDIM, USD, INDEX_TYPE > const >
+                             ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES > const >
     () const noexcept
   { return toSliceConst(); }
 
+  /**
+   * @tparam DIM The dimension to restrict.
+   * @brief @return Return a slice of the indices [ @p begin, @p end ) of dimension @p DIM, see ArraySlice::subRange.
+   * @param begin The first index of the range.
+   * @param end One past the last index of the range.
+   */
+  template< int DIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  SubArraySlice< T, NDIM, USD, INDEX_TYPE >
+  subRange( INDEX_TYPE const begin, INDEX_TYPE const end ) const
+  { return toSlice().template subRange< DIM >( begin, end ); }
+
+  /**
+   * @tparam DIM The dimension to restrict.
+   * @brief @return Return a slice of every @p step index in [ @p begin, @p end ) of dimension @p DIM,
+   *   see ArraySlice::subRange.
+   * @param begin The first index of the range.
+   * @param end One past the last index of the range.
+   * @param step The distance between consecutive indices of the range, must be positive.
+   */
+  template< int DIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  SubArraySlice< T, NDIM, ( DIM == USD ) ? -1 : USD, INDEX_TYPE >
+  subRange( INDEX_TYPE const begin, INDEX_TYPE const end, INDEX_TYPE const step ) const
+  { return toSlice().template subRange< DIM >( begin, end, step ); }
+
   /**
    * @brief @return Return the allocated size.
    */
@@ -363,13 +396,14 @@ public:
    */
   template< int U=NDIM >
   LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
-  std::enable_if_t< (U > 1), ArraySlice< T, NDIM - 1, USD - 1, INDEX_TYPE > >
+  std::enable_if_t< (U > 1), ArraySlice< T, NDIM - 1, USD - 1, INDEX_TYPE, PopFront< STRIDES > > >
   operator[]( INDEX_TYPE const index ) const noexcept LVARRAY_RESTRICT_THIS
   {
     ARRAY_SLICE_CHECK_BOUNDS( index );
-    return ArraySlice< T, NDIM-1, USD-1, INDEX_TYPE >( data() + ConditionalMultiply< USD == 0 >::multiply( index, m_strides[ 0 ] ),
-                                                       m_dims + 1,
-                                                       m_strides + 1 );
+    return ArraySlice< T, NDIM-1, USD-1, INDEX_TYPE, PopFront< STRIDES > >(
+      data() + multiplyByStride< firstStaticStride< USD, STRIDES > >( index, m_strides ),
+      m_dims + 1,
+      m_strides + 1 );
   }
 
   /**
@@ -383,7 +417,7 @@ public:
   operator[]( INDEX_TYPE const index ) const noexcept LVARRAY_RESTRICT_THIS
   {
     ARRAY_SLICE_CHECK_BOUNDS( index );
-    return data()[ ConditionalMultiply< USD == 0 >::multiply( index, m_strides[ 0 ] ) ];
+    return data()[ multiplyByStride< firstStaticStride< USD, STRIDES > >( index, m_strides ) ];
   }
 
   /**
@@ -412,7 +446,7 @@ public:
 #ifdef USE_ARRAY_BOUNDS_CHECK
     checkIndices( m_dims, indices ... );
 #endif
-    return getLinearIndex< USD >( m_strides, indices ... );
+    return getLinearIndex< USD, STRIDES >( m_strides, indices ... );
   }
 
   ///***********************************************************************************************
@@ -426,6 +460,15 @@ public:
   T * data() const
   { return m_dataBuffer.data(); }
 
+  /**
+   * @brief @return Return a pointer to the values that the compiler may assume is aligned to @c alignment bytes.
+   * @note This only helps vectorization when the buffer type provides more alignment than alignof( T ),
+   *   for example AlignedBuffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  T * alignedData() const
+  { return LVARRAY_ASSUME_ALIGNED( data(), alignment ); }
+
   /**
    * @brief @return A pointer to the array containing the size of each dimension.
    */
@@ -111,17 +111,47 @@ public:
    * @brief Copy assignment operator, performs a deep copy.
    * @param src the CRSMatrix to copy.
    * @return *this.
+   * @note If the buffers support sharing (see CopyOnWriteBuffer) both share the values read only,
+   *   either one has to be touched with move( MemorySpace::CPU ) before it is modified.
    */
   inline
   CRSMatrix & operator=( CRSMatrix const & src ) LVARRAY_RESTRICT_THIS
   {
     m_numCols = src.m_numCols;
-    ParentClass::setEqualTo( src.m_numArrays,
-                             src.m_offsets[ src.m_numArrays ],
-                             src.m_offsets,
-                             src.m_sizes,
-                             src.m_values,
-                             typename ParentClass::template PairOfBuffers< T >( m_entries, src.m_entries ) );
+    if( !ParentClass::shareWith( src.m_numArrays,
+                                 src.m_offsets,
+                                 src.m_sizes,
+                                 src.m_values,
+                                 typename ParentClass::template PairOfBuffers< T >( m_entries, src.m_entries ) ) )
+    {
+      ParentClass::setEqualTo( src.m_numArrays,
+                               src.m_offsets[ src.m_numArrays ],
+                               src.m_offsets,
+                               src.m_sizes,
+                               src.m_values,
+                               typename ParentClass::template PairOfBuffers< T >( m_entries, src.m_entries ) );
+    }
+
+    return *this;
+  }
+
+  /**
+   * @tparam POLICY The RAJA policy used to copy the columns and entries, should NOT be a device policy.
+   * @brief Perform a deep copy of @p src, copying the columns and entries in parallel.
+   * @param src the CRSMatrix to copy.
+   * @return *this.
+   * @details If @p src is compressed the columns and entries are each copied in one pass.
+   */
+  template< typename POLICY >
+  CRSMatrix & copyFrom( CRSMatrix const & src ) LVARRAY_RESTRICT_THIS
+  {
+    m_numCols = src.m_numCols;
+    ParentClass::template setEqualTo< POLICY >( src.m_numArrays,
+                                                src.m_offsets[ src.m_numArrays ],
+                                                src.m_offsets,
+                                                src.m_sizes,
+                                                src.m_values,
+                                                typename ParentClass::template PairOfBuffers< T >( m_entries, src.m_entries ) );
     return *this;
   }
 
@@ -170,6 +200,33 @@ public:
     setName( "" );
   }
 
+  /**
+   * @brief Replace the contents with the matrix held by the given buffers.
+   * @param nRows The number of rows held by the buffers.
+   * @param nCols The number of columns in the matrix.
+   * @param offsets The offsets of the rows, must hold at least @p nRows + 1 values.
+   * @param sizes The number of non zeros in each row, must hold at least @p nRows values.
+   * @param columns The column indices of the non zeros, sorted and unique in each row.
+   * @param entries The entries of the non zeros, the same size as @p columns.
+   * @details Nothing is copied, so with MmapBuffers opened on the files of a saved CRSMatrix
+   *   this reopens it in constant time.
+   */
+  void adoptBuffers( INDEX_TYPE const nRows,
+                     INDEX_TYPE const nCols,
+                     BUFFER_TYPE< INDEX_TYPE > && offsets,
+                     BUFFER_TYPE< INDEX_TYPE > && sizes,
+                     BUFFER_TYPE< COL_TYPE > && columns,
+                     BUFFER_TYPE< T > && entries )
+  {
+    LVARRAY_ERROR_IF( !arrayManipulation::isPositive( nCols ), "nCols must be positive." );
+    LVARRAY_ERROR_IF_LT_MSG( entries.capacity(), columns.capacity(), "The entries buffer is too small." );
+
+    ParentClass::free( m_entries );
+    ParentClass::adoptBuffers( nRows, std::move( offsets ), std::move( sizes ), std::move( columns ) );
+    m_entries = std::move( entries );
+    m_numCols = nCols;
+  }
+
   /**
    * @brief @return A reference to *this reinterpreted as a CRSMatrixView< T, COL_TYPE, INDEX_TYPE const >.
    */
@@ -270,6 +327,20 @@ public:
     ParentClass::setCapacityOfArray( row, newCapacity, m_entries );
   }
 
+  /**
+   * @brief Set the non zero capacity of many rows at once, each row is relocated at most once.
+   * @param numRowsToChange the number of rows to modify.
+   * @param rows the rows to modify, of length @p numRowsToChange.
+   * @param newCapacities the new capacity of each row in @p rows, of length @p numRowsToChange.
+   * @note As with setRowCapacity the entries of a row are truncated if its new capacity is less than
+   *       its number of non zero entries, and a capacity greater than numColumns() is clamped.
+   */
+  inline
+  void setRowCapacities( INDEX_TYPE const numRowsToChange,
+                         INDEX_TYPE const * const rows,
+                         INDEX_TYPE const * const newCapacities ) LVARRAY_RESTRICT_THIS
+  { ParentClass::setCapacitiesOfArrays( numRowsToChange, rows, newCapacities, numColumns(), m_entries ); }
+
   /**
    * @brief Compress the CRSMatrix so that the non-zeros and values of each row
    *        are contiguous with no extra capacity in between.
@@ -279,6 +350,25 @@ public:
   void compress() LVARRAY_RESTRICT_THIS
   { ParentClass::compress( m_entries ); }
 
+  /**
+   * @tparam POLICY The RAJA policy used to relocate the rows.
+   * @brief Compress the CRSMatrix in parallel, the columns and entries are relocated into new
+   *        allocations of the same capacity.
+   * @note This method doesn't free any memory.
+   */
+  template< typename POLICY >
+  inline
+  void compress() LVARRAY_RESTRICT_THIS
+  { ParentClass::template compress< POLICY >( m_entries ); }
+
+  /**
+   * @brief Compress the CRSMatrix and free all of the unused capacity of the columns and entries.
+   * @note Inserting a non-zero afterwards requires a reallocation.
+   */
+  inline
+  void shrinkToFit() LVARRAY_RESTRICT_THIS
+  { ParentClass::shrinkToFit( m_entries ); }
+
   /**
    * @brief Set the dimensions of the matrix.
    * @param nRows the new number of rows.
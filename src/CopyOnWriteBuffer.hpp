@@ -0,0 +1,489 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "LvArrayConfig.hpp"
+#include "Macros.hpp"
+#include "bufferManipulation.hpp"
+#include "AllocationRegistry.hpp"
+
+// System includes
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+
+namespace LvArray
+{
+
+/**
+ * @class CopyOnWriteBuffer
+ * @brief Implements the Buffer interface with reference counted storage that is shared between snapshots.
+ * @tparam T type of data that is contained in the buffer, must be trivially copyable.
+ * @details Assigning one container to another that both use a CopyOnWriteBuffer is O(1), the destination
+ *   shares the allocations of the source (see share()). This holds for Array, ArrayOfArrays, ArrayOfSets,
+ *   SparsityPattern and CRSMatrix. Sharing an allocation makes its pages read only, for every buffer and
+ *   view that references it. Writing to the values through a view or a pointer obtained earlier is then a
+ *   segmentation fault instead of a silent change to the snapshot.
+ *
+ *   To write to the values again the buffer has to be touched, either with move( MemorySpace::CPU, true )
+ *   on the owning container or implicitly by the bufferManipulation mutators and the non-const data()
+ *   and operator[]. Touching an owning buffer whose allocation is still shared copies the values into a
+ *   private writable allocation, if the other references have been released the pages are just made
+ *   writable again. A view can only be touched if its allocation is no longer shared. The const
+ *   accessors never detach so concurrent reads are always safe. Reallocation always produces a private
+ *   writable allocation.
+ *
+ *   Like MallocBuffer the copy constructor and copy assignment operator perform a shallow copy, the copy
+ *   is an alias that doesn't hold a reference.
+ *
+ *   The allocation registry charges an allocation to the name of the buffer that allocated it until the
+ *   last reference is released, so sharing doesn't add to the capacity of the snapshot's name while its
+ *   values still count as in use.
+ * @note Allocations are rounded up to a whole number of pages, so this is meant for large arrays.
+ * @note The parent class bufferManipulation::VoidBuffer provides the default execution space related methods.
+ * @note This buffer is host only.
+ */
+template< typename T >
+class CopyOnWriteBuffer : public bufferManipulation::VoidBuffer
+{
+public:
+  static_assert( std::is_trivially_copyable< T >::value, "The CopyOnWriteBuffer can only hold trivially copyable types." );
+
+  /// Alias used in the bufferManipulation functions.
+  using value_type = T;
+
+  /// Signifies that the CopyOnWriteBuffer's copy semantics are shallow.
+  static constexpr bool hasShallowCopy = true;
+
+  /**
+   * @brief Constructor for creating an empty or uninitialized buffer.
+   * @note An uninitialized CopyOnWriteBuffer is equivalent to an empty CopyOnWriteBuffer and does
+   *   not need to be free'd.
+   */
+  inline
+  CopyOnWriteBuffer( bool=true ):
+    m_data( nullptr ),
+    m_header( nullptr ),
+    m_capacity( 0 ),
+    m_isOwner( true ),
+    m_registration()
+  {}
+
+  /**
+   * @brief Copy constructor, creates a shallow copy that doesn't hold a reference.
+   * @param src The buffer to be copied.
+   */
+  inline
+  CopyOnWriteBuffer( CopyOnWriteBuffer const & src ):
+    m_data( src.m_data ),
+    m_header( src.m_header ),
+    m_capacity( src.m_capacity ),
+    m_isOwner( false ),
+    m_registration( src.m_registration )
+  {}
+
+  /**
+   * @brief Sized copy constructor, creates a shallow copy that doesn't hold a reference.
+   * @param src The buffer to be copied.
+   */
+  inline
+  CopyOnWriteBuffer( CopyOnWriteBuffer const & src, std::ptrdiff_t ):
+    CopyOnWriteBuffer( src )
+  {}
+
+  /**
+   * @brief Move constructor, takes the allocation and ownership of @p src.
+   * @param src The buffer to be moved from, is empty after the move.
+   */
+  inline
+  CopyOnWriteBuffer( CopyOnWriteBuffer && src ):
+    m_data( src.m_data ),
+    m_header( src.m_header ),
+    m_capacity( src.m_capacity ),
+    m_isOwner( src.m_isOwner ),
+    m_registration( src.m_registration )
+  {
+    src.m_data = nullptr;
+    src.m_header = nullptr;
+    src.m_capacity = 0;
+    src.m_registration = allocationRegistry::Registration();
+  }
+
+  /**
+   * @brief Copy assignment operator, creates a shallow copy that doesn't hold a reference.
+   * @param src The buffer to be copied.
+   * @return *this.
+   */
+  inline
+  CopyOnWriteBuffer & operator=( CopyOnWriteBuffer const & src )
+  {
+    m_data = src.m_data;
+    m_header = src.m_header;
+    m_capacity = src.m_capacity;
+    m_isOwner = false;
+    m_registration = src.m_registration;
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator, takes the allocation and ownership of @p src.
+   * @param src The buffer to be moved from, is empty after the move.
+   * @return *this.
+   */
+  inline
+  CopyOnWriteBuffer & operator=( CopyOnWriteBuffer && src )
+  {
+    m_data = src.m_data;
+    m_header = src.m_header;
+    m_capacity = src.m_capacity;
+    m_isOwner = src.m_isOwner;
+    m_registration = src.m_registration;
+    src.m_data = nullptr;
+    src.m_header = nullptr;
+    src.m_capacity = 0;
+    src.m_registration = allocationRegistry::Registration();
+    return *this;
+  }
+
+  /**
+   * @brief Reallocate the buffer to the new capacity, the new allocation is private and writable.
+   * @param size The number of values that are initialized in the buffer.
+   * @param newCapacity The new capacity of the buffer.
+   */
+  void reallocate( std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+  {
+    Header * newHeader = nullptr;
+    T * const newData = allocate( newCapacity, newHeader );
+    std::ptrdiff_t const overlapAmount = std::min( newCapacity, size );
+    if( overlapAmount > 0 )
+    { std::memcpy( const_cast< std::remove_const_t< T > * >( newData ), m_data, overlapAmount * sizeof( T ) ); }
+
+    // If this buffer was charged for the allocation it released this is a reallocation, otherwise a new allocation.
+    int const oldId = ( m_isOwner && m_data != nullptr ) ? m_header->registryId : 0;
+    std::size_t const oldBytes = ( m_isOwner && m_data != nullptr && release() ) ? numBytes( m_capacity ) : 0;
+    if( oldId == m_registration.id() )
+    {
+      m_registration.reallocate( oldBytes, numBytes( newCapacity ), oldBytes == 0 ? 0 : overlapAmount * sizeof( T ) );
+    }
+    else
+    {
+      allocationRegistry::recordReallocation( oldId, oldBytes, 0, 0 );
+      m_registration.reallocate( 0, numBytes( newCapacity ), 0 );
+    }
+
+    m_data = newData;
+    m_header = newHeader;
+    m_capacity = newCapacity;
+    m_isOwner = true;
+  }
+
+  /**
+   * @brief Release the reference to the allocation, it is freed when no other buffer references it.
+   * @note The values are trivially destructible so bufferManipulation::free does the same.
+   * @note If a single reference remains its pages stay read only until it is touched.
+   */
+  void free()
+  {
+    if( m_isOwner && m_data != nullptr )
+    {
+      int const id = m_header->registryId;
+      if( release() )
+      { allocationRegistry::recordReallocation( id, numBytes( m_capacity ), 0, 0 ); }
+    }
+
+    m_registration.setSize( 0 );
+    m_data = nullptr;
+    m_header = nullptr;
+    m_capacity = 0;
+  }
+
+  /**
+   * @brief Release the current allocation and share the allocation of @p src, which becomes read only.
+   * @param src The buffer to share the allocation of.
+   * @note The values are trivially copyable so there is no need to destroy the current values.
+   */
+  void share( CopyOnWriteBuffer const & src )
+  {
+    if( m_data == src.m_data )
+    { return; }
+
+    free();
+    m_isOwner = true;
+    if( src.m_data != nullptr )
+    {
+      src.m_header->refCount.fetch_add( 1, std::memory_order_relaxed );
+      m_data = src.m_data;
+      m_header = src.m_header;
+      m_capacity = src.m_capacity;
+      protect( PROT_READ );
+    }
+
+    m_registration.setSize( src.m_registration.sizeBytes() );
+  }
+
+  /**
+   * @brief Make the values writable. If the allocation is shared the values are copied into a private
+   *   allocation of the same capacity, otherwise its pages are made writable again.
+   * @note This is done by the non-const data() and operator[] and by touching the buffer.
+   * @note Earlier views keep referencing the read only allocation, so they must not be used to write.
+   * @note This must not be called concurrently with any other access to this buffer.
+   */
+  void detach() const
+  {
+    if( std::is_const< T >::value || m_data == nullptr || !m_header->isReadOnly.load( std::memory_order_acquire ) )
+    { return; }
+
+    if( !isShared() )
+    {
+      LVARRAY_ERROR_IF( m_header->refCount.load( std::memory_order_acquire ) > 1,
+                        "A view of a shared CopyOnWriteBuffer can't be written to, touch the owning container instead." );
+      protect( PROT_READ | PROT_WRITE );
+      return;
+    }
+
+    Header * newHeader = nullptr;
+    T * const newData = allocate( m_capacity, newHeader );
+    std::memcpy( const_cast< std::remove_const_t< T > * >( newData ), m_data, m_capacity * sizeof( T ) );
+    m_registration.reallocate( 0, numBytes( m_capacity ), 0 );
+
+    // Another buffer may have released its reference in the meantime.
+    int const id = m_header->registryId;
+    if( release() )
+    { allocationRegistry::recordReallocation( id, numBytes( m_capacity ), 0, 0 ); }
+
+    m_data = newData;
+    m_header = newHeader;
+  }
+
+  /**
+   * @tparam The type of the owning object.
+   * @brief Set the name associated with this buffer, used to account for its allocations.
+   * @param name the name of the buffer.
+   * @details If the allocation is charged to the current name of this buffer it is charged to the new name.
+   */
+  template< typename=VoidBuffer >
+  void setName( std::string const & name )
+  {
+    bool const isCharged = m_isOwner && m_data != nullptr && m_header->registryId == m_registration.id();
+    m_registration.setName( name, isCharged ? numBytes( m_capacity ) : 0 );
+    if( isCharged )
+    { m_header->registryId = m_registration.id(); }
+  }
+
+  /**
+   * @brief Set the number of values in the buffer, used to account for the bytes in use.
+   * @param size The number of values in the buffer.
+   */
+  void registerSize( std::ptrdiff_t const size )
+  { m_registration.setSize( size * sizeof( T ) ); }
+
+  /**
+   * @brief @return True iff this buffer owns a reference to an allocation that other buffers reference as well.
+   */
+  bool isShared() const
+  { return useCount() > 1; }
+
+  /**
+   * @brief @return True iff the values are read only, see detach().
+   */
+  bool isReadOnly() const
+  { return m_data != nullptr && m_header->isReadOnly.load( std::memory_order_acquire ); }
+
+  /**
+   * @brief @return The number of buffers that own a reference to the allocation, zero for an alias or an empty buffer.
+   */
+  int useCount() const
+  { return ( m_isOwner && m_data != nullptr ) ? m_header->refCount.load( std::memory_order_acquire ) : 0; }
+
+  /**
+   * @brief Move the buffer to the given execution space, only MemorySpace::CPU is supported.
+   * @param space the space to move the buffer to.
+   * @param size the size of the buffer.
+   * @param touch whether the buffer should be touched in the new space or not, if so it is detached.
+   */
+  void move( MemorySpace const space, std::ptrdiff_t const size, bool const touch ) const
+  {
+    LVARRAY_UNUSED_VARIABLE( size );
+    move( space, touch );
+  }
+
+  /**
+   * @brief Move the buffer to the given execution space, only MemorySpace::CPU is supported.
+   * @param space the space to move the buffer to.
+   * @param touch whether the buffer should be touched in the new space or not, if so it is detached.
+   */
+  void move( MemorySpace const space, bool const touch ) const
+  {
+    LVARRAY_ERROR_IF_NE_MSG( space, MemorySpace::CPU, "The CopyOnWriteBuffer only supports the CPU." );
+    if( touch )
+    { detach(); }
+  }
+
+  /**
+   * @brief Touch the buffer in the given space, this detaches it.
+   * @param space the space to touch.
+   */
+  void registerTouch( MemorySpace const space ) const
+  {
+    LVARRAY_ERROR_IF_NE_MSG( space, MemorySpace::CPU, "The CopyOnWriteBuffer only supports the CPU." );
+    detach();
+  }
+
+  /**
+   * @brief @return Return the capacity of the buffer.
+   */
+  inline
+  std::ptrdiff_t capacity() const
+  { return m_capacity; }
+
+  /**
+   * @brief @return Return a pointer to the beginning of the buffer, the buffer is detached first.
+   */
+  inline
+  T * data()
+  {
+    detach();
+    return m_data;
+  }
+
+  /**
+   * @brief @return Return a pointer to the beginning of the buffer, the buffer is never detached.
+   */
+  inline
+  T * data() const
+  { return m_data; }
+
+  /**
+   * @tparam INDEX_TYPE the type used to index into the values.
+   * @brief @return The value at position @p i , the buffer is detached first.
+   * @param i The position of the value to access.
+   * @note No bounds checks are performed.
+   */
+  template< typename INDEX_TYPE >
+  inline
+  T & operator[]( INDEX_TYPE const i )
+  { return data()[ i ]; }
+
+  /**
+   * @tparam INDEX_TYPE the type used to index into the values.
+   * @brief @return The value at position @p i , the buffer is never detached.
+   * @param i The position of the value to access.
+   * @note No bounds checks are performed.
+   */
+  template< typename INDEX_TYPE >
+  inline
+  T & operator[]( INDEX_TYPE const i ) const
+  { return m_data[ i ]; }
+
+private:
+
+  /**
+   * @struct Header
+   * @brief The bookkeeping of an allocation, it lives outside of the values so that it stays writable.
+   */
+  struct Header
+  {
+    /// The number of buffers that own a reference to the allocation.
+    std::atomic< int > refCount;
+
+    /// True iff the pages of the allocation are read only.
+    std::atomic< bool > isReadOnly;
+
+    /// The id of the allocation registry record the allocation is charged to.
+    int registryId;
+  };
+
+  /**
+   * @brief @return The number of bytes mapped for @p capacity values, a whole number of pages.
+   * @param capacity The number of values.
+   */
+  static std::size_t numBytes( std::ptrdiff_t const capacity )
+  {
+    static std::size_t const pageSize = sysconf( _SC_PAGESIZE );
+    return ( capacity * sizeof( T ) + pageSize - 1 ) / pageSize * pageSize;
+  }
+
+  /**
+   * @brief Change the protection of the pages of the allocation.
+   * @param protection The new protection, either PROT_READ or PROT_READ | PROT_WRITE.
+   */
+  void protect( int const protection ) const
+  {
+    LVARRAY_ERROR_IF( mprotect( const_cast< std::remove_const_t< T > * >( m_data ), numBytes( m_capacity ), protection ) != 0,
+                      "Failed to change the protection of the allocation: " << std::strerror( errno ) );
+    m_header->isReadOnly.store( !( protection & PROT_WRITE ), std::memory_order_release );
+  }
+
+  /**
+   * @brief @return A new writable allocation with room for @p capacity values and a reference count of one,
+   *   nullptr if @p capacity is zero. The allocation is charged to the name of this buffer.
+   * @param capacity The number of values.
+   * @param header Set to the Header of the new allocation.
+   */
+  T * allocate( std::ptrdiff_t const capacity, Header * & header ) const
+  {
+    if( capacity == 0 )
+    { return nullptr; }
+
+    void * const ptr = mmap( nullptr, numBytes( capacity ), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    LVARRAY_ERROR_IF( ptr == MAP_FAILED, "Failed to map " << numBytes( capacity ) << " bytes: " << std::strerror( errno ) );
+
+    header = new Header{ { 1 }, { false }, m_registration.id() };
+    return static_cast< T * >( ptr );
+  }
+
+  /**
+   * @brief Release this buffer's reference to its allocation, freeing it if it was the last one.
+   * @return True iff the allocation was freed.
+   * @note The pointers are left as they are.
+   */
+  bool release() const
+  {
+    if( m_header->refCount.fetch_sub( 1, std::memory_order_acq_rel ) != 1 )
+    { return false; }
+
+    munmap( const_cast< std::remove_const_t< T > * >( m_data ), numBytes( m_capacity ) );
+    delete m_header;
+    return true;
+  }
+
+  /// A pointer to the values, mutable so that touching a buffer through a const view can detach it.
+  mutable T * m_data;
+
+  /// The Header of the allocation, mutable for the same reason as m_data.
+  mutable Header * m_header;
+
+  /// The size of the allocation.
+  std::ptrdiff_t m_capacity;
+
+  /// True iff this buffer holds a reference to the allocation, false for shallow copies.
+  bool m_isOwner;
+
+  /// The registration of the buffer in the allocation registry.
+  allocationRegistry::Registration m_registration;
+};
+
+} // namespace LvArray
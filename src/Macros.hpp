@@ -229,7 +229,7 @@
  * @param lhs expression to be evaluated and used as left-hand side in comparison
  * @param rhs expression to be evaluated and used as right-hand side in comparison
  */
-#define LVARRAY_ERROR_IF_EQ( lhs, rhs ) LVARRAY_ERROR_IF_NE_MSG( lhs, rhs, "" )
+#define LVARRAY_ERROR_IF_EQ( lhs, rhs ) LVARRAY_ERROR_IF_EQ_MSG( lhs, rhs, "" )
 
 /**
  * @brief Raise a hard error if two values are not equal.
@@ -428,6 +428,22 @@
   #endif
 #endif
 
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * @brief @return @p PTR with the compiler allowed to assume it is aligned to @p ALIGN bytes.
+ * @param PTR The pointer.
+ * @param ALIGN The alignment in bytes, must be a compile time constant.
+ */
+#define LVARRAY_ASSUME_ALIGNED( PTR, ALIGN ) static_cast< std::decay_t< decltype( PTR ) > >( __builtin_assume_aligned( PTR, ALIGN ) )
+#else
+/**
+ * @brief @return @p PTR with the compiler allowed to assume it is aligned to @p ALIGN bytes.
+ * @param PTR The pointer.
+ * @param ALIGN The alignment in bytes, must be a compile time constant.
+ */
+#define LVARRAY_ASSUME_ALIGNED( PTR, ALIGN ) ( PTR )
+#endif
+
 #if !defined(USE_ARRAY_BOUNDS_CHECK)
 /**
  * @brief Expands to constexpr when array bound checking is disabled.
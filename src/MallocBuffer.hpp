@@ -22,10 +22,15 @@
 #include "LvArrayConfig.hpp"
 #include "Macros.hpp"
 #include "bufferManipulation.hpp"
+#include "AllocationRegistry.hpp"
 
 // TPL includes
 #include <stddef.h>
 
+// System includes
+#include <cstdint>
+#include <cstdlib>
+
 
 namespace LvArray
 {
@@ -35,7 +40,9 @@ namespace LvArray
  * @brief Implements the Buffer interface using malloc and free.
  * @tparam T type of data that is contained in the buffer.
  * @details Both the copy constructor and copy assignment constructor perform a shallow copy
- *   of the source. Similarly the destructor does not free the allocation.
+ *   of the source. Similarly the destructor does not free the allocation. If the allocation registry
+ *   is enabled when the buffer is named its allocations are accounted for under that name,
+ *   see allocationRegistry.
  * @note The parent class bufferManipulation::VoidBuffer provides the default execution space related methods.
  */
 template< typename T >
@@ -57,7 +64,8 @@ public:
   LVARRAY_HOST_DEVICE inline constexpr
   MallocBuffer( bool=true ):
     m_data( nullptr ),
-    m_capacity( 0 )
+    m_capacity( 0 ),
+    m_registration()
   {}
 
   /**
@@ -80,10 +88,12 @@ public:
   LVARRAY_HOST_DEVICE inline constexpr
   MallocBuffer( MallocBuffer && src ):
     m_data( src.m_data ),
-    m_capacity( src.m_capacity )
+    m_capacity( src.m_capacity ),
+    m_registration( src.m_registration )
   {
     src.m_capacity = 0;
     src.m_data = nullptr;
+    src.m_registration = allocationRegistry::Registration();
   }
 
   /**
@@ -96,6 +106,7 @@ public:
   {
     m_capacity = src.m_capacity;
     m_data = src.m_data;
+    m_registration = src.m_registration;
     return *this;
   }
 
@@ -109,8 +120,10 @@ public:
   {
     m_capacity = src.m_capacity;
     m_data = src.m_data;
+    m_registration = src.m_registration;
     src.m_capacity = 0;
     src.m_data = nullptr;
+    src.m_registration = allocationRegistry::Registration();
     return *this;
   }
 
@@ -121,13 +134,20 @@ public:
    */
   void reallocate( std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
   {
-    // TODO: If std::is_trivially_copyable_v< T > then we could use std::realloc.
+    if( isTriviallyRelocatable< T > )
+    {
+      reallocateInPlace( size, newCapacity );
+      return;
+    }
+
     T * const newPtr = reinterpret_cast< T * >( std::malloc( newCapacity * sizeof( T ) ) );
 
     std::ptrdiff_t const overlapAmount = std::min( newCapacity, size );
     arrayManipulation::uninitializedMove( newPtr, overlapAmount, m_data );
     arrayManipulation::destroy( m_data, size );
 
+    m_registration.reallocate( m_capacity * sizeof( T ), newCapacity * sizeof( T ), overlapAmount * sizeof( T ) );
+
     std::free( m_data );
     m_capacity = newCapacity;
     m_data = newPtr;
@@ -140,11 +160,38 @@ public:
   LVARRAY_HOST_DEVICE inline
   void free()
   {
+#if !defined(__CUDA_ARCH__)
+    m_registration.reallocate( m_capacity * sizeof( T ), 0, 0 );
+    m_registration.setSize( 0 );
+#endif
     std::free( m_data );
     m_capacity = 0;
     m_data = nullptr;
   }
 
+  /**
+   * @tparam The type of the owning object.
+   * @brief Set the name associated with this buffer, used to account for its allocations.
+   * @param name the name of the buffer.
+   */
+  template< typename=VoidBuffer >
+  void setName( std::string const & name )
+  { m_registration.setName( name, m_capacity * sizeof( T ) ); }
+
+  /**
+   * @brief Set the number of values in the buffer, used to account for the bytes in use.
+   * @param size The number of values in the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void registerSize( std::ptrdiff_t const size )
+  {
+#if !defined(__CUDA_ARCH__)
+    m_registration.setSize( size * sizeof( T ) );
+#else
+    LVARRAY_UNUSED_VARIABLE( size );
+#endif
+  }
+
   /**
    * @brief @return Return the capacity of the buffer.
    */
@@ -172,11 +219,49 @@ public:
 
 private:
 
+  /**
+   * @brief Reallocate the buffer to the new capacity using std::realloc.
+   * @param size The number of values that are initialized in the buffer.
+   * @param newCapacity The new capacity of the buffer.
+   * @details Since T is trivially relocatable the values don't need to be moved individually,
+   *   and for large allocations std::realloc can often grow the allocation without copying at all.
+   */
+  void reallocateInPlace( std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+  {
+    if( newCapacity < size )
+    {
+      arrayManipulation::destroy( m_data + newCapacity, size - newCapacity );
+    }
+
+    if( newCapacity == 0 )
+    {
+      free();
+      return;
+    }
+
+    // The old pointer may not be used once std::realloc has freed it, so compare addresses instead.
+    std::uintptr_t const oldAddress = reinterpret_cast< std::uintptr_t >( m_data );
+    void * const newPtr = std::realloc( static_cast< void * >( m_data ), newCapacity * sizeof( T ) );
+    LVARRAY_ERROR_IF( newPtr == nullptr, "Failed to reallocate " << newCapacity * sizeof( T ) << " bytes." );
+
+    // If the allocation was resized in place nothing was copied.
+    std::ptrdiff_t const overlapAmount = std::min( newCapacity, size );
+    m_registration.reallocate( m_capacity * sizeof( T ),
+                               newCapacity * sizeof( T ),
+                               reinterpret_cast< std::uintptr_t >( newPtr ) == oldAddress ? 0 : overlapAmount * sizeof( T ) );
+
+    m_capacity = newCapacity;
+    m_data = static_cast< T * >( newPtr );
+  }
+
   /// A pointer to the data.
   T * LVARRAY_RESTRICT m_data = nullptr;
 
   /// The size of the allocation.
   std::ptrdiff_t m_capacity = 0;
+
+  /// The registration of the buffer in the allocation registry.
+  allocationRegistry::Registration m_registration;
 };
 
 } // namespace LvArray
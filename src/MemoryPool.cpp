@@ -0,0 +1,351 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+// Source includes
+#include "MemoryPool.hpp"
+#include "Macros.hpp"
+
+// System includes
+#include <algorithm>
+#include <cstdlib>
+#include <mutex>
+
+namespace LvArray
+{
+namespace memoryPool
+{
+namespace internal
+{
+
+/// The base two logarithm of the smallest block size.
+constexpr int MIN_BLOCK_SIZE_LOG2 = 5;
+
+/// The number of size classes, the largest block size is 2^( MIN_BLOCK_SIZE_LOG2 + NUM_SIZE_CLASSES - 1 ).
+constexpr int NUM_SIZE_CLASSES = 16;
+
+/// The largest block size.
+constexpr std::size_t MAX_BLOCK_SIZE = std::size_t( 1 ) << ( MIN_BLOCK_SIZE_LOG2 + NUM_SIZE_CLASSES - 1 );
+
+/// The approximate number of bytes moved between a thread cache and the central pool at once.
+constexpr std::size_t BATCH_BYTES = std::size_t( 1 ) << 16;
+
+/**
+ * @brief @return The size class of an allocation of @p bytes, or -1 if it is not pooled.
+ * @param bytes The size of the allocation.
+ */
+inline int sizeClass( std::size_t const bytes )
+{
+  if( bytes > MAX_BLOCK_SIZE )
+  { return -1; }
+
+  int sizeClass = 0;
+  while( ( std::size_t( 1 ) << ( MIN_BLOCK_SIZE_LOG2 + sizeClass ) ) < bytes )
+  { ++sizeClass; }
+
+  return sizeClass;
+}
+
+/**
+ * @brief @return The block size of the given size class.
+ * @param sizeClass The size class.
+ */
+inline std::size_t sizeOfClass( int const sizeClass )
+{ return std::size_t( 1 ) << ( MIN_BLOCK_SIZE_LOG2 + sizeClass ); }
+
+/**
+ * @brief @return The number of blocks moved between a thread cache and the central pool at once.
+ * @param sizeClass The size class.
+ */
+inline std::ptrdiff_t batchSize( int const sizeClass )
+{ return std::max( std::ptrdiff_t( 1 ), std::ptrdiff_t( BATCH_BYTES / sizeOfClass( sizeClass ) ) ); }
+
+/**
+ * @struct FreeList
+ * @brief An intrusive singly linked list of unused blocks.
+ */
+struct FreeList
+{
+  /**
+   * @struct Node
+   * @brief The header written into each unused block.
+   */
+  struct Node
+  {
+    /// The next block in the list.
+    Node * next;
+  };
+
+  /**
+   * @brief Add a block to the front of the list.
+   * @param ptr The block to add.
+   */
+  void push( void * const ptr )
+  {
+    Node * const node = static_cast< Node * >( ptr );
+    node->next = head;
+    head = node;
+    ++size;
+  }
+
+  /**
+   * @brief @return The block at the front of the list after removing it from the list.
+   */
+  void * pop()
+  {
+    LVARRAY_ASSERT( head != nullptr );
+    Node * const node = head;
+    head = node->next;
+    --size;
+    return node;
+  }
+
+  /**
+   * @brief Move up to @p n blocks from this list to @p dst.
+   * @param dst The list to move the blocks to.
+   * @param n The maximum number of blocks to move.
+   */
+  void transfer( FreeList & dst, std::ptrdiff_t const n )
+  {
+    for( std::ptrdiff_t i = 0; i < n && head != nullptr; ++i )
+    { dst.push( pop() ); }
+  }
+
+  /**
+   * @brief Free every block in the list.
+   */
+  void clear()
+  {
+    while( head != nullptr )
+    { std::free( pop() ); }
+  }
+
+  /// The first block in the list.
+  Node * head = nullptr;
+
+  /// The number of blocks in the list.
+  std::ptrdiff_t size = 0;
+};
+
+/**
+ * @class CentralPool
+ * @brief The pool shared by all threads, access is serialized with a mutex.
+ */
+class CentralPool
+{
+public:
+
+  /// Free every block in the pool.
+  ~CentralPool()
+  { release(); }
+
+  /**
+   * @brief Move up to a batch of blocks of the given size class to @p dst.
+   * @param sizeClass The size class.
+   * @param dst The list to move the blocks to.
+   */
+  void fill( int const sizeClass, FreeList & dst )
+  {
+    std::lock_guard< std::mutex > lock( m_lock );
+    m_lists[ sizeClass ].transfer( dst, batchSize( sizeClass ) );
+  }
+
+  /**
+   * @brief Move up to @p n blocks of the given size class from @p src into the pool.
+   * @param sizeClass The size class.
+   * @param src The list to take the blocks from.
+   * @param n The maximum number of blocks to move.
+   */
+  void put( int const sizeClass, FreeList & src, std::ptrdiff_t const n )
+  {
+    std::lock_guard< std::mutex > lock( m_lock );
+    src.transfer( m_lists[ sizeClass ], n );
+  }
+
+  /// Free every block in the pool.
+  void release()
+  {
+    std::lock_guard< std::mutex > lock( m_lock );
+    for( FreeList & list : m_lists )
+    { list.clear(); }
+  }
+
+  /// @return The number of bytes held by the pool.
+  std::size_t numBytes()
+  {
+    std::lock_guard< std::mutex > lock( m_lock );
+    std::size_t bytes = 0;
+    for( int i = 0; i < NUM_SIZE_CLASSES; ++i )
+    { bytes += m_lists[ i ].size * sizeOfClass( i ); }
+
+    return bytes;
+  }
+
+private:
+  /// Serializes access to the free lists.
+  std::mutex m_lock;
+
+  /// The free lists of each size class.
+  FreeList m_lists[ NUM_SIZE_CLASSES ];
+};
+
+/**
+ * @brief @return The central pool.
+ */
+CentralPool & getCentralPool()
+{
+  static CentralPool pool;
+  return pool;
+}
+
+/**
+ * @class ThreadCache
+ * @brief The blocks cached by a single thread, returned to the central pool when the thread exits.
+ */
+class ThreadCache
+{
+public:
+
+  /// Return every cached block to the central pool.
+  ~ThreadCache()
+  { release(); }
+
+  /**
+   * @brief @return A block of the given size class.
+   * @param sizeClass The size class.
+   */
+  void * allocate( int const sizeClass )
+  {
+    FreeList & list = m_lists[ sizeClass ];
+    if( list.head == nullptr )
+    {
+      getCentralPool().fill( sizeClass, list );
+      if( list.head == nullptr )
+      { return std::malloc( sizeOfClass( sizeClass ) ); }
+    }
+
+    return list.pop();
+  }
+
+  /**
+   * @brief Cache a block of the given size class, if the cache is full a batch is returned to the central pool.
+   * @param ptr The block.
+   * @param sizeClass The size class.
+   */
+  void deallocate( void * const ptr, int const sizeClass )
+  {
+    FreeList & list = m_lists[ sizeClass ];
+    list.push( ptr );
+
+    std::ptrdiff_t const batch = batchSize( sizeClass );
+    if( list.size > 2 * batch )
+    { getCentralPool().put( sizeClass, list, batch ); }
+  }
+
+  /// Return every cached block to the central pool.
+  void release()
+  {
+    for( int i = 0; i < NUM_SIZE_CLASSES; ++i )
+    {
+      if( m_lists[ i ].size > 0 )
+      { getCentralPool().put( i, m_lists[ i ], m_lists[ i ].size ); }
+    }
+  }
+
+  /// @return The number of bytes held by the cache.
+  std::size_t numBytes() const
+  {
+    std::size_t bytes = 0;
+    for( int i = 0; i < NUM_SIZE_CLASSES; ++i )
+    { bytes += m_lists[ i ].size * sizeOfClass( i ); }
+
+    return bytes;
+  }
+
+private:
+  /// The free lists of each size class.
+  FreeList m_lists[ NUM_SIZE_CLASSES ];
+};
+
+/**
+ * @brief @return The calling thread's cache.
+ * @note The central pool is constructed first so that it outlives the cache of the main thread.
+ */
+ThreadCache & getThreadCache()
+{
+  getCentralPool();
+  static thread_local ThreadCache cache;
+  return cache;
+}
+
+} // namespace internal
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t maxBlockSize()
+{ return internal::MAX_BLOCK_SIZE; }
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t blockSize( std::size_t const bytes )
+{
+  int const sizeClass = internal::sizeClass( bytes );
+  return sizeClass < 0 ? bytes : internal::sizeOfClass( sizeClass );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void * allocate( std::size_t const bytes )
+{
+  if( bytes == 0 )
+  { return nullptr; }
+
+  int const sizeClass = internal::sizeClass( bytes );
+  void * const ptr = sizeClass < 0 ? std::malloc( bytes ) : internal::getThreadCache().allocate( sizeClass );
+  LVARRAY_ERROR_IF( ptr == nullptr, "Failed to allocate " << bytes << " bytes." );
+  return ptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void deallocate( void * const ptr, std::size_t const bytes )
+{
+  if( ptr == nullptr )
+  { return; }
+
+  int const sizeClass = internal::sizeClass( bytes );
+  if( sizeClass < 0 )
+  {
+    std::free( ptr );
+    return;
+  }
+
+  internal::getThreadCache().deallocate( ptr, sizeClass );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void releaseThreadCache()
+{ internal::getThreadCache().release(); }
+
+///////////////////////////////////////////////////////////////////////////////
+void release()
+{
+  releaseThreadCache();
+  internal::getCentralPool().release();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t numCachedBytes()
+{ return internal::getThreadCache().numBytes() + internal::getCentralPool().numBytes(); }
+
+} // namespace memoryPool
+} // namespace LvArray
@@ -0,0 +1,84 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+/**
+ * @file MemoryPool.hpp
+ * This file contains a thread safe size class memory pool intended for the many small
+ * allocations made by short lived containers. Allocations are rounded up to a power of two
+ * and recycled through per thread free lists which are backed by a shared central pool, so
+ * that threads constructing containers concurrently neither serialize on the system allocator
+ * nor on each other. Allocations larger than maxBlockSize() go straight to std::malloc.
+ */
+
+#pragma once
+
+// System includes
+#include <cstddef>
+
+namespace LvArray
+{
+namespace memoryPool
+{
+
+/**
+ * @brief @return The size of the largest block managed by the pool, larger requests are
+ *   forwarded to std::malloc and std::free.
+ */
+std::size_t maxBlockSize();
+
+/**
+ * @brief @return The number of bytes that will actually be allocated for a request of @p bytes.
+ * @param bytes The number of bytes requested.
+ * @details For pooled requests this is the next power of two, otherwise it is @p bytes.
+ */
+std::size_t blockSize( std::size_t const bytes );
+
+/**
+ * @brief @return A pointer to an allocation of at least @p bytes bytes, or nullptr if @p bytes is zero.
+ * @param bytes The number of bytes to allocate.
+ * @details The allocation is aligned to at least alignof( std::max_align_t ).
+ */
+void * allocate( std::size_t const bytes );
+
+/**
+ * @brief Return an allocation to the pool.
+ * @param ptr The allocation to return, may be nullptr.
+ * @param bytes The number of bytes that was requested when @p ptr was allocated, or any
+ *   number of bytes that maps to the same block size.
+ */
+void deallocate( void * const ptr, std::size_t const bytes );
+
+/**
+ * @brief Return the blocks cached by the calling thread to the central pool.
+ * @note This happens automatically when a thread exits.
+ */
+void releaseThreadCache();
+
+/**
+ * @brief Return the blocks cached by the calling thread and all the blocks in the central pool
+ *   to the system. Blocks cached by other threads are unaffected.
+ */
+void release();
+
+/**
+ * @brief @return The number of bytes held in the central pool and in the calling thread's cache
+ *   that are available for reuse.
+ */
+std::size_t numCachedBytes();
+
+} // namespace memoryPool
+} // namespace LvArray
@@ -0,0 +1,405 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "LvArrayConfig.hpp"
+#include "Macros.hpp"
+#include "bufferManipulation.hpp"
+#include "AllocationRegistry.hpp"
+
+// System includes
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace LvArray
+{
+
+/**
+ * @enum MmapMode
+ * @brief How an MmapBuffer maps its file.
+ */
+enum class MmapMode
+{
+  /// Changes are written back to the file, growing the buffer grows the file.
+  READ_WRITE,
+  /// The values may only be read, writing to them is a segmentation fault and reallocation is an error.
+  READ_ONLY,
+  /// Changes are private to the process. Growing the buffer detaches it from the file.
+  COPY_ON_WRITE
+};
+
+/**
+ * @class MmapBuffer
+ * @brief Implements the Buffer interface using mmap, optionally backed by a file.
+ * @tparam T type of data that is contained in the buffer.
+ * @details A default constructed MmapBuffer uses anonymous mappings and otherwise behaves like
+ *   MallocBuffer, so it can be used as the BUFFER_TYPE of any container. An MmapBuffer opened on
+ *   a file maps the whole file and treats it as an array of T, so reopening a large container is
+ *   O(1) and pages are only read when they are touched. Growing the buffer uses ftruncate and
+ *   mremap instead of copying the values. Like MallocBuffer both the copy constructor and copy
+ *   assignment constructor perform a shallow copy of the source and the destructor does not
+ *   unmap the memory. Freeing a buffer in MmapMode::READ_WRITE leaves the values in the file.
+ *   Use the adoptBuffer methods of the containers to hand them an opened buffer. The mapped bytes
+ *   of a named buffer are accounted for by the allocation registry.
+ * @note The parent class bufferManipulation::VoidBuffer provides the default execution space related methods.
+ */
+template< typename T >
+class MmapBuffer : public bufferManipulation::VoidBuffer
+{
+public:
+
+  /// Alias used in the bufferManipulation functions.
+  using value_type = T;
+
+  /// Signifies that the MmapBuffer's copy semantics are shallow.
+  static constexpr bool hasShallowCopy = true;
+
+  /**
+   * @brief Constructor for creating an empty or uninitialized buffer.
+   * @note An uninitialized MmapBuffer is equivalent to an empty MmapBuffer and does
+   *   not need to be free'd.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  MmapBuffer( bool=true ):
+    m_data( nullptr ),
+    m_capacity( 0 ),
+    m_fd( -1 ),
+    m_mode( MmapMode::READ_WRITE ),
+    m_registration()
+  {}
+
+  /**
+   * @brief Constructor that maps the file at @p path.
+   * @param path The path to the file. In MmapMode::READ_WRITE it is created if it doesn't exist.
+   * @param mode How to map the file.
+   * @details The capacity of the buffer is the size of the file divided by sizeof( T ). The values
+   *   in the file are taken as they are so T must be trivially copyable.
+   */
+  MmapBuffer( std::string const & path, MmapMode const mode ):
+    MmapBuffer()
+  {
+    static_assert( std::is_trivially_copyable< T >::value, "The values stored in a file must be trivially copyable." );
+
+    int const flags = ( mode == MmapMode::READ_WRITE ) ? O_RDWR | O_CREAT : O_RDONLY;
+    m_fd = ::open( path.c_str(), flags, 0644 );
+    LVARRAY_ERROR_IF( m_fd == -1, "Could not open " << path << ": " << std::strerror( errno ) );
+
+    struct stat fileInfo;
+    LVARRAY_ERROR_IF( fstat( m_fd, &fileInfo ) != 0, "Could not stat " << path << ": " << std::strerror( errno ) );
+
+    std::ptrdiff_t const fileSize = fileInfo.st_size;
+    LVARRAY_ERROR_IF_NE_MSG( fileSize % std::ptrdiff_t( sizeof( T ) ), 0,
+                             path << " does not hold a whole number of values." );
+
+    m_mode = mode;
+    m_capacity = fileSize / sizeof( T );
+    m_data = mapFile( m_capacity );
+  }
+
+  /**
+   * @brief Copy constructor, creates a shallow copy.
+   */
+  MmapBuffer( MmapBuffer const & ) = default;
+
+  /**
+   * @brief Sized copy constructor, creates a shallow copy.
+   * @param src The buffer to be coppied.
+   */
+  MmapBuffer( MmapBuffer const & src, std::ptrdiff_t ):
+    MmapBuffer( src )
+  {}
+
+  /**
+   * @brief Move constructor, creates a shallow copy.
+   * @param src The buffer to be moved from, is empty after the move.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  MmapBuffer( MmapBuffer && src ):
+    m_data( src.m_data ),
+    m_capacity( src.m_capacity ),
+    m_fd( src.m_fd ),
+    m_mode( src.m_mode ),
+    m_registration( src.m_registration )
+  {
+    src.m_data = nullptr;
+    src.m_capacity = 0;
+    src.m_fd = -1;
+    src.m_registration = allocationRegistry::Registration();
+  }
+
+  /**
+   * @brief Copy assignment operator, creates a shallow copy.
+   * @param src The buffer to be copied.
+   * @return *this.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  MmapBuffer & operator=( MmapBuffer const & src )
+  {
+    m_data = src.m_data;
+    m_capacity = src.m_capacity;
+    m_fd = src.m_fd;
+    m_mode = src.m_mode;
+    m_registration = src.m_registration;
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator, creates a shallow copy.
+   * @param src The buffer to be moved from, is empty after the move.
+   * @return *this.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  MmapBuffer & operator=( MmapBuffer && src )
+  {
+    *this = src;
+    src.m_data = nullptr;
+    src.m_capacity = 0;
+    src.m_fd = -1;
+    src.m_registration = allocationRegistry::Registration();
+    return *this;
+  }
+
+  /**
+   * @brief Reallocate the buffer to the new capacity.
+   * @param size The number of values that are initialized in the buffer.
+   * @param newCapacity The new capacity of the buffer.
+   * @details An anonymous buffer holding trivially relocatable values and a buffer in
+   *   MmapMode::READ_WRITE are grown in place with mremap where it is available. A buffer in
+   *   MmapMode::COPY_ON_WRITE is copied into an anonymous mapping.
+   */
+  void reallocate( std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+  {
+    LVARRAY_ERROR_IF( m_fd != -1 && m_mode == MmapMode::READ_ONLY, "Cannot reallocate a read only MmapBuffer." );
+
+    std::ptrdiff_t const overlapAmount = std::min( newCapacity, size );
+    arrayManipulation::destroy( m_data + overlapAmount, size - overlapAmount );
+
+    // Remapping doesn't copy the values.
+    bool const inPlace = ( m_fd != -1 && m_mode == MmapMode::READ_WRITE ) || ( m_fd == -1 && isTriviallyRelocatable< T > );
+    m_registration.reallocate( m_capacity * sizeof( T ), newCapacity * sizeof( T ), inPlace ? 0 : overlapAmount * sizeof( T ) );
+
+    if( m_fd != -1 && m_mode == MmapMode::READ_WRITE )
+    {
+      LVARRAY_ERROR_IF( ftruncate( m_fd, newCapacity * sizeof( T ) ) != 0,
+                        "Could not resize the file: " << std::strerror( errno ) );
+      m_data = remap( newCapacity, [this]( std::ptrdiff_t const capacity ){ return mapFile( capacity ); } );
+      m_capacity = newCapacity;
+      return;
+    }
+
+    if( m_fd == -1 && isTriviallyRelocatable< T > )
+    {
+      m_data = remap( newCapacity, []( std::ptrdiff_t const capacity ){ return mapAnonymous( capacity ); } );
+      m_capacity = newCapacity;
+      return;
+    }
+
+    T * const newPtr = mapAnonymous( newCapacity );
+    arrayManipulation::uninitializedRelocate( newPtr, overlapAmount, m_data );
+
+    unmapAndClose();
+    m_data = newPtr;
+    m_capacity = newCapacity;
+  }
+
+  /**
+   * @brief Unmap the data in the buffer and close the file but does not destroy any values.
+   * @note To destroy the values and free the data call bufferManipulation::free.
+   */
+  void free()
+  {
+    m_registration.reallocate( m_capacity * sizeof( T ), 0, 0 );
+    m_registration.setSize( 0 );
+    unmapAndClose();
+  }
+
+  /**
+   * @tparam The type of the owning object.
+   * @brief Set the name associated with this buffer, used to account for its mapped bytes.
+   * @param name the name of the buffer.
+   */
+  template< typename=VoidBuffer >
+  void setName( std::string const & name )
+  { m_registration.setName( name, m_capacity * sizeof( T ) ); }
+
+  /**
+   * @brief Set the number of values in the buffer, used to account for the bytes in use.
+   * @param size The number of values in the buffer.
+   */
+  void registerSize( std::ptrdiff_t const size )
+  { m_registration.setSize( size * sizeof( T ) ); }
+
+  /**
+   * @brief Write any changes to the values back to the file.
+   * @note This is only needed for durability, other processes mapping the file see the changes immediately.
+   */
+  void sync() const
+  {
+    if( m_fd != -1 && m_mode == MmapMode::READ_WRITE && m_capacity > 0 )
+    {
+      LVARRAY_ERROR_IF( msync( m_data, m_capacity * sizeof( T ), MS_SYNC ) != 0,
+                        "Could not sync the file: " << std::strerror( errno ) );
+    }
+  }
+
+  /**
+   * @brief @return True iff the buffer is backed by a file.
+   */
+  bool isFileBacked() const
+  { return m_fd != -1; }
+
+  /**
+   * @brief @return Return the capacity of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  std::ptrdiff_t capacity() const
+  { return m_capacity; }
+
+  /**
+   * @brief @return Return a pointer to the beginning of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  T * data() const
+  { return m_data; }
+
+  /**
+   * @tparam INDEX_TYPE the type used to index into the values.
+   * @brief @return The value at position @p i .
+   * @param i The position of the value to access.
+   * @note No bounds checks are performed.
+   */
+  template< typename INDEX_TYPE >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T & operator[]( INDEX_TYPE const i ) const
+  { return m_data[ i ]; }
+
+private:
+
+  /**
+   * @brief Unmap the data in the buffer and close the file.
+   */
+  void unmapAndClose()
+  {
+    unmap( m_data, m_capacity );
+    m_data = nullptr;
+    m_capacity = 0;
+
+    if( m_fd != -1 )
+    {
+      ::close( m_fd );
+      m_fd = -1;
+    }
+  }
+
+  /**
+   * @tparam MAP The type of the function used to create a mapping.
+   * @brief @return A pointer to the values resized to @p newCapacity, the values are not moved.
+   * @param newCapacity The new capacity.
+   * @param map The function used to create a new mapping of a given capacity.
+   */
+  template< typename MAP >
+  T * remap( std::ptrdiff_t const newCapacity, MAP && map )
+  {
+    if( m_capacity == 0 || newCapacity == 0 )
+    {
+      unmap( m_data, m_capacity );
+      return map( newCapacity );
+    }
+
+#if defined(__linux__)
+    void * const ptr = mremap( m_data, m_capacity * sizeof( T ), newCapacity * sizeof( T ), MREMAP_MAYMOVE );
+    LVARRAY_ERROR_IF( ptr == MAP_FAILED, "Could not remap " << newCapacity * sizeof( T ) << " bytes: " << std::strerror( errno ) );
+    return static_cast< T * >( ptr );
+#else
+    T * const newPtr = map( newCapacity );
+    if( m_fd == -1 )
+    { std::memcpy( static_cast< void * >( newPtr ), m_data, std::min( m_capacity, newCapacity ) * sizeof( T ) ); }
+
+    unmap( m_data, m_capacity );
+    return newPtr;
+#endif
+  }
+
+  /**
+   * @brief @return A new mapping of the first @p capacity values of the file.
+   * @param capacity The number of values to map.
+   */
+  T * mapFile( std::ptrdiff_t const capacity ) const
+  {
+    if( capacity == 0 )
+    { return nullptr; }
+
+    int const protection = ( m_mode == MmapMode::READ_ONLY ) ? PROT_READ : PROT_READ | PROT_WRITE;
+    int const flags = ( m_mode == MmapMode::READ_WRITE ) ? MAP_SHARED : MAP_PRIVATE;
+    void * const ptr = mmap( nullptr, capacity * sizeof( T ), protection, flags, m_fd, 0 );
+    LVARRAY_ERROR_IF( ptr == MAP_FAILED, "Could not map " << capacity * sizeof( T ) << " bytes: " << std::strerror( errno ) );
+    return static_cast< T * >( ptr );
+  }
+
+  /**
+   * @brief @return A new anonymous mapping of @p capacity values.
+   * @param capacity The number of values to map.
+   */
+  static T * mapAnonymous( std::ptrdiff_t const capacity )
+  {
+    if( capacity == 0 )
+    { return nullptr; }
+
+    void * const ptr = mmap( nullptr, capacity * sizeof( T ), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    LVARRAY_ERROR_IF( ptr == MAP_FAILED, "Could not map " << capacity * sizeof( T ) << " bytes: " << std::strerror( errno ) );
+    return static_cast< T * >( ptr );
+  }
+
+  /**
+   * @brief Unmap the given values.
+   * @param ptr A pointer to the values, may be nullptr.
+   * @param capacity The number of values mapped at @p ptr.
+   */
+  static void unmap( T * const ptr, std::ptrdiff_t const capacity )
+  {
+    if( ptr != nullptr )
+    { munmap( static_cast< void * >( ptr ), capacity * sizeof( T ) ); }
+  }
+
+  /// A pointer to the data.
+  T * LVARRAY_RESTRICT m_data = nullptr;
+
+  /// The number of values mapped.
+  std::ptrdiff_t m_capacity = 0;
+
+  /// The file descriptor of the backing file or -1 if the buffer is anonymous.
+  int m_fd = -1;
+
+  /// How the backing file is mapped.
+  MmapMode m_mode = MmapMode::READ_WRITE;
+
+  /// The registration of the buffer in the allocation registry.
+  allocationRegistry::Registration m_registration;
+};
+
+} // namespace LvArray
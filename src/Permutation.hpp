@@ -44,6 +44,57 @@ constexpr bool isValidPermutation( PERMUTATION, camp::idx_seq< INDICES... > )
 
 } // namespace internal
 
+/// The value of an extent or a stride that is only known at runtime.
+constexpr camp::idx_t DYNAMIC_EXTENT = -1;
+
+/**
+ * @tparam EXTENTS A variadic list of extents, each either non negative or DYNAMIC_EXTENT.
+ * @brief An alias for a camp::idx_seq containing the compile time extents of each dimension.
+ */
+template< camp::idx_t... EXTENTS >
+using Extents = camp::idx_seq< EXTENTS... >;
+
+namespace internal
+{
+
+template< int N, camp::idx_t... VALUES >
+struct DynamicSequence
+{ using type = typename DynamicSequence< N - 1, DYNAMIC_EXTENT, VALUES... >::type; };
+
+template< camp::idx_t... VALUES >
+struct DynamicSequence< 0, VALUES... >
+{ using type = camp::idx_seq< VALUES... >; };
+
+template< typename SEQUENCE >
+struct PopFront;
+
+template< camp::idx_t FIRST, camp::idx_t... REST >
+struct PopFront< camp::idx_seq< FIRST, REST... > >
+{ using type = camp::idx_seq< REST... >; };
+
+} // namespace internal
+
+/**
+ * @tparam NDIM The number of dimensions.
+ * @brief The extents of an @p NDIM dimensional space where none are known at compile time, the default.
+ */
+template< int NDIM >
+using DynamicExtents = typename internal::DynamicSequence< NDIM >::type;
+
+/**
+ * @tparam NDIM The number of dimensions.
+ * @brief The strides of an @p NDIM dimensional space where none are known at compile time, the default.
+ */
+template< int NDIM >
+using DynamicStrides = typename internal::DynamicSequence< NDIM >::type;
+
+/**
+ * @tparam SEQUENCE A non empty camp::idx_seq.
+ * @brief @p SEQUENCE without its first value, used to get the strides of a slice.
+ */
+template< typename SEQUENCE >
+using PopFront = typename internal::PopFront< SEQUENCE >::type;
+
 /**
  * @tparam INDICES A variadic list of indices.
  * @brief @return The number of indices.
@@ -122,4 +173,84 @@ LVARRAY_HOST_DEVICE inline constexpr
 CArray< camp::idx_t, sizeof...( INDICES ) > asArray( camp::idx_seq< INDICES... > )
 { return { INDICES ... }; }
 
+/**
+ * @tparam PERMUTATION A camp::idx_seq containing the permutation.
+ * @tparam EXTENTS A camp::idx_seq containing the compile time extents.
+ * @brief @return True iff @tparam EXTENTS has an extent for each dimension of @tparam PERMUTATION
+ *   and each extent is either non negative or DYNAMIC_EXTENT.
+ */
+template< typename PERMUTATION, typename EXTENTS >
+constexpr bool isValidExtents( PERMUTATION, EXTENTS )
+{
+  constexpr int NDIM = getDimension( PERMUTATION {} );
+  if( getDimension( EXTENTS {} ) != NDIM )
+  { return false; }
+
+  for( int i = 0; i < NDIM; ++i )
+  {
+    if( asArray( EXTENTS {} )[ i ] < DYNAMIC_EXTENT )
+    { return false; }
+  }
+
+  return true;
+}
+
+/**
+ * @tparam PERMUTATION A camp::idx_seq containing the permutation.
+ * @tparam EXTENTS A camp::idx_seq containing the compile time extents.
+ * @brief @return The stride of dimension @p dim if it is known at compile time, otherwise DYNAMIC_EXTENT.
+ * @param dim The dimension to get the stride of.
+ * @details The stride of a dimension is the product of the extents of the dimensions that come
+ *   after it in @tparam PERMUTATION, so it is known at compile time if all of those extents are.
+ *   The unit stride dimension is excluded, the USD template parameter of ArraySlice already takes
+ *   care of it, so an array without any static extents has DynamicStrides.
+ */
+template< typename PERMUTATION, typename EXTENTS >
+constexpr camp::idx_t getStaticStride( PERMUTATION, EXTENTS, int const dim )
+{
+  constexpr int NDIM = getDimension( PERMUTATION {} );
+  constexpr CArray< camp::idx_t, NDIM > perm = asArray( PERMUTATION {} );
+  constexpr CArray< camp::idx_t, NDIM > extents = asArray( EXTENTS {} );
+
+  int position = 0;
+  while( perm[ position ] != dim )
+  { ++position; }
+
+  if( position == NDIM - 1 )
+  { return DYNAMIC_EXTENT; }
+
+  camp::idx_t stride = 1;
+  for( int i = position + 1; i < NDIM; ++i )
+  {
+    if( extents[ perm[ i ] ] == DYNAMIC_EXTENT )
+    { return DYNAMIC_EXTENT; }
+
+    stride *= extents[ perm[ i ] ];
+  }
+
+  return stride;
+}
+
+namespace internal
+{
+
+template< typename PERMUTATION, typename EXTENTS, typename DIMS >
+struct StaticStrides;
+
+template< typename PERMUTATION, typename EXTENTS, camp::idx_t... DIMS >
+struct StaticStrides< PERMUTATION, EXTENTS, camp::idx_seq< DIMS... > >
+{ using type = camp::idx_seq< getStaticStride( PERMUTATION {}, EXTENTS {}, DIMS )... >; };
+
+} // namespace internal
+
+/**
+ * @tparam PERMUTATION A camp::idx_seq containing the permutation.
+ * @tparam EXTENTS A camp::idx_seq containing the compile time extents.
+ * @brief A camp::idx_seq containing the stride of each dimension, see getStaticStride.
+ */
+template< typename PERMUTATION, typename EXTENTS >
+using StaticStrides = typename internal::StaticStrides< PERMUTATION,
+                                                        EXTENTS,
+                                                        camp::make_idx_seq_t< getDimension( PERMUTATION {} ) > >::type;
+
 } // namespace LvArray
@@ -0,0 +1,226 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "LvArrayConfig.hpp"
+#include "Macros.hpp"
+#include "bufferManipulation.hpp"
+#include "MemoryPool.hpp"
+#include "AllocationRegistry.hpp"
+
+// System includes
+#include <algorithm>
+#include <cstddef>
+#include <string>
+
+
+namespace LvArray
+{
+
+/**
+ * @class PoolBuffer
+ * @brief Implements the Buffer interface using the size class allocator in MemoryPool.hpp.
+ * @tparam T type of data that is contained in the buffer.
+ * @details This is a drop in replacement for MallocBuffer for containers that are created
+ *   and destroyed often, for example inside a loop over elements. Allocations are rounded
+ *   up to the block size of the pool so the capacity may be larger than requested.
+ *   Like MallocBuffer both the copy constructor and copy assignment operator perform a
+ *   shallow copy of the source and the destructor does not free the allocation, and the
+ *   allocations of a named buffer are accounted for by the allocation registry.
+ * @note The parent class bufferManipulation::VoidBuffer provides the default execution space related methods.
+ */
+template< typename T >
+class PoolBuffer : public bufferManipulation::VoidBuffer
+{
+public:
+  static_assert( alignof( T ) <= alignof( std::max_align_t ), "PoolBuffer does not support over-aligned types." );
+
+  /// Alias used in the bufferManipulation functions.
+  using value_type = T;
+
+  /// Signifies that the PoolBuffer's copy semantics are shallow.
+  static constexpr bool hasShallowCopy = true;
+
+  /**
+   * @brief Constructor for creating an empty or uninitialized buffer.
+   * @note An uninitialized PoolBuffer is equivalent to an empty PoolBuffer and does
+   *   not need to be free'd.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  PoolBuffer( bool=true ):
+    m_data( nullptr ),
+    m_capacity( 0 ),
+    m_registration()
+  {}
+
+  /**
+   * @brief Copy constructor, creates a shallow copy.
+   */
+  PoolBuffer( PoolBuffer const & ) = default;
+
+  /**
+   * @brief Sized copy constructor, creates a shallow copy.
+   * @param src The buffer to be coppied.
+   */
+  PoolBuffer( PoolBuffer const & src, std::ptrdiff_t ):
+    PoolBuffer( src )
+  {}
+
+  /**
+   * @brief Move constructor, creates a shallow copy.
+   * @param src The buffer to be moved from, is empty after the move.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  PoolBuffer( PoolBuffer && src ):
+    m_data( src.m_data ),
+    m_capacity( src.m_capacity ),
+    m_registration( src.m_registration )
+  {
+    src.m_capacity = 0;
+    src.m_data = nullptr;
+    src.m_registration = allocationRegistry::Registration();
+  }
+
+  /**
+   * @brief Copy assignment operator, creates a shallow copy.
+   * @param src The buffer to be copied.
+   * @return *this.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  PoolBuffer & operator=( PoolBuffer const & src )
+  {
+    m_capacity = src.m_capacity;
+    m_data = src.m_data;
+    m_registration = src.m_registration;
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator, creates a shallow copy.
+   * @param src The buffer to be moved from, is empty after the move.
+   * @return *this.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  PoolBuffer & operator=( PoolBuffer && src )
+  {
+    m_capacity = src.m_capacity;
+    m_data = src.m_data;
+    m_registration = src.m_registration;
+    src.m_capacity = 0;
+    src.m_data = nullptr;
+    src.m_registration = allocationRegistry::Registration();
+    return *this;
+  }
+
+  /**
+   * @brief Reallocate the buffer to the new capacity.
+   * @param size The number of values that are initialized in the buffer.
+   * @param newCapacity The new capacity of the buffer, the actual capacity may be larger.
+   */
+  void reallocate( std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+  {
+    if( newCapacity == 0 )
+    {
+      arrayManipulation::destroy( m_data, size );
+      free();
+      return;
+    }
+
+    std::size_t const newBytes = memoryPool::blockSize( newCapacity * sizeof( T ) );
+    T * const newPtr = static_cast< T * >( memoryPool::allocate( newBytes ) );
+
+    std::ptrdiff_t const overlapAmount = std::min( newCapacity, size );
+    arrayManipulation::uninitializedRelocate( newPtr, overlapAmount, m_data );
+    arrayManipulation::destroy( m_data + overlapAmount, size - overlapAmount );
+
+    m_registration.reallocate( m_capacity * sizeof( T ), newBytes / sizeof( T ) * sizeof( T ), overlapAmount * sizeof( T ) );
+    memoryPool::deallocate( m_data, m_capacity * sizeof( T ) );
+    m_capacity = newBytes / sizeof( T );
+    m_data = newPtr;
+  }
+
+  /**
+   * @brief Return the data to the pool but does not destroy any values.
+   * @note To destroy the values and free the data call bufferManipulation::free.
+   */
+  inline
+  void free()
+  {
+    m_registration.reallocate( m_capacity * sizeof( T ), 0, 0 );
+    m_registration.setSize( 0 );
+    memoryPool::deallocate( m_data, m_capacity * sizeof( T ) );
+    m_capacity = 0;
+    m_data = nullptr;
+  }
+
+  /**
+   * @tparam The type of the owning object.
+   * @brief Set the name associated with this buffer, used to account for its allocations.
+   * @param name the name of the buffer.
+   */
+  template< typename=VoidBuffer >
+  void setName( std::string const & name )
+  { m_registration.setName( name, m_capacity * sizeof( T ) ); }
+
+  /**
+   * @brief Set the number of values in the buffer, used to account for the bytes in use.
+   * @param size The number of values in the buffer.
+   */
+  inline
+  void registerSize( std::ptrdiff_t const size )
+  { m_registration.setSize( size * sizeof( T ) ); }
+
+  /**
+   * @brief @return Return the capacity of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  std::ptrdiff_t capacity() const
+  { return m_capacity; }
+
+  /**
+   * @brief @return Return a pointer to the beginning of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  T * data() const
+  { return m_data; }
+
+  /**
+   * @tparam INDEX_TYPE the type used to index into the values.
+   * @brief @return The value at position @p i .
+   * @param i The position of the value to access.
+   * @note No bounds checks are performed.
+   */
+  template< typename INDEX_TYPE >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T & operator[]( INDEX_TYPE const i ) const
+  { return m_data[ i ]; }
+
+private:
+
+  /// A pointer to the data.
+  T * LVARRAY_RESTRICT m_data = nullptr;
+
+  /// The capacity of the allocation.
+  std::ptrdiff_t m_capacity = 0;
+
+  /// The registration of the buffer in the allocation registry.
+  allocationRegistry::Registration m_registration;
+};
+
+} // namespace LvArray
@@ -0,0 +1,324 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+#pragma once
+
+// Source includes
+#include "LvArrayConfig.hpp"
+#include "Macros.hpp"
+#include "bufferManipulation.hpp"
+#include "AllocationRegistry.hpp"
+
+// System includes
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+
+namespace LvArray
+{
+
+/**
+ * @class SmallBuffer
+ * @brief Implements the Buffer interface with room for @p N values inline that spills over to the heap.
+ * @tparam T type of data that is contained in the buffer, must be trivially relocatable.
+ * @tparam N the number of values stored inline.
+ * @details Like StackBuffer the copy semantics are deep, so each SmallBuffer owns its allocation and
+ *   the destructor frees it. Unlike StackBuffer reallocating past @p N is not an error, the values are
+ *   moved to a heap allocation and moved back inline when the capacity shrinks to @p N or less. The
+ *   capacity is never less than @p N. Moving a SmallBuffer steals the heap allocation or relocates the
+ *   inline values, which is why T must be trivially relocatable. Only the sized copy constructor works
+ *   with types that are not trivially copyable. Only the heap allocation of a named buffer is accounted
+ *   for by the allocation registry, values stored inline are not. A copy is not named.
+ * @note The parent class provides the default execution space related methods.
+ */
+template< typename T, int N >
+class SmallBuffer : public bufferManipulation::VoidBuffer
+{
+public:
+  static_assert( N > 0, "N must be positive, use MallocBuffer for a buffer without inline storage." );
+  static_assert( isTriviallyRelocatable< T >, "The SmallBuffer can only hold trivially relocatable types." );
+
+  /// Alias used in the bufferManipulation functions.
+  using value_type = T;
+
+  /// Signifies that the SmallBuffer's copy semantics are deep.
+  constexpr static bool hasShallowCopy = false;
+
+  /**
+   * @brief Constructor for creating an empty/uninitialized buffer.
+   * @note For the SmallBuffer an uninitialized buffer is equivalent to an empty buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  SmallBuffer( bool=true ):
+    m_heap( nullptr ),
+    m_capacity( N ),
+    m_registration()
+  {}
+
+  /**
+   * @brief Copy constructor, creates a deep copy of the whole capacity.
+   * @param src The buffer to be copied.
+   */
+  DISABLE_HD_WARNING
+  LVARRAY_HOST_DEVICE inline
+  SmallBuffer( SmallBuffer const & src ):
+    SmallBuffer()
+  {
+    static_assert( std::is_trivially_copyable< T >::value, "Use the sized copy constructor." );
+    allocate( src.m_capacity );
+    std::memcpy( static_cast< void * >( data() ), src.data(), m_capacity * sizeof( T ) );
+  }
+
+  /**
+   * @brief Sized copy constructor, creates a deep copy of the first @p size values.
+   * @param src The buffer to be copied.
+   * @param size The number of values in @p src.
+   */
+  DISABLE_HD_WARNING
+  LVARRAY_HOST_DEVICE inline
+  SmallBuffer( SmallBuffer const & src, std::ptrdiff_t const size ):
+    SmallBuffer()
+  {
+    allocate( size );
+    arrayManipulation::uninitializedCopy( src.data(), src.data() + size, data() );
+  }
+
+  /**
+   * @brief Move constructor, steals the allocation of @p src or relocates its inline values.
+   * @param src The buffer to be moved from, is empty after the move.
+   */
+  LVARRAY_HOST_DEVICE inline
+  SmallBuffer( SmallBuffer && src ):
+    SmallBuffer()
+  { steal( src ); }
+
+  /**
+   * @brief Destructor, frees the heap allocation if there is one but does not destroy any values.
+   */
+  LVARRAY_HOST_DEVICE inline
+  ~SmallBuffer()
+  { free(); }
+
+  /**
+   * @brief Copy assignment operator, creates a deep copy of the whole capacity.
+   * @param src The buffer to be copied.
+   * @return *this.
+   */
+  DISABLE_HD_WARNING
+  LVARRAY_HOST_DEVICE inline
+  SmallBuffer & operator=( SmallBuffer const & src )
+  {
+    static_assert( std::is_trivially_copyable< T >::value, "SmallBuffer copy assignment requires trivially copyable values." );
+    if( this != &src )
+    {
+      free();
+      allocate( src.m_capacity );
+      std::memcpy( static_cast< void * >( data() ), src.data(), m_capacity * sizeof( T ) );
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator, steals the allocation of @p src or relocates its inline values.
+   * @param src The buffer to be moved from, is empty after the move.
+   * @return *this.
+   */
+  LVARRAY_HOST_DEVICE inline
+  SmallBuffer & operator=( SmallBuffer && src )
+  {
+    if( this != &src )
+    {
+      free();
+      steal( src );
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief Reallocate the buffer to the new capacity, which is never less than @p N.
+   * @param size The number of values that are initialized in the buffer.
+   * @param newCapacity The new capacity of the buffer.
+   */
+  DISABLE_HD_WARNING
+  LVARRAY_HOST_DEVICE inline
+  void reallocate( std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+  {
+    T * const oldData = data();
+    T * const oldHeap = m_heap;
+
+    std::ptrdiff_t const overlapAmount = newCapacity < size ? newCapacity : size;
+    arrayManipulation::destroy( oldData + overlapAmount, size - overlapAmount );
+
+    // Moving between two inline buffers is a no-op.
+    if( oldHeap == nullptr && newCapacity <= N )
+    { return; }
+
+    std::size_t const oldHeapBytes = heapBytes();
+    m_heap = nullptr;
+    m_capacity = N;
+    allocate( newCapacity );
+
+    arrayManipulation::uninitializedRelocate( data(), overlapAmount, oldData );
+    std::free( oldHeap );
+
+#if !defined(__CUDA_ARCH__)
+    m_registration.reallocate( oldHeapBytes, heapBytes(), overlapAmount * sizeof( T ) );
+    m_registration.setSize( isInline() ? 0 : overlapAmount * sizeof( T ) );
+#endif
+  }
+
+  /**
+   * @brief Free the heap allocation if there is one but does not destroy any values.
+   * @note To destroy the values and free the data call bufferManipulation::free.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void free()
+  {
+#if !defined(__CUDA_ARCH__)
+    m_registration.reallocate( heapBytes(), 0, 0 );
+    m_registration.setSize( 0 );
+#endif
+    std::free( m_heap );
+    m_heap = nullptr;
+    m_capacity = N;
+  }
+
+  /**
+   * @tparam The type of the owning object.
+   * @brief Set the name associated with this buffer, used to account for its heap allocations.
+   * @param name the name of the buffer.
+   */
+  template< typename=VoidBuffer >
+  void setName( std::string const & name )
+  { m_registration.setName( name, heapBytes() ); }
+
+  /**
+   * @brief Set the number of values in the buffer, used to account for the bytes in use on the heap.
+   * @param size The number of values in the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void registerSize( std::ptrdiff_t const size )
+  {
+#if !defined(__CUDA_ARCH__)
+    m_registration.setSize( isInline() ? 0 : size * sizeof( T ) );
+#else
+    LVARRAY_UNUSED_VARIABLE( size );
+#endif
+  }
+
+  /**
+   * @brief @return Return the capacity of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  std::ptrdiff_t capacity() const
+  { return m_capacity; }
+
+  /**
+   * @brief @return True iff the values are stored inline.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  bool isInline() const
+  { return m_heap == nullptr; }
+
+  /**
+   * @brief @return Return a pointer to the beginning of the buffer.
+   */
+  LVARRAY_HOST_DEVICE inline
+  T * data() const
+  { return m_heap != nullptr ? m_heap : reinterpret_cast< T * >( const_cast< Storage * >( m_inline ) ); }
+
+  /**
+   * @tparam INDEX_TYPE the type used to index into the values.
+   * @brief @return The value at position @p i .
+   * @param i The position of the value to access.
+   * @note No bounds checks are performed.
+   */
+  template< typename INDEX_TYPE >
+  LVARRAY_HOST_DEVICE inline
+  T & operator[]( INDEX_TYPE const i ) const
+  { return data()[ i ]; }
+
+private:
+
+  /// Uninitialized storage for a single value.
+  using Storage = std::aligned_storage_t< sizeof( T ), alignof( T ) >;
+
+  /**
+   * @brief @return The size of the heap allocation in bytes, zero if the values are stored inline.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  std::size_t heapBytes() const
+  { return isInline() ? 0 : m_capacity * sizeof( T ); }
+
+  /**
+   * @brief Allocate room for @p capacity values on the heap if they don't fit inline.
+   * @param capacity The number of values to make room for.
+   * @pre The buffer must be inline.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void allocate( std::ptrdiff_t const capacity )
+  {
+    if( capacity <= N )
+    { return; }
+
+    m_heap = static_cast< T * >( std::malloc( capacity * sizeof( T ) ) );
+    LVARRAY_ERROR_IF( m_heap == nullptr, "Failed to allocate " << capacity * sizeof( T ) << " bytes." );
+    m_capacity = capacity;
+  }
+
+  /**
+   * @brief Take the values of @p src which is left empty.
+   * @param src The buffer to take the values of.
+   * @pre The buffer must be inline.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void steal( SmallBuffer & src )
+  {
+    m_registration = src.m_registration;
+    src.m_registration = allocationRegistry::Registration();
+
+    if( src.m_heap != nullptr )
+    {
+      m_heap = src.m_heap;
+      m_capacity = src.m_capacity;
+      src.m_heap = nullptr;
+      src.m_capacity = N;
+      return;
+    }
+
+    // The size isn't known so relocate all of the inline storage.
+    std::memcpy( static_cast< void * >( m_inline ), static_cast< void const * >( src.m_inline ), sizeof( m_inline ) );
+  }
+
+  /// A pointer to the heap allocation, nullptr when the values are stored inline.
+  T * m_heap;
+
+  /// The capacity, N when the values are stored inline.
+  std::ptrdiff_t m_capacity;
+
+  /// The registration of the buffer in the allocation registry.
+  allocationRegistry::Registration m_registration;
+
+  /// The inline storage.
+  Storage m_inline[ N ];
+};
+
+} // namespace LvArray
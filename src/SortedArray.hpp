@@ -178,6 +178,20 @@ public:
   void reserve( INDEX_TYPE const nVals ) LVARRAY_RESTRICT_THIS
   { bufferManipulation::reserve( m_values, size(), nVals ); }
 
+  /**
+   * @brief @return Return the number of values the array can hold without reallocation.
+   */
+  inline
+  INDEX_TYPE capacity() const LVARRAY_RESTRICT_THIS
+  { return static_cast< INDEX_TYPE >( m_values.capacity() ); }
+
+  /**
+   * @brief Free all of the capacity beyond the size of the array.
+   */
+  inline
+  void shrinkToFit() LVARRAY_RESTRICT_THIS
+  { bufferManipulation::shrinkToFit( m_values, size() ); }
+
   /**
    * @brief Insert the given value into the array if it doesn't already exist.
    * @param value the value to insert.
@@ -188,6 +202,7 @@ public:
   {
     bool const success = sortedArrayManipulation::insert( m_values.data(), size(), value, CallBacks( m_values, size() ) );
     m_size += success;
+    bufferManipulation::registerSize( m_values, size() );
     return success;
   }
 
@@ -204,6 +219,7 @@ public:
   {
     INDEX_TYPE const nInserted = sortedArrayManipulation::insert( m_values.data(), size(), first, last, CallBacks( m_values, size() ) );
     m_size += nInserted;
+    bufferManipulation::registerSize( m_values, size() );
     return nInserted;
   }
 
@@ -217,6 +233,7 @@ public:
   {
     bool const success = sortedArrayManipulation::remove( m_values.data(), size(), value, CallBacks( m_values, size() ) );
     m_size -= success;
+    bufferManipulation::registerSize( m_values, size() );
     return success;
   }
 
@@ -233,6 +250,7 @@ public:
   {
     INDEX_TYPE const nRemoved = sortedArrayManipulation::remove( m_values.data(), size(), first, last, CallBacks( m_values, size() ) );
     m_size -= nRemoved;
+    bufferManipulation::registerSize( m_values, size() );
     return nRemoved;
   }
 
@@ -103,16 +103,25 @@ public:
    * @brief Copy assignment operator, performs a deep copy.
    * @param src the SparsityPattern to copy.
    * @return *this.
+   * @note If the buffers support sharing (see CopyOnWriteBuffer) both share the values read only,
+   *   either one has to be touched with move( MemorySpace::CPU ) before it is modified.
    */
   inline
   SparsityPattern & operator=( SparsityPattern const & src ) LVARRAY_RESTRICT_THIS
   {
     m_numCols = src.m_numCols;
-    ParentClass::setEqualTo( src.m_numArrays,
-                             src.m_offsets[ src.m_numArrays ],
-                             src.m_offsets,
-                             src.m_sizes,
-                             src.m_values );
+    if( !ParentClass::shareWith( src.m_numArrays,
+                                 src.m_offsets,
+                                 src.m_sizes,
+                                 src.m_values ) )
+    {
+      ParentClass::setEqualTo( src.m_numArrays,
+                               src.m_offsets[ src.m_numArrays ],
+                               src.m_offsets,
+                               src.m_sizes,
+                               src.m_values );
+    }
+
     return *this;
   }
 
@@ -193,6 +202,20 @@ public:
     ParentClass::setCapacityOfArray( row, newCapacity );
   }
 
+  /**
+   * @brief Set the non zero capacity of many rows at once, each row is relocated at most once.
+   * @param numRowsToChange the number of rows to modify.
+   * @param rows the rows to modify, of length @p numRowsToChange.
+   * @param newCapacities the new capacity of each row in @p rows, of length @p numRowsToChange.
+   * @note As with setRowCapacity the entries of a row are truncated if its new capacity is less than
+   *       its number of non zero entries, and a capacity greater than numColumns() is clamped.
+   */
+  inline
+  void setRowCapacities( INDEX_TYPE const numRowsToChange,
+                         INDEX_TYPE const * const rows,
+                         INDEX_TYPE const * const newCapacities ) LVARRAY_RESTRICT_THIS
+  { ParentClass::setCapacitiesOfArrays( numRowsToChange, rows, newCapacities, numColumns() ); }
+
   /**
    * @brief Compress the SparsityPattern so that the non-zeros of each row
    *        are contiguous with no extra capacity in between.
@@ -202,6 +225,25 @@ public:
   void compress() LVARRAY_RESTRICT_THIS
   { ParentClass::compress(); }
 
+  /**
+   * @tparam POLICY The RAJA policy used to relocate the rows.
+   * @brief Compress the SparsityPattern in parallel, the columns are relocated into a new
+   *        allocation of the same capacity.
+   * @note This method doesn't free any memory.
+   */
+  template< typename POLICY >
+  inline
+  void compress() LVARRAY_RESTRICT_THIS
+  { ParentClass::template compress< POLICY >(); }
+
+  /**
+   * @brief Compress the SparsityPattern and free all of the unused capacity.
+   * @note Inserting a non-zero afterwards requires a reallocation.
+   */
+  inline
+  void shrinkToFit() LVARRAY_RESTRICT_THIS
+  { ParentClass::shrinkToFit(); }
+
   /**
    * @brief Set the dimensions of the matrix.
    * @param nRows the new number of rows.
@@ -219,13 +261,14 @@ public:
   /**
    * @tparam POLICY The RAJA policy used to convert @p rowCapacities into the offsets array.
    *   Should NOT be a device policy.
+   * @tparam FIRST_TOUCH If true the storage of the rows is first touched with @p POLICY.
    * @brief Clears the array and creates a new array with the given number of sub-arrays.
    * @param nRows The new number of rows.
    * @param nCols The new number of columns.
    * @param rowCapacities A pointer to an array of length @p nRows containing the capacity
    *   of each new sub array.
    */
-  template< typename POLICY >
+  template< typename POLICY, bool FIRST_TOUCH=false >
   void resizeFromRowCapacities( INDEX_TYPE const nRows, INDEX_TYPE const nCols, INDEX_TYPE const * const rowCapacities )
   {
     LVARRAY_ERROR_IF( !arrayManipulation::isPositive( nCols ), "nCols must be positive." );
@@ -233,7 +276,7 @@ public:
                       "COL_TYPE must be able to hold the range of columns: [0, " << nCols - 1 << "]." );
 
     m_numCols = nCols;
-    ParentClass::template resizeFromCapacities< POLICY >( nRows, rowCapacities );
+    ParentClass::template resizeFromCapacities< POLICY, FIRST_TOUCH >( nRows, rowCapacities );
   }
 
 
@@ -0,0 +1,217 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+/**
+ * @file TiledArray.hpp
+ */
+
+#pragma once
+
+// Source includes
+#include "TiledArrayView.hpp"
+#include "IntegerConversion.hpp"
+#include "bufferManipulation.hpp"
+
+namespace LvArray
+{
+
+/**
+ * @class TiledArray
+ * @brief This class provides a resizeable multidimensional array stored in tiles along the first dimension.
+ * @tparam T type of data that is contained by the array.
+ * @tparam NDIM number of dimensions in array.
+ * @tparam TILE_SIZE the number of values of the first dimension stored in a tile, usually the SIMD width.
+ * @tparam INDEX_TYPE the integer to use for indexing.
+ * @tparam BUFFER_TYPE A class that defines how to actually allocate memory for the Array. Must take
+ *         one template argument that describes the type of the data being stored (T).
+ * @details See TiledArrayView for the layout. Since an element never spans tiles resizing only the first
+ *   dimension preserves the values, like Array::resizeDefaultDimension with the first dimension as the
+ *   default. The padding at the end of the last tile is initialized like any other value.
+ */
+template< typename T,
+          int NDIM,
+          int TILE_SIZE,
+          typename INDEX_TYPE,
+          template< typename > class BUFFER_TYPE >
+class TiledArray : public TiledArrayView< T, NDIM, TILE_SIZE, INDEX_TYPE, BUFFER_TYPE >
+{
+public:
+
+  /// Alias for the parent class.
+  using ParentClass = TiledArrayView< T, NDIM, TILE_SIZE, INDEX_TYPE, BUFFER_TYPE >;
+
+  // Aliasing public methods of TiledArrayView.
+  using ParentClass::size;
+  using ParentClass::paddedSize;
+  using ParentClass::data;
+
+  /// The view type.
+  using typename ParentClass::ViewType;
+
+  /// The view type with const values.
+  using typename ParentClass::ViewTypeConst;
+
+  /**
+   * @brief Default constructor, creates an empty array.
+   */
+  TiledArray():
+    ParentClass( true )
+  {
+    this->calculateStrides();
+    setName( "" );
+  }
+
+  /**
+   * @tparam DIMS A variadic pack of integral types.
+   * @brief Constructor that takes in the dimensions.
+   * @param dims The dimensions of the array.
+   */
+  template< typename ... DIMS,
+            typename=std::enable_if_t< sizeof ... ( DIMS ) == NDIM &&
+                                       all_of_t< std::is_integral< DIMS > ... >::value > >
+  explicit TiledArray( DIMS const ... dims ):
+    TiledArray()
+  { resize( dims ... ); }
+
+  /**
+   * @brief Copy constructor, performs a deep copy.
+   * @param source The array to copy.
+   */
+  TiledArray( TiledArray const & source ):
+    TiledArray()
+  { *this = source; }
+
+  /**
+   * @brief Move constructor.
+   * @param source The array to move from, it is empty after the move.
+   */
+  TiledArray( TiledArray && source ) = default;
+
+  /**
+   * @brief Destructor, frees the data.
+   */
+  ~TiledArray()
+  { bufferManipulation::free( m_dataBuffer, paddedSize() ); }
+
+  /**
+   * @brief Copy assignment operator, performs a deep copy.
+   * @param rhs The array to copy.
+   * @return *this.
+   */
+  TiledArray & operator=( TiledArray const & rhs )
+  {
+    bufferManipulation::copyInto( m_dataBuffer, paddedSize(), rhs.m_dataBuffer, rhs.paddedSize() );
+    for( int i = 0; i < NDIM; ++i )
+    {
+      m_dims[ i ] = rhs.m_dims[ i ];
+    }
+
+    this->calculateStrides();
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator.
+   * @param rhs The array to move from, it is empty after the move.
+   * @return *this.
+   */
+  TiledArray & operator=( TiledArray && rhs )
+  {
+    bufferManipulation::free( m_dataBuffer, paddedSize() );
+    ParentClass::operator=( std::move( rhs ) );
+    return *this;
+  }
+
+  /**
+   * @brief Set all values to @p rhs.
+   * @param rhs The value to set.
+   * @return *this.
+   */
+  TiledArray & operator=( T const & rhs )
+  {
+    ParentClass::operator=( rhs );
+    return *this;
+  }
+
+  /**
+   * @brief @return Return a reference to *this as a view.
+   */
+  ViewType & toView() const
+  { return reinterpret_cast< ViewType & >( *this ); }
+
+  /**
+   * @brief @return Return a reference to *this as a view of const values.
+   */
+  ViewTypeConst & toViewConst() const
+  { return reinterpret_cast< ViewTypeConst & >( *this ); }
+
+  /**
+   * @tparam DIMS A variadic pack of integral types.
+   * @brief Resize the array.
+   * @param newDims The new dimensions, must be of length NDIM.
+   * @note The values are preserved if only the first dimension changes.
+   */
+  template< typename ... DIMS >
+  std::enable_if_t< sizeof ... ( DIMS ) == NDIM && all_of_t< std::is_integral< DIMS > ... >::value >
+  resize( DIMS const ... newDims )
+  {
+    INDEX_TYPE const oldPaddedSize = paddedSize();
+
+    int curDim = 0;
+    forEachArg( [&curDim, dims=m_dims]( auto const newDim )
+    {
+      dims[ curDim ] = integerConversion< INDEX_TYPE >( newDim );
+      LVARRAY_ERROR_IF_LT( dims[ curDim ], 0 );
+      ++curDim;
+    }, newDims ... );
+
+    this->calculateStrides();
+    bufferManipulation::resize( m_dataBuffer, oldPaddedSize, paddedSize() );
+  }
+
+  /**
+   * @brief Resize the first dimension, preserving the values.
+   * @param newSize The new size of the first dimension.
+   */
+  void resize( INDEX_TYPE const newSize )
+  {
+    LVARRAY_ERROR_IF_LT( newSize, 0 );
+    INDEX_TYPE const oldPaddedSize = paddedSize();
+    m_dims[ 0 ] = newSize;
+    bufferManipulation::resize( m_dataBuffer, oldPaddedSize, paddedSize() );
+  }
+
+  /**
+   * @brief Set the first dimension to zero, the other dimensions are unchanged.
+   */
+  void clear()
+  { resize( INDEX_TYPE( 0 ) ); }
+
+  /**
+   * @brief Set the name to be displayed whenever the underlying Buffer's user call back is called.
+   * @param name The name to associate with this TiledArray.
+   */
+  void setName( std::string const & name )
+  { m_dataBuffer.template setName< decltype( *this ) >( name ); }
+
+private:
+  using ParentClass::m_dims;
+  using ParentClass::m_dataBuffer;
+};
+
+} // namespace LvArray
@@ -0,0 +1,432 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+/**
+ * @file TiledArrayView.hpp
+ */
+
+#pragma once
+
+// Source includes
+#include "ArraySlice.hpp"
+#include "Macros.hpp"
+#include "arrayHelpers.hpp"
+#include "bufferManipulation.hpp"
+
+namespace LvArray
+{
+
+/**
+ * @class TiledArrayView
+ * @brief This class serves to provide a "view" of a multidimensional array stored in tiles
+ *   of @p TILE_SIZE values along the first dimension, an array of structs of arrays.
+ * @tparam T type of data that is contained by the array.
+ * @tparam NDIM number of dimensions in array.
+ * @tparam TILE_SIZE the number of values of the first dimension stored in a tile, usually the SIMD width.
+ * @tparam INDEX_TYPE the integer to use for indexing.
+ * @tparam BUFFER_TYPE A class that defines how to actually allocate memory for the Array. Must take
+ *         one template argument that describes the type of the data being stored (T).
+ * @details Given an array of dimension (N, M, P) tile t holds the values with first index in
+ *   [t * TILE_SIZE, (t + 1) * TILE_SIZE) and is laid out like an array of dimension (M, P, TILE_SIZE):
+ * @code
+ *   A( i, j, k ) = A.data()[ ( i / TILE_SIZE ) * TILE_SIZE * M * P + ( j * P + k ) * TILE_SIZE + i % TILE_SIZE ]
+ * @endcode
+ *   The values of a single element A[ i ] stay within one tile, and the same component of consecutive
+ *   elements is contiguous. The last tile is padded, so the allocation holds numTiles() * tileStride() values.
+ *
+ *   Slicing off the first index gives a regular ArraySlice of the element without a unit stride dimension.
+ *   tile() returns a regular ArraySlice of a whole tile whose first dimension has unit stride, looping
+ *   over that dimension innermost processes TILE_SIZE elements per vector instruction.
+ */
+template< typename T,
+          int NDIM,
+          int TILE_SIZE,
+          typename INDEX_TYPE,
+          template< typename > class BUFFER_TYPE >
+class TiledArrayView
+{
+public:
+
+  static_assert( NDIM >= 1, "The dimension of the TiledArrayView must be positive." );
+  static_assert( TILE_SIZE > 0, "The tile size must be positive." );
+  static_assert( std::is_integral< INDEX_TYPE >::value, "INDEX_TYPE must be integral." );
+
+  /// The number of dimensions.
+  static constexpr int ndim = NDIM;
+
+  /// The number of values of the first dimension in each tile.
+  static constexpr int tileSize = TILE_SIZE;
+
+  /// The type when converted to a view.
+  using ViewType = TiledArrayView< T, NDIM, TILE_SIZE, INDEX_TYPE, BUFFER_TYPE > const;
+
+  /// The type when converted to a view of const values.
+  using ViewTypeConst = TiledArrayView< T const, NDIM, TILE_SIZE, INDEX_TYPE, BUFFER_TYPE > const;
+
+  /// The type of a single element, the result of operator[].
+  using ElementType = ArraySlice< T, NDIM - 1, -1, INDEX_TYPE >;
+
+  /// The type of a tile, the result of tile().
+  using TileType = ArraySlice< T, NDIM, 0, INDEX_TYPE >;
+
+  /// The type of the values.
+  using value_type = T;
+
+  /**
+   * @brief A constructor to create an uninitialized TiledArrayView.
+   * @note An uninitialized TiledArrayView should not be used until it is assigned to.
+   */
+  TiledArrayView() = default;
+
+  /**
+   * @brief Copy constructor, creates a shallow copy.
+   * @param source The object to copy.
+   * @note The copy constructor will trigger the copy constructor for @tparam BUFFER_TYPE.
+   */
+  DISABLE_HD_WARNING
+  inline LVARRAY_HOST_DEVICE constexpr
+  TiledArrayView( TiledArrayView const & source ) noexcept:
+    m_dataBuffer{ source.m_dataBuffer, source.paddedSize() },
+    m_tileStride( source.m_tileStride )
+  { copyShape( source ); }
+
+  /**
+   * @brief Move constructor, creates a shallow copy and invalidates the source.
+   * @param source object to move.
+   */
+  inline LVARRAY_HOST_DEVICE constexpr
+  TiledArrayView( TiledArrayView && source ):
+    m_dataBuffer( std::move( source.m_dataBuffer ) ),
+    m_tileStride( source.m_tileStride )
+  {
+    copyShape( source );
+    source.clearShape();
+  }
+
+  /**
+   * @brief Copy assignment operator, creates a shallow copy.
+   * @param rhs object to copy.
+   * @return *this.
+   */
+  DISABLE_HD_WARNING
+  inline LVARRAY_HOST_DEVICE constexpr
+  TiledArrayView & operator=( TiledArrayView const & rhs ) noexcept
+  {
+    m_dataBuffer = rhs.m_dataBuffer;
+    m_tileStride = rhs.m_tileStride;
+    copyShape( rhs );
+    return *this;
+  }
+
+  /**
+   * @brief Move assignment operator, creates a shallow copy and invalidates the source.
+   * @param rhs The object to move.
+   * @return *this.
+   */
+  inline LVARRAY_HOST_DEVICE constexpr
+  TiledArrayView & operator=( TiledArrayView && rhs )
+  {
+    m_dataBuffer = std::move( rhs.m_dataBuffer );
+    m_tileStride = rhs.m_tileStride;
+    copyShape( rhs );
+    rhs.clearShape();
+    return *this;
+  }
+
+  /**
+   * @brief Set all values, including the padding, to @p rhs.
+   * @param rhs The value to set.
+   * @return *this.
+   */
+  DISABLE_HD_WARNING
+  inline LVARRAY_HOST_DEVICE constexpr
+  TiledArrayView const & operator=( T const & rhs ) const noexcept
+  {
+    INDEX_TYPE const length = paddedSize();
+    T * const dataPtr = data();
+    for( INDEX_TYPE a = 0; a < length; ++a )
+    {
+      dataPtr[ a ] = rhs;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief @return Return *this as a view.
+   */
+  inline LVARRAY_HOST_DEVICE constexpr
+  ViewType & toView() const
+  { return reinterpret_cast< ViewType & >( *this ); }
+
+  /**
+   * @brief @return Return *this as a view of const values.
+   */
+  inline LVARRAY_HOST_DEVICE constexpr
+  ViewTypeConst & toViewConst() const
+  { return reinterpret_cast< ViewTypeConst & >( *this ); }
+
+  /**
+   * @brief @return Return *this interpret as TiledArrayView<T const> const &.
+   */
+  template< typename U = T >
+  inline LVARRAY_HOST_DEVICE constexpr
+  operator std::enable_if_t< !std::is_const< U >::value, ViewTypeConst & >() const noexcept
+  { return toViewConst(); }
+
+  /**
+   * @brief @return Return the number of values, not counting the padding.
+   */
+  LVARRAY_HOST_DEVICE inline
+  INDEX_TYPE size() const noexcept
+  { return multiplyAll< NDIM >( m_dims ); }
+
+  /**
+   * @brief @return Return the length of the given dimension.
+   * @param dim The dimension to get the length of.
+   */
+  LVARRAY_HOST_DEVICE inline
+  INDEX_TYPE size( int const dim ) const noexcept
+  {
+#ifdef USE_ARRAY_BOUNDS_CHECK
+    LVARRAY_ASSERT_GE( dim, 0 );
+    LVARRAY_ASSERT_GT( NDIM, dim );
+#endif
+    return m_dims[ dim ];
+  }
+
+  /**
+   * @brief @return Return true if the array is empty.
+   */
+  inline bool empty() const
+  { return size() == 0; }
+
+  /**
+   * @brief @return Return the number of tiles, the last one may be partially filled.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  INDEX_TYPE numTiles() const noexcept
+  { return ( m_dims[ 0 ] + TILE_SIZE - 1 ) / TILE_SIZE; }
+
+  /**
+   * @brief @return Return the number of values in a tile.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  INDEX_TYPE tileStride() const noexcept
+  { return m_tileStride; }
+
+  /**
+   * @brief @return Return the number of values in the allocation, including the padding of the last tile.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  INDEX_TYPE paddedSize() const noexcept
+  { return numTiles() * m_tileStride; }
+
+  /**
+   * @brief @return Return a slice of the element with first index @p index.
+   * @param index The index of the element.
+   * @note This method is only active when NDIM > 1.
+   */
+  template< int U=NDIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  std::enable_if_t< (U > 1), ElementType >
+  operator[]( INDEX_TYPE const index ) const noexcept LVARRAY_RESTRICT_THIS
+  {
+    ARRAY_SLICE_CHECK_BOUNDS( index );
+    return ElementType( data() + elementOffset( index ), m_dims + 1, m_strides + 1 );
+  }
+
+  /**
+   * @brief @return Return a reference to the value at the given index.
+   * @param index The index of the value to access.
+   * @note This method is only active when NDIM == 1, in which case the layout is contiguous.
+   */
+  template< int U=NDIM >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  std::enable_if_t< U == 1, T & >
+  operator[]( INDEX_TYPE const index ) const noexcept LVARRAY_RESTRICT_THIS
+  {
+    ARRAY_SLICE_CHECK_BOUNDS( index );
+    return data()[ index ];
+  }
+
+  /**
+   * @tparam INDICES A variadic pack of integral types.
+   * @brief @return Return a reference to the value at the given multidimensional index.
+   * @param indices The indices of the value to access.
+   */
+  template< typename ... INDICES >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T & operator()( INDICES... indices ) const
+  {
+    static_assert( sizeof ... (INDICES) == NDIM, "number of indices does not match NDIM" );
+    return data()[ linearIndex( indices ... ) ];
+  }
+
+  /**
+   * @tparam INDICES A variadic pack of integral types.
+   * @brief @return Return the offset into data() of the value at the given multidimensional index.
+   * @param index The index into the first dimension.
+   * @param indices The indices into the remaining dimensions.
+   */
+  template< typename INDEX, typename ... INDICES >
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  INDEX_TYPE linearIndex( INDEX const index, INDICES const ... indices ) const
+  {
+    static_assert( 1 + sizeof ... (INDICES) == NDIM, "number of indices does not match NDIM" );
+#ifdef USE_ARRAY_BOUNDS_CHECK
+    checkIndices( m_dims, index, indices ... );
+#endif
+    // The leading zero takes the place of the lane, which elementOffset accounts for, this way NDIM == 1 works too.
+    return elementOffset( index ) + getLinearIndex< -1 >( m_strides, INDEX_TYPE( 0 ), indices ... );
+  }
+
+  /**
+   * @brief @return Return a slice of the tile @p t, the first dimension is the lane within the tile.
+   * @param t The tile to get.
+   * @note The slice always has TILE_SIZE lanes, in the last tile the lanes past size( 0 ) are padding.
+   */
+  LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+  TileType tile( INDEX_TYPE const t ) const noexcept LVARRAY_RESTRICT_THIS
+  {
+#ifdef USE_ARRAY_BOUNDS_CHECK
+    LVARRAY_ERROR_IF( t < 0 || t >= numTiles(), "Tile Bounds Check Failed: t=" << t << " numTiles()=" << numTiles() );
+#endif
+    return TileType( data() + t * m_tileStride, m_tileDims, m_strides );
+  }
+
+  /**
+   * @brief @return Return a pointer to the values.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  T * data() const
+  { return m_dataBuffer.data(); }
+
+  /**
+   * @brief @return A pointer to the array containing the size of each dimension.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  INDEX_TYPE const * dims() const noexcept
+  { return m_dims; }
+
+  /**
+   * @brief @return A pointer to the array containing the stride of each dimension within a tile,
+   *   the first entry is the unit stride between lanes.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  INDEX_TYPE const * strides() const noexcept
+  { return m_strides; }
+
+  /**
+   * @brief Move the array to the given execution space, optionally touching it.
+   * @param space the space to move the array to.
+   * @param touch whether the array should be touched in the new space or not.
+   * @note Not all Buffers support memory movement.
+   */
+  void move( MemorySpace const space, bool const touch=true ) const
+  { m_dataBuffer.move( space, paddedSize(), touch ); }
+
+protected:
+
+  /**
+   * @brief Protected constructor to be used by the TiledArray class.
+   * @note The unused boolean parameter is to distinguish this from the default constructor.
+   */
+  DISABLE_HD_WARNING
+  LVARRAY_HOST_DEVICE inline explicit
+  TiledArrayView( bool ) noexcept:
+    m_dataBuffer( true )
+  {}
+
+  /**
+   * @brief @return The offset into data() of the first value of the element @p index.
+   * @param index The index of the element.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  INDEX_TYPE elementOffset( INDEX_TYPE const index ) const noexcept
+  { return ( index / TILE_SIZE ) * m_tileStride + index % TILE_SIZE; }
+
+  /**
+   * @brief Calculate the strides and the tile dimensions from the dimensions.
+   */
+  LVARRAY_HOST_DEVICE inline
+  void calculateStrides() noexcept
+  {
+    m_tileDims[ 0 ] = TILE_SIZE;
+    m_strides[ 0 ] = 1;
+
+    INDEX_TYPE stride = TILE_SIZE;
+    for( int i = NDIM - 1; i > 0; --i )
+    {
+      m_tileDims[ i ] = m_dims[ i ];
+      m_strides[ i ] = stride;
+      stride *= m_dims[ i ];
+    }
+
+    m_tileStride = stride;
+  }
+
+  /// The dimensions of the array.
+  INDEX_TYPE m_dims[ NDIM ] = { 0 };
+
+  /// The dimensions of a tile, { TILE_SIZE, m_dims[ 1 ], ... }.
+  INDEX_TYPE m_tileDims[ NDIM ] = { 0 };
+
+  /// The strides within a tile, m_strides[ 0 ] is always 1.
+  INDEX_TYPE m_strides[ NDIM ] = { 0 };
+
+  /// The buffer holding the values.
+  BUFFER_TYPE< T > m_dataBuffer;
+
+  /// The number of values in a tile.
+  INDEX_TYPE m_tileStride = 0;
+
+private:
+
+  /**
+   * @brief Copy the dimensions and strides of @p src.
+   * @param src The view to copy the shape of.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  void copyShape( TiledArrayView const & src ) noexcept
+  {
+    for( int i = 0; i < NDIM; ++i )
+    {
+      m_dims[ i ] = src.m_dims[ i ];
+      m_tileDims[ i ] = src.m_tileDims[ i ];
+      m_strides[ i ] = src.m_strides[ i ];
+    }
+  }
+
+  /**
+   * @brief Reset the shape to that of an empty array.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  void clearShape() noexcept
+  {
+    for( int i = 0; i < NDIM; ++i )
+    {
+      m_dims[ i ] = 0;
+      m_tileDims[ i ] = 0;
+      m_strides[ i ] = 0;
+    }
+
+    m_tileStride = 0;
+  }
+};
+
+} // namespace LvArray
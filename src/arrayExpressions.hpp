@@ -0,0 +1,495 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+/**
+ * @file arrayExpressions.hpp
+ * @brief Lazy elementwise expressions over ArraySlices and ArrayViews that are evaluated in a single loop.
+ * @details An expression is built from operands wrapped with expressions::ref and combined with +, -,
+ *   elementwise *, multiplication and division by a scalar and expressions::map. Nothing is computed until
+ *   expressions::assign is called, which evaluates the whole expression in one pass over the destination,
+ *   for example
+ *   @code
+ *   using namespace LvArray::expressions;
+ *   assign( u, ref( u ) + dt * ref( v ) - c * ref( w ) );
+ *   @endcode
+ *   Every operand is indexed with its own dimensions and strides, so operands with different permutations
+ *   can be mixed.
+ */
+
+#pragma once
+
+// Source includes
+#include "ArraySlice.hpp"
+#include "ArrayView.hpp"
+#include "sliceHelpers.hpp"
+
+// System includes
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace LvArray
+{
+
+/**
+ * @brief Contains the expression templates.
+ */
+namespace expressions
+{
+
+/**
+ * @class Expression
+ * @brief The base of every expression, only used to restrict the operators to expressions.
+ * @tparam DERIVED The type of the expression.
+ */
+template< typename DERIVED >
+class Expression
+{
+public:
+
+  /**
+   * @brief @return Return this as a DERIVED.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr
+  DERIVED const & derived() const
+  { return static_cast< DERIVED const & >( *this ); }
+};
+
+/**
+ * @class Terminal
+ * @brief An expression that reads the values of a slice.
+ * @tparam SLICE The type of the slice, an immutable ArraySlice.
+ */
+template< typename SLICE >
+class Terminal : public Expression< Terminal< SLICE > >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param slice The slice to read from.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr explicit
+  Terminal( SLICE const & slice ):
+    m_slice( slice )
+  {}
+
+  /**
+   * @tparam INDICES A variadic pack of integral types.
+   * @brief @return Return the value at the given multidimensional index.
+   * @param indices The indices of the value to access.
+   */
+  template< typename ... INDICES >
+  LVARRAY_HOST_DEVICE inline constexpr
+  decltype( auto ) operator()( INDICES const ... indices ) const
+  { return m_slice( indices ... ); }
+
+  /**
+   * @tparam DST The type of the destination slice.
+   * @brief Check that the slice has the same dimensions as @p dst.
+   * @param dst The slice the expression will be assigned to.
+   */
+  template< typename DST >
+  void checkSizes( DST const & dst ) const
+  {
+    static_assert( SLICE::ndim == DST::ndim, "The operand and destination dimensions must match." );
+    for( int dim = 0; dim < DST::ndim; ++dim )
+    {
+      LVARRAY_ERROR_IF_NE_MSG( m_slice.size( dim ), dst.size( dim ),
+                               "The operand and destination sizes don't match in dimension " << dim );
+    }
+  }
+
+private:
+  /// The slice to read from.
+  SLICE const m_slice;
+};
+
+/**
+ * @class Scalar
+ * @brief An expression that has the same value at every index.
+ * @tparam T The type of the value.
+ */
+template< typename T >
+class Scalar : public Expression< Scalar< T > >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param value The value of the expression.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr explicit
+  Scalar( T const & value ):
+    m_value( value )
+  {}
+
+  /**
+   * @tparam INDICES A variadic pack of integral types.
+   * @brief @return Return the value.
+   */
+  template< typename ... INDICES >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T const & operator()( INDICES const ... ) const
+  { return m_value; }
+
+  /**
+   * @tparam DST The type of the destination slice.
+   * @brief A scalar matches every destination.
+   */
+  template< typename DST >
+  void checkSizes( DST const & ) const
+  {}
+
+private:
+  /// The value of the expression.
+  T const m_value;
+};
+
+/**
+ * @class Map
+ * @brief An expression that applies a function to the values of other expressions at each index.
+ * @tparam F The type of the function.
+ * @tparam ARGS The types of the expressions passed to the function.
+ */
+template< typename F, typename ... ARGS >
+class Map : public Expression< Map< F, ARGS ... > >
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param f The function to apply.
+   * @param args The expressions whose values are passed to @p f.
+   */
+  LVARRAY_HOST_DEVICE inline constexpr explicit
+  Map( F const & f, ARGS const & ... args ):
+    m_f( f ),
+    m_args( args ... )
+  {}
+
+  /**
+   * @tparam INDICES A variadic pack of integral types.
+   * @brief @return Return the function applied to the values of the arguments at the given index.
+   * @param indices The indices of the value to compute.
+   */
+  template< typename ... INDICES >
+  LVARRAY_HOST_DEVICE inline constexpr
+  decltype( auto ) operator()( INDICES const ... indices ) const
+  { return evaluate( std::index_sequence_for< ARGS ... >(), indices ... ); }
+
+  /**
+   * @tparam DST The type of the destination slice.
+   * @brief Check that every argument matches the dimensions of @p dst.
+   * @param dst The slice the expression will be assigned to.
+   */
+  template< typename DST >
+  void checkSizes( DST const & dst ) const
+  { checkSizes( dst, std::index_sequence_for< ARGS ... >() ); }
+
+private:
+
+  /**
+   * @tparam I The positions of the arguments.
+   * @tparam INDICES A variadic pack of integral types.
+   * @brief @return Return the function applied to the values of the arguments at the given index.
+   * @param indices The indices of the value to compute.
+   */
+  DISABLE_HD_WARNING
+  template< std::size_t ... I, typename ... INDICES >
+  LVARRAY_HOST_DEVICE inline constexpr
+  decltype( auto ) evaluate( std::index_sequence< I ... >, INDICES const ... indices ) const
+  { return m_f( std::get< I >( m_args )( indices ... ) ... ); }
+
+  /**
+   * @tparam DST The type of the destination slice.
+   * @tparam I The positions of the arguments.
+   * @brief Check that every argument matches the dimensions of @p dst.
+   * @param dst The slice the expression will be assigned to.
+   */
+  template< typename DST, std::size_t ... I >
+  void checkSizes( DST const & dst, std::index_sequence< I ... > ) const
+  {
+    forEachArg( [&dst]( auto const & arg )
+    {
+      arg.checkSizes( dst );
+    }, std::get< I >( m_args ) ... );
+  }
+
+  /// The function to apply.
+  F const m_f;
+
+  /// The arguments of the function.
+  std::tuple< ARGS ... > const m_args;
+};
+
+/**
+ * @brief Adds two values.
+ */
+struct Plus
+{
+  /**
+   * @brief @return Return @p a + @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename A, typename B >
+  LVARRAY_HOST_DEVICE inline constexpr
+  auto operator()( A const & a, B const & b ) const
+  { return a + b; }
+};
+
+/**
+ * @brief Subtracts two values.
+ */
+struct Minus
+{
+  /**
+   * @brief @return Return @p a - @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename A, typename B >
+  LVARRAY_HOST_DEVICE inline constexpr
+  auto operator()( A const & a, B const & b ) const
+  { return a - b; }
+};
+
+/**
+ * @brief Multiplies two values.
+ */
+struct Multiplies
+{
+  /**
+   * @brief @return Return @p a * @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename A, typename B >
+  LVARRAY_HOST_DEVICE inline constexpr
+  auto operator()( A const & a, B const & b ) const
+  { return a * b; }
+};
+
+/**
+ * @brief Divides two values.
+ */
+struct Divides
+{
+  /**
+   * @brief @return Return @p a / @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename A, typename B >
+  LVARRAY_HOST_DEVICE inline constexpr
+  auto operator()( A const & a, B const & b ) const
+  { return a / b; }
+};
+
+/**
+ * @brief Negates a value.
+ */
+struct Negate
+{
+  /**
+   * @brief @return Return -@p a.
+   * @param a The value.
+   */
+  template< typename A >
+  LVARRAY_HOST_DEVICE inline constexpr
+  auto operator()( A const & a ) const
+  { return -a; }
+};
+
+/**
+ * @tparam T The type of the values in @p slice.
+ * @tparam NDIM The number of dimensions of @p slice.
+ * @tparam USD The unit stride dimension of @p slice.
+ * @tparam INDEX_TYPE The integer used to index into @p slice.
+ * @tparam STRIDES The static strides of @p slice.
+ * @brief @return Return an expression that reads the values of @p slice.
+ * @param slice The slice to read from, must outlive the expression.
+ */
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES >
+LVARRAY_HOST_DEVICE inline constexpr
+Terminal< ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES > >
+ref( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice )
+{ return Terminal< ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES > >( slice ); }
+
+/**
+ * @tparam T The type of the values in @p view.
+ * @tparam NDIM The number of dimensions of @p view.
+ * @tparam USD The unit stride dimension of @p view.
+ * @tparam INDEX_TYPE The integer used to index into @p view.
+ * @tparam BUFFER_TYPE The buffer type of @p view.
+ * @tparam STRIDES The static strides of @p view.
+ * @brief @return Return an expression that reads the values of @p view.
+ * @param view The view (or Array) to read from, must outlive the expression.
+ */
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, template< typename > class BUFFER_TYPE, typename STRIDES >
+inline
+Terminal< ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES > >
+ref( ArrayView< T, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES > const & view )
+{ return Terminal< ArraySlice< T const, NDIM, USD, INDEX_TYPE, STRIDES > >( view.toSliceConst() ); }
+
+/**
+ * @tparam F The type of the function.
+ * @tparam ARGS The types of the expressions.
+ * @brief @return Return an expression that applies @p f to the values of @p args at each index.
+ * @param f The function to apply, it is called with a value from each expression.
+ * @param args The expressions whose values are passed to @p f.
+ */
+template< typename F, typename ... ARGS >
+LVARRAY_HOST_DEVICE inline constexpr
+Map< F, ARGS ... > map( F const & f, Expression< ARGS > const & ... args )
+{ return Map< F, ARGS ... >( f, args.derived() ... ); }
+
+/**
+ * @tparam LHS The type of the left expression.
+ * @tparam RHS The type of the right expression.
+ * @brief @return Return the elementwise sum of @p lhs and @p rhs.
+ * @param lhs The left expression.
+ * @param rhs The right expression.
+ */
+template< typename LHS, typename RHS >
+LVARRAY_HOST_DEVICE inline constexpr
+Map< Plus, LHS, RHS > operator+( Expression< LHS > const & lhs, Expression< RHS > const & rhs )
+{ return Map< Plus, LHS, RHS >( Plus{}, lhs.derived(), rhs.derived() ); }
+
+/**
+ * @tparam LHS The type of the left expression.
+ * @tparam RHS The type of the right expression.
+ * @brief @return Return the elementwise difference of @p lhs and @p rhs.
+ * @param lhs The left expression.
+ * @param rhs The right expression.
+ */
+template< typename LHS, typename RHS >
+LVARRAY_HOST_DEVICE inline constexpr
+Map< Minus, LHS, RHS > operator-( Expression< LHS > const & lhs, Expression< RHS > const & rhs )
+{ return Map< Minus, LHS, RHS >( Minus{}, lhs.derived(), rhs.derived() ); }
+
+/**
+ * @tparam LHS The type of the left expression.
+ * @tparam RHS The type of the right expression.
+ * @brief @return Return the elementwise product of @p lhs and @p rhs.
+ * @param lhs The left expression.
+ * @param rhs The right expression.
+ */
+template< typename LHS, typename RHS >
+LVARRAY_HOST_DEVICE inline constexpr
+Map< Multiplies, LHS, RHS > operator*( Expression< LHS > const & lhs, Expression< RHS > const & rhs )
+{ return Map< Multiplies, LHS, RHS >( Multiplies{}, lhs.derived(), rhs.derived() ); }
+
+/**
+ * @tparam EXPR The type of the expression.
+ * @brief @return Return the elementwise negation of @p expr.
+ * @param expr The expression to negate.
+ */
+template< typename EXPR >
+LVARRAY_HOST_DEVICE inline constexpr
+Map< Negate, EXPR > operator-( Expression< EXPR > const & expr )
+{ return Map< Negate, EXPR >( Negate{}, expr.derived() ); }
+
+/**
+ * @tparam T The type of the scalar.
+ * @tparam EXPR The type of the expression.
+ * @brief @return Return @p expr scaled by @p scale.
+ * @param scale The scalar to multiply by.
+ * @param expr The expression to scale.
+ */
+template< typename T, typename EXPR >
+LVARRAY_HOST_DEVICE inline constexpr
+std::enable_if_t< std::is_arithmetic< T >::value, Map< Multiplies, Scalar< T >, EXPR > >
+operator*( T const scale, Expression< EXPR > const & expr )
+{ return Map< Multiplies, Scalar< T >, EXPR >( Multiplies{}, Scalar< T >( scale ), expr.derived() ); }
+
+/**
+ * @tparam EXPR The type of the expression.
+ * @tparam T The type of the scalar.
+ * @brief @return Return @p expr scaled by @p scale.
+ * @param expr The expression to scale.
+ * @param scale The scalar to multiply by.
+ */
+template< typename EXPR, typename T >
+LVARRAY_HOST_DEVICE inline constexpr
+std::enable_if_t< std::is_arithmetic< T >::value, Map< Multiplies, EXPR, Scalar< T > > >
+operator*( Expression< EXPR > const & expr, T const scale )
+{ return Map< Multiplies, EXPR, Scalar< T > >( Multiplies{}, expr.derived(), Scalar< T >( scale ) ); }
+
+/**
+ * @tparam EXPR The type of the expression.
+ * @tparam T The type of the scalar.
+ * @brief @return Return @p expr divided by @p scale.
+ * @param expr The expression to divide.
+ * @param scale The scalar to divide by.
+ */
+template< typename EXPR, typename T >
+LVARRAY_HOST_DEVICE inline constexpr
+std::enable_if_t< std::is_arithmetic< T >::value, Map< Divides, EXPR, Scalar< T > > >
+operator/( Expression< EXPR > const & expr, T const scale )
+{ return Map< Divides, EXPR, Scalar< T > >( Divides{}, expr.derived(), Scalar< T >( scale ) ); }
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam T The type of the values in @p dst.
+ * @tparam NDIM The number of dimensions of @p dst.
+ * @tparam USD The unit stride dimension of @p dst.
+ * @tparam INDEX_TYPE The integer used to index into @p dst.
+ * @tparam STRIDES The static strides of @p dst.
+ * @tparam EXPR The type of the expression.
+ * @brief Evaluate @p expr at every index of @p dst and store the result in @p dst.
+ * @param dst The slice to assign to.
+ * @param expr The expression to evaluate, each operand must have the same dimensions as @p dst.
+ * @details The expression is evaluated in a single pass with the policy version of forValuesInSliceWithIndices,
+ *   so the innermost loop runs over the unit stride dimension of @p dst. @p dst may appear in @p expr since
+ *   each value only depends on the operands at the same index.
+ */
+template< typename POLICY=RAJA::loop_exec, typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES, typename EXPR >
+void assign( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & dst, Expression< EXPR > const & expr )
+{
+#ifdef ARRAY_SLICE_CHECK_BOUNDS
+  expr.derived().checkSizes( dst );
+#endif
+
+  forValuesInSliceWithIndices< POLICY >( dst, [e = expr.derived()] LVARRAY_HOST_DEVICE ( T & value, auto const ... indices )
+  {
+    value = e( indices ... );
+  } );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam T The type of the values in @p dst.
+ * @tparam NDIM The number of dimensions of @p dst.
+ * @tparam USD The unit stride dimension of @p dst.
+ * @tparam INDEX_TYPE The integer used to index into @p dst.
+ * @tparam BUFFER_TYPE The buffer type of @p dst.
+ * @tparam STRIDES The static strides of @p dst.
+ * @tparam EXPR The type of the expression.
+ * @brief Evaluate @p expr at every index of @p dst and store the result in @p dst.
+ * @param dst The view (or Array) to assign to.
+ * @param expr The expression to evaluate, each operand must have the same dimensions as @p dst.
+ */
+template< typename POLICY=RAJA::loop_exec, typename T, int NDIM, int USD, typename INDEX_TYPE,
+          template< typename > class BUFFER_TYPE, typename STRIDES, typename EXPR >
+void assign( ArrayView< T, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES > const & dst, Expression< EXPR > const & expr )
+{ assign< POLICY >( dst.toSlice(), expr ); }
+
+} // namespace expressions
+} // namespace LvArray
@@ -96,8 +96,30 @@ std::enable_if_t< (SIZE > 1), T >
 multiplyAll( T const * const LVARRAY_RESTRICT values )
 { return values[ 0 ] * multiplyAll< SIZE - 1 >( values + 1 ); }
 
+/**
+ * @tparam STRIDE The stride if it is known at compile time, otherwise DYNAMIC_EXTENT.
+ * @tparam INDEX_TYPE The integral type of the stride and the type to return.
+ * @tparam INDEX The integral type of the index.
+ * @brief @return The product of @p index with the stride.
+ * @param index The index.
+ * @param stride A pointer to the stride, it is only dereferenced if @p STRIDE is DYNAMIC_EXTENT.
+ */
+template< camp::idx_t STRIDE, typename INDEX_TYPE, typename INDEX >
+LVARRAY_HOST_DEVICE inline constexpr
+INDEX_TYPE multiplyByStride( INDEX const index, INDEX_TYPE const * const LVARRAY_RESTRICT stride )
+{ return STRIDE == DYNAMIC_EXTENT ? index * stride[ 0 ] : index * INDEX_TYPE( STRIDE ); }
+
+/**
+ * @tparam USD The unit stride dimension.
+ * @tparam STRIDES A camp::idx_seq of the compile time strides, see StaticStrides.
+ * @brief The stride of the first dimension if it is known at compile time, otherwise DYNAMIC_EXTENT.
+ */
+template< int USD, typename STRIDES >
+constexpr camp::idx_t firstStaticStride = ( USD == 0 ) ? 1 : camp::seq_at< 0, STRIDES >::value;
+
 /**
  * @tparam USD The unit stride dimension of strides.
+ * @tparam STRIDES A camp::idx_seq of the compile time strides, see StaticStrides.
  * @tparam INDEX_TYPE The integral type of the strides and the type to return.
  * @tparam INDEX The integral type of the index.
  * @brief Get the index into a one dimensional space.
@@ -106,13 +128,14 @@ multiplyAll( T const * const LVARRAY_RESTRICT values )
  * @note If USD == 0 then strides[ 0 ] is assumed to equal 1.
  * @return The product of index with strides[ 0 ].
  */
-template< int USD, typename INDEX_TYPE, typename INDEX >
+template< int USD, typename STRIDES, typename INDEX_TYPE, typename INDEX >
 LVARRAY_HOST_DEVICE inline constexpr
 INDEX_TYPE getLinearIndex( INDEX_TYPE const * const LVARRAY_RESTRICT strides, INDEX const index )
-{ return ConditionalMultiply< USD == 0 >::multiply( index, strides[ 0 ] ); }
+{ return multiplyByStride< firstStaticStride< USD, STRIDES > >( index, strides ); }
 
 /**
  * @tparam USD The unit stride dimension of strides.
+ * @tparam STRIDES A camp::idx_seq of the compile time strides, see StaticStrides.
  * @tparam INDEX_TYPE The integral type of the strides and the type to return.
  * @tparam INDEX The integral type of the first index.
  * @tparam REMAINING_INDICES A variadic pack of the integral types of the remaining indices.
@@ -121,16 +144,34 @@ INDEX_TYPE getLinearIndex( INDEX_TYPE const * const LVARRAY_RESTRICT strides, IN
  * @param index The index into the first dimension.
  * @param indices A variadic pack of the indices to the remaining dimensions.
  * @note If 0 <= USD < the number of dimensions then strides[ USD ] is assumed to equal 1.
+ *   Any stride that is known at compile time is not loaded from @p strides.
  * @return The dot product of @p strides with ( @p index, @p indices ... ).
  */
-template< int USD, typename INDEX_TYPE, typename INDEX, typename ... REMAINING_INDICES >
+template< int USD, typename STRIDES, typename INDEX_TYPE, typename INDEX, typename ... REMAINING_INDICES >
 LVARRAY_HOST_DEVICE inline constexpr
 INDEX_TYPE getLinearIndex( INDEX_TYPE const * const LVARRAY_RESTRICT strides, INDEX const index, REMAINING_INDICES const ... indices )
 {
-  return ConditionalMultiply< USD == 0 >::multiply( index, strides[ 0 ] ) +
-         getLinearIndex< USD - 1, INDEX_TYPE, REMAINING_INDICES... >( strides + 1, indices ... );
+  return multiplyByStride< firstStaticStride< USD, STRIDES > >( index, strides ) +
+         getLinearIndex< USD - 1, PopFront< STRIDES > >( strides + 1, indices ... );
 }
 
+/**
+ * @tparam USD The unit stride dimension of strides.
+ * @tparam INDEX_TYPE The integral type of the strides and the type to return.
+ * @tparam INDEX The integral type of the first index.
+ * @tparam REMAINING_INDICES A variadic pack of the integral types of the remaining indices.
+ * @brief Get the index into a a multidimensional space where none of the strides are known at compile time.
+ * @param strides A pointer to the strides of the dimension.
+ * @param index The index into the first dimension.
+ * @param indices A variadic pack of the indices to the remaining dimensions.
+ * @note If 0 <= USD < the number of dimensions then strides[ USD ] is assumed to equal 1.
+ * @return The dot product of @p strides with ( @p index, @p indices ... ).
+ */
+template< int USD, typename INDEX_TYPE, typename INDEX, typename ... REMAINING_INDICES >
+LVARRAY_HOST_DEVICE inline constexpr
+INDEX_TYPE getLinearIndex( INDEX_TYPE const * const LVARRAY_RESTRICT strides, INDEX const index, REMAINING_INDICES const ... indices )
+{ return getLinearIndex< USD, DynamicStrides< 1 + sizeof ... ( REMAINING_INDICES ) > >( strides, index, indices ... ); }
+
 /// @brief @return A string representing an empty set of indices.
 inline
 std::string getIndexString()
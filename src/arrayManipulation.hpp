@@ -28,6 +28,10 @@
 
 #include "Macros.hpp"
 
+// System includes
+#include <cstring>
+#include <type_traits>
+
 #ifdef USE_ARRAY_BOUNDS_CHECK
 
 /**
@@ -68,6 +72,31 @@
 
 namespace LvArray
 {
+
+/**
+ * @tparam T The type to query.
+ * @brief Trait that is true iff an object of type @p T can be relocated by copying its bytes to a new
+ *   address and then forgetting about the old object without calling its destructor.
+ * @details By default this is true for trivially copyable types. It can be specialized for types which
+ *   are not trivially copyable but which do not hold a pointer into themselves, for example
+ *   @code
+ *   template<>
+ *   struct IsTriviallyRelocatable< MyType > : std::true_type {};
+ *   @endcode
+ *   Buffers and the array manipulation routines use this to replace element-wise moves with
+ *   @c std::realloc and @c std::memmove.
+ */
+template< typename T >
+struct IsTriviallyRelocatable : std::integral_constant< bool, std::is_trivially_copyable< T >::value >
+{};
+
+/**
+ * @tparam T The type to query.
+ * @brief True iff @p T is trivially relocatable, see IsTriviallyRelocatable.
+ */
+template< typename T >
+static constexpr bool isTriviallyRelocatable = IsTriviallyRelocatable< std::remove_cv_t< T > >::value;
+
 namespace arrayManipulation
 {
 
@@ -137,6 +166,42 @@ void uninitializedCopy( ITER first,
   }
 }
 
+/**
+ * @tparam T the storage type of the array.
+ * @brief Copy construct values from the source to the destination.
+ * @param dst pointer to the destination array, must be uninitialized memory.
+ * @param size The number of values to copy.
+ * @param src pointer to the source array, must not overlap with the destination.
+ * @details If @p T is trivially copyable this is done with a single @c std::memcpy.
+ */
+DISABLE_HD_WARNING
+template< typename T >
+LVARRAY_HOST_DEVICE inline
+void uninitializedCopy( T * const LVARRAY_RESTRICT dst,
+                        std::ptrdiff_t const size,
+                        T const * const LVARRAY_RESTRICT src )
+{
+  LVARRAY_ASSERT( dst != nullptr || size == 0 );
+  LVARRAY_ASSERT( isPositive( size ) );
+  LVARRAY_ASSERT( src != nullptr || size == 0 );
+
+  if( size == 0 )
+    return;
+
+#if !defined(__CUDA_ARCH__)
+  if( std::is_trivially_copyable< T >::value )
+  {
+    std::memcpy( static_cast< void * >( dst ), static_cast< void const * >( src ), size * sizeof( T ) );
+    return;
+  }
+#endif
+
+  for( std::ptrdiff_t i = 0; i < size; ++i )
+  {
+    new ( dst + i ) T( src[ i ] );
+  }
+}
+
 /**
  * @tparam T the storage type of the array.
  * @brief Move construct values from the source to the destination.
@@ -161,6 +226,55 @@ void uninitializedMove( T * const LVARRAY_RESTRICT dst,
   }
 }
 
+/**
+ * @tparam T the storage type of the array.
+ * @brief Relocate values from the source to the destination, afterwards the source is uninitialized.
+ * @param dst pointer to the destination array, must be uninitialized memory.
+ * @param size The number of values to relocate.
+ * @param src pointer to the source array, may overlap with the destination.
+ * @details This is equivalent to a move construct followed by a destroy of each value, but if
+ *   @p T is trivially relocatable it is done with a single @c std::memmove.
+ */
+DISABLE_HD_WARNING
+template< typename T >
+LVARRAY_HOST_DEVICE inline
+void uninitializedRelocate( T * const dst,
+                            std::ptrdiff_t const size,
+                            T * const src )
+{
+  LVARRAY_ASSERT( dst != nullptr || size == 0 );
+  LVARRAY_ASSERT( isPositive( size ) );
+  LVARRAY_ASSERT( src != nullptr || size == 0 );
+
+  if( dst == src || size == 0 )
+    return;
+
+#if !defined(__CUDA_ARCH__)
+  if( isTriviallyRelocatable< T > )
+  {
+    std::memmove( static_cast< void * >( dst ), static_cast< void const * >( src ), size * sizeof( T ) );
+    return;
+  }
+#endif
+
+  if( dst < src )
+  {
+    for( std::ptrdiff_t i = 0; i < size; ++i )
+    {
+      new ( dst + i ) T( std::move( src[ i ] ) );
+      src[ i ].~T();
+    }
+  }
+  else
+  {
+    for( std::ptrdiff_t i = size - 1; i >= 0; --i )
+    {
+      new ( dst + i ) T( std::move( src[ i ] ) );
+      src[ i ].~T();
+    }
+  }
+}
+
 /**
  * @tparam T the storage type of the array.
  * @brief Shift values down into uninitialized memory.
@@ -179,14 +293,7 @@ void uninitializedShiftDown( T * const LVARRAY_RESTRICT ptr,
   LVARRAY_ASSERT( isPositive( size ) );
   LVARRAY_ASSERT( isPositive( amount ) );
 
-  if( amount == 0 )
-    return;
-
-  for( std::ptrdiff_t j = 0; j < size; ++j )
-  {
-    new ( ptr + j - amount ) T( std::move( ptr[ j ] ) );
-    ptr[ j ].~T();
-  }
+  uninitializedRelocate( ptr - amount, size, ptr );
 }
 
 /**
@@ -207,14 +314,7 @@ void uninitializedShiftUp( T * const LVARRAY_RESTRICT ptr,
   LVARRAY_ASSERT( isPositive( size ) );
   LVARRAY_ASSERT( isPositive( amount ) );
 
-  if( amount == 0 )
-    return;
-
-  for( std::ptrdiff_t j = size - 1; j >= 0; --j )
-  {
-    new ( ptr + amount + j ) T( std::move( ptr[ j ] ) );
-    ptr[ j ].~T();
-  }
+  uninitializedRelocate( ptr + amount, size, ptr );
 }
 
 /**
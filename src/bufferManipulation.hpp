@@ -24,8 +24,15 @@
 #include "templateHelpers.hpp"
 #include "arrayManipulation.hpp"
 
+// TPL includes
+#include <RAJA/RAJA.hpp>
+
 // System includes
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
 #include <utility>
+#include <type_traits>
 
 namespace LvArray
 {
@@ -72,6 +79,39 @@ namespace bufferManipulation
  */
 IS_VALID_EXPRESSION( HasMemberFunction_move, CLASS, std::declval< CLASS >().move( MemorySpace::CPU, true ) );
 
+/**
+ * @brief Defines a static constexpr bool HasMemberFunction_share< @p CLASS >
+ *   that is true iff the method @p CLASS ::share(CLASS const &) exists.
+ * @tparam CLASS The type to test.
+ */
+IS_VALID_EXPRESSION( HasMemberFunction_share, CLASS, std::declval< CLASS & >().share( std::declval< CLASS const & >() ) );
+
+/**
+ * @brief Defines a static constexpr bool HasMemberFunction_registerSize< @p CLASS >
+ *   that is true iff the method @p CLASS ::registerSize(std::ptrdiff_t) exists.
+ * @tparam CLASS The type to test.
+ */
+IS_VALID_EXPRESSION( HasMemberFunction_registerSize, CLASS, std::declval< CLASS & >().registerSize( std::ptrdiff_t( 0 ) ) );
+
+/**
+ * @tparam BUFFER The buffer type.
+ * @brief The alignment in bytes that the allocations of @p BUFFER are guaranteed to have.
+ * @details This is alignof( BUFFER::value_type ) unless the buffer declares a
+ *   static constexpr std::size_t alignment member.
+ */
+template< typename BUFFER, typename=void >
+struct Alignment : std::integral_constant< std::size_t, alignof( typename BUFFER::value_type ) >
+{};
+
+/**
+ * @tparam BUFFER The buffer type.
+ * @brief Specialization for buffers that declare their alignment.
+ */
+template< typename BUFFER >
+struct Alignment< BUFFER, std::enable_if_t< ( BUFFER::alignment > 0 ) > > :
+  std::integral_constant< std::size_t, BUFFER::alignment >
+{};
+
 /**
  * @class VoidBuffer
  * @brief This class implements the default behavior for the Buffer methods related
@@ -172,6 +212,33 @@ void checkInsert( BUFFER const & buf, std::ptrdiff_t const size, std::ptrdiff_t
 #endif
 }
 
+/**
+ * @brief Tell the buffer how many values it holds, this is used to account for the bytes in use
+ *   by the buffers that support the allocation registry, see allocationRegistry.
+ * @tparam BUFFER the buffer type, supports the allocation registry.
+ * @param buf the buffer.
+ * @param size the size of the buffer.
+ * @note The mutating functions in this namespace call this, containers that construct or destroy
+ *   values in the buffer themselves should call it afterwards.
+ */
+DISABLE_HD_WARNING
+template< typename BUFFER >
+LVARRAY_HOST_DEVICE inline
+std::enable_if_t< HasMemberFunction_registerSize< BUFFER > >
+registerSize( BUFFER & buf, std::ptrdiff_t const size )
+{ buf.registerSize( size ); }
+
+/**
+ * @brief Overload for buffers that don't support the allocation registry.
+ * @tparam BUFFER the buffer type.
+ */
+DISABLE_HD_WARNING
+template< typename BUFFER >
+LVARRAY_HOST_DEVICE inline constexpr
+std::enable_if_t< !HasMemberFunction_registerSize< BUFFER > >
+registerSize( BUFFER &, std::ptrdiff_t const )
+{}
+
 /**
  * @brief Destroy the values in the buffer and free it's memory.
  * @tparam BUFFER the buffer type.
@@ -195,10 +262,14 @@ void free( BUFFER & buf, std::ptrdiff_t const size )
   }
 #endif
 
-  T * const LVARRAY_RESTRICT data = buf.data();
-  for( std::ptrdiff_t i = 0; i < size; ++i )
+  // A buffer that shares its allocation detaches when asked for the data, so only ask when it's needed.
+  if( !std::is_trivially_destructible< T >::value || !HasMemberFunction_share< BUFFER > )
   {
-    data[ i ].~T();
+    T * const LVARRAY_RESTRICT data = buf.data();
+    for( std::ptrdiff_t i = 0; i < size; ++i )
+    {
+      data[ i ].~T();
+    }
   }
 
   buf.free();
@@ -210,6 +281,8 @@ void free( BUFFER & buf, std::ptrdiff_t const size )
  * @param buf the buffer to set the capacity of.
  * @param size the size of the buffer.
  * @param newCapacity the new capacity of the buffer.
+ * @note If the values are trivially relocatable (see IsTriviallyRelocatable) the buffer is free
+ *   to relocate them without calling their move constructors or destructors.
  */
 DISABLE_HD_WARNING
 template< typename BUFFER >
@@ -218,6 +291,11 @@ void setCapacity( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const
 {
   check( buf, size );
   buf.reallocate( size, newCapacity );
+
+  if( newCapacity < size )
+  {
+    registerSize( buf, newCapacity );
+  }
 }
 
 /**
@@ -239,24 +317,226 @@ void reserve( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const newC
   }
 }
 
+/**
+ * @brief Zero the raw storage of the values [ @p begin, @p end ) of the buffer in parallel.
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam BUFFER the buffer type.
+ * @param buf the buffer to touch.
+ * @param begin the index of the first value to touch.
+ * @param end the index one past the last value to touch, must not exceed the capacity.
+ * @details On a first-touch NUMA system a page is placed on the node of the thread that first
+ *   writes to it. Touching the values with the same policy, and therefore the same static schedule,
+ *   as the kernels that later use them keeps most of their accesses local.
+ * @note The values must be uninitialized, they are not constructed.
+ */
+template< typename POLICY, typename BUFFER >
+void firstTouch( BUFFER & buf, std::ptrdiff_t const begin, std::ptrdiff_t const end )
+{
+  using T = typename BUFFER::value_type;
+
+  LVARRAY_ASSERT( 0 <= begin );
+  LVARRAY_ASSERT( end <= buf.capacity() );
+
+  if( begin >= end )
+  { return; }
+
+  char * const storage = reinterpret_cast< char * >( buf.data() );
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< std::ptrdiff_t >( begin, end ),
+                          [storage] ( std::ptrdiff_t const i )
+  {
+    std::memset( storage + i * sizeof( T ), 0, sizeof( T ) );
+  } );
+
+  buf.registerTouch( MemorySpace::CPU );
+}
+
+/**
+ * @brief Reserve space in the buffer for at least the given capacity and first touch
+ *   any new storage in parallel.
+ * @tparam POLICY The RAJA policy used to touch the new storage, should NOT be a device policy.
+ * @tparam BUFFER the buffer type.
+ * @param buf the buffer to reserve space in.
+ * @param size the size of the buffer.
+ * @param newCapacity the new minimum capacity of the buffer.
+ * @note The existing values are relocated serially by the buffer, only [ size, capacity )
+ *   is touched with @p POLICY. See firstTouch.
+ */
+template< typename POLICY, typename BUFFER >
+void reserve( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+{
+  check( buf, size );
+
+  if( newCapacity > buf.capacity() )
+  {
+    setCapacity( buf, size, newCapacity );
+    firstTouch< POLICY >( buf, size, buf.capacity() );
+  }
+}
+
+/**
+ * @struct GrowthPolicy
+ * @brief Describes how much extra capacity dynamicReserve allocates when a buffer runs out of room.
+ * @details The requested capacity is scaled by @c percent / 100. The extra capacity is then limited
+ *   to @c maxOvershoot bytes and the size of the allocation is rounded up to a multiple of
+ *   @c granularity bytes. A value of zero disables the corresponding step.
+ */
+struct GrowthPolicy
+{
+  /// The requested capacity is scaled by percent / 100, must be at least 100.
+  int percent;
+
+  /// If not zero the size of the allocation in bytes is rounded up to a multiple of this.
+  std::size_t granularity;
+
+  /// If not zero the most extra capacity in bytes to allocate, before rounding to the granularity.
+  std::size_t maxOvershoot;
+
+  /**
+   * @brief @return The default policy which doubles the requested capacity.
+   */
+  static constexpr GrowthPolicy doubling()
+  { return { 200, 0, 0 }; }
+
+  /**
+   * @brief @return A policy which grows the requested capacity by half.
+   * @details Compared to doubling this wastes less memory in large append only arrays at the cost
+   *   of more frequent reallocations.
+   */
+  static constexpr GrowthPolicy oneAndAHalf()
+  { return { 150, 0, 0 }; }
+
+  /**
+   * @brief @return A policy which grows the requested capacity by half in whole pages and never
+   *   allocates more than @p maxOvershoot extra bytes.
+   * @param maxOvershoot The most extra capacity in bytes to allocate.
+   * @param pageSize The size of a page in bytes.
+   * @details Small buffers grow geometrically while the slack of very large buffers is bounded,
+   *   which keeps the peak memory close to the size of the data.
+   */
+  static constexpr GrowthPolicy pageGeometric( std::size_t const maxOvershoot=std::size_t( 64 ) << 20,
+                                               std::size_t const pageSize=4096 )
+  { return { 150, pageSize, maxOvershoot }; }
+
+  /**
+   * @brief @return The capacity to allocate for a buffer that needs room for @p newCapacity values.
+   * @param newCapacity The minimum capacity required.
+   * @param valueSize The size of each value in bytes.
+   */
+  std::ptrdiff_t grow( std::ptrdiff_t const newCapacity, std::size_t const valueSize ) const
+  {
+    LVARRAY_ASSERT_GE( percent, 100 );
+
+    std::ptrdiff_t overshoot = newCapacity * ( percent - 100 ) / 100;
+    if( maxOvershoot != 0 )
+    {
+      overshoot = std::min( overshoot, std::ptrdiff_t( maxOvershoot / valueSize ) );
+    }
+
+    std::ptrdiff_t capacity = newCapacity + overshoot;
+    if( granularity != 0 )
+    {
+      std::size_t const bytes = ( capacity * valueSize + granularity - 1 ) / granularity * granularity;
+      capacity = bytes / valueSize;
+    }
+
+    return capacity;
+  }
+};
+
+namespace internal
+{
+
+/**
+ * @brief @return A reference to the process wide growth policy.
+ * @note This is not synchronized, see setGrowthPolicy.
+ */
+inline GrowthPolicy & processGrowthPolicy()
+{
+  static GrowthPolicy policy = GrowthPolicy::doubling();
+  return policy;
+}
+
+} // namespace internal
+
+/**
+ * @brief Set the growth policy dynamicReserve uses when it isn't given one explicitly.
+ * @param policy The new policy.
+ * @note This is not thread safe, it must be set before any threads which append to containers are started.
+ */
+inline void setGrowthPolicy( GrowthPolicy const & policy )
+{
+  LVARRAY_ERROR_IF_LT( policy.percent, 100 );
+  internal::processGrowthPolicy() = policy;
+}
+
+/**
+ * @brief @return The growth policy dynamicReserve uses when it isn't given one explicitly,
+ *   by default this is GrowthPolicy::doubling().
+ */
+inline GrowthPolicy const & getGrowthPolicy()
+{ return internal::processGrowthPolicy(); }
+
 /**
  * @brief If the buffer's capacity is greater than newCapacity this is a no-op.
- *   Otherwise the buffer's capacity is increased to at least 2 * newCapacity.
+ *   Otherwise the buffer's capacity is increased to at least newCapacity according to @p policy.
  * @tparam BUFFER the buffer type.
  * @param buf the buffer to reserve space in.
  * @param size the size of the buffer.
  * @param newCapacity the new minimum capacity of the buffer.
+ * @param policy the growth policy.
  * @note Use this in methods which increase the size of the buffer to efficiently grow
  *   the capacity.
  */
 template< typename BUFFER >
-void dynamicReserve( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const newCapacity )
+void dynamicReserve( BUFFER & buf,
+                     std::ptrdiff_t const size,
+                     std::ptrdiff_t const newCapacity,
+                     GrowthPolicy const & policy )
 {
   check( buf, size );
 
   if( newCapacity > buf.capacity() )
   {
-    setCapacity( buf, size, 2 * newCapacity );
+    setCapacity( buf, size, policy.grow( newCapacity, sizeof( typename BUFFER::value_type ) ) );
+  }
+}
+
+/**
+ * @brief If the buffer's capacity is greater than newCapacity this is a no-op.
+ *   Otherwise the buffer's capacity is increased to at least newCapacity according to
+ *   the process wide growth policy.
+ * @tparam BUFFER the buffer type.
+ * @param buf the buffer to reserve space in.
+ * @param size the size of the buffer.
+ * @param newCapacity the new minimum capacity of the buffer.
+ */
+template< typename BUFFER >
+void dynamicReserve( BUFFER & buf,
+                     std::ptrdiff_t const size,
+                     std::ptrdiff_t const newCapacity )
+{
+  check( buf, size );
+
+  if( newCapacity > buf.capacity() )
+  {
+    setCapacity( buf, size, getGrowthPolicy().grow( newCapacity, sizeof( typename BUFFER::value_type ) ) );
+  }
+}
+
+/**
+ * @brief Release any capacity of the buffer beyond its size.
+ * @tparam BUFFER the buffer type.
+ * @param buf the buffer to shrink.
+ * @param size the size of the buffer.
+ */
+template< typename BUFFER >
+void shrinkToFit( BUFFER & buf, std::ptrdiff_t const size )
+{
+  check( buf, size );
+
+  if( buf.capacity() > size )
+  {
+    setCapacity( buf, size, size );
   }
 }
 
@@ -280,6 +560,7 @@ void resize( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const newSi
   reserve( buf, size, newSize );
 
   arrayManipulation::resize( buf.data(), size, newSize, std::forward< ARGS >( args )... );
+  registerSize( buf, newSize );
 
 #if !defined(__CUDA_ARCH__)
   if( newSize > 0 )
@@ -290,6 +571,48 @@ void resize( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const newSi
 }
 
 
+/**
+ * @brief Resize the buffer to the given size, constructing the new values in parallel.
+ * @tparam POLICY The RAJA policy used to construct the new values, should NOT be a device policy.
+ * @tparam BUFFER the buffer type.
+ * @tparam ARGS the types of the arguments to initialize the new values with.
+ * @param buf the buffer to resize.
+ * @param size the current size of the buffer.
+ * @param newSize the new size of the buffer.
+ * @param args the arguments to initialize the new values with, each new value is constructed
+ *   from the same arguments so they are not forwarded.
+ * @details The new values [ size, newSize ) are constructed with a static schedule over that range,
+ *   so when @p size is zero each page is first touched by the thread that processes it in a
+ *   loop over the whole buffer with the same policy. See firstTouch.
+ */
+template< typename POLICY, typename BUFFER, typename ... ARGS >
+void resize( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const newSize, ARGS const & ... args )
+{
+  using T = typename BUFFER::value_type;
+
+  check( buf, size );
+  LVARRAY_ASSERT( arrayManipulation::isPositive( newSize ) );
+
+  reserve( buf, size, newSize );
+
+  T * const values = buf.data();
+  arrayManipulation::destroy( values + newSize, size - newSize );
+
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< std::ptrdiff_t >( size, newSize ),
+                          [values, &args ...] ( std::ptrdiff_t const i )
+  {
+    new ( values + i ) T( args ... );
+  } );
+
+  registerSize( buf, newSize );
+
+  if( newSize > 0 )
+  {
+    buf.registerTouch( MemorySpace::CPU );
+  }
+}
+
+
 template< typename BUFFER, typename ... ARGS >
 void emplaceBack( BUFFER & buf, std::ptrdiff_t const size, ARGS && ... args )
 {
@@ -297,6 +620,7 @@ void emplaceBack( BUFFER & buf, std::ptrdiff_t const size, ARGS && ... args )
 
   dynamicReserve( buf, size, size + 1 );
   arrayManipulation::emplaceBack( buf.data(), size, std::forward< ARGS >( args ) ... );
+  registerSize( buf, size + 1 );
 }
 
 template< typename BUFFER, typename ... ARGS >
@@ -309,6 +633,7 @@ void emplace( BUFFER & buf,
 
   dynamicReserve( buf, size, size + 1 );
   arrayManipulation::emplace( buf.data(), size, pos, std::forward< ARGS >( args ) ... );
+  registerSize( buf, size + 1 );
 }
 
 /**
@@ -333,6 +658,7 @@ std::ptrdiff_t insert( BUFFER & buf,
   std::ptrdiff_t const nVals = iterDistance( first, last );
   dynamicReserve( buf, size, size + nVals );
   arrayManipulation::insert( buf.data(), size, pos, first, nVals );
+  registerSize( buf, size + nVals );
   return nVals;
 }
 
@@ -347,6 +673,7 @@ void popBack( BUFFER & buf, std::ptrdiff_t const size )
 {
   check( buf, size );
   arrayManipulation::popBack( buf.data(), size );
+  registerSize( buf, size - 1 );
 }
 
 /**
@@ -363,8 +690,66 @@ void erase( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const pos )
   LVARRAY_ERROR_IF_GE( pos, size );
 
   arrayManipulation::erase( buf.data(), size, pos, std::ptrdiff_t( 1 ) );
+  registerSize( buf, size - 1 );
+}
+
+/// The number of bytes copied by each iteration of a parallel copy.
+constexpr std::ptrdiff_t PARALLEL_COPY_CHUNK_BYTES = std::ptrdiff_t( 1 ) << 20;
+
+/**
+ * @brief Copy construct values from the source to the destination in parallel.
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam T the type of the values.
+ * @param dst pointer to the destination, must be uninitialized memory.
+ * @param size The number of values to copy.
+ * @param src pointer to the source, must not overlap with the destination.
+ * @details The values are split into chunks of about PARALLEL_COPY_CHUNK_BYTES which are each copied with
+ *   arrayManipulation::uninitializedCopy, so trivially copyable values are copied with a std::memcpy per chunk.
+ */
+template< typename POLICY, typename T >
+void uninitializedCopy( T * const dst, std::ptrdiff_t const size, T const * const src )
+{
+  std::ptrdiff_t const chunkSize = std::max( PARALLEL_COPY_CHUNK_BYTES / std::ptrdiff_t( sizeof( T ) ), std::ptrdiff_t( 1 ) );
+  std::ptrdiff_t const numChunks = ( size + chunkSize - 1 ) / chunkSize;
+
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< std::ptrdiff_t >( 0, numChunks ),
+                          [dst, size, src, chunkSize] ( std::ptrdiff_t const chunk )
+  {
+    std::ptrdiff_t const begin = chunk * chunkSize;
+    std::ptrdiff_t const end = std::min( begin + chunkSize, size );
+    arrayManipulation::uninitializedCopy( dst + begin, end - begin, src + begin );
+  } );
+}
+
+/**
+ * @brief Make the destination share the allocation of the source, see CopyOnWriteBuffer::share.
+ * @tparam BUFFER the buffer type, supports sharing.
+ * @param dst the destination buffer.
+ * @param dstSize the size of the destination buffer.
+ * @param src the source buffer.
+ * @return True.
+ */
+template< typename BUFFER >
+std::enable_if_t< HasMemberFunction_share< BUFFER >, bool >
+share( BUFFER & dst, std::ptrdiff_t const dstSize, BUFFER const & src )
+{
+  check( dst, dstSize );
+  dst.share( src );
+  return true;
 }
 
+/**
+ * @brief Overload for buffers that don't support sharing.
+ * @tparam BUFFER the buffer type.
+ * @return False, the values need to be copied with copyInto.
+ */
+DISABLE_HD_WARNING
+template< typename BUFFER >
+LVARRAY_HOST_DEVICE inline
+std::enable_if_t< !HasMemberFunction_share< BUFFER >, bool >
+share( BUFFER &, std::ptrdiff_t const, BUFFER const & )
+{ return false; }
+
 /**
  * @brief Copy values from the source buffer into the destination buffer.
  * @tparam DST_BUFFER the destination buffer type.
@@ -373,6 +758,9 @@ void erase( BUFFER & buf, std::ptrdiff_t const size, std::ptrdiff_t const pos )
  * @param dstSize the size of the destination buffer.
  * @param src the source buffer.
  * @param srcSize the size of the source buffer.
+ * @details Trivially copyable values are copied with a single std::memcpy, and since the current
+ *   values don't need to be kept they aren't copied if the destination is reallocated. Otherwise
+ *   the destination is resized and the values are copy assigned.
  */
 DISABLE_HD_WARNING
 template< typename DST_BUFFER, typename SRC_BUFFER >
@@ -385,15 +773,92 @@ void copyInto( DST_BUFFER & dst,
   check( dst, dstSize );
   check( src, srcSize );
 
-  resize( dst, dstSize, srcSize );
+  if( static_cast< void const * >( dst.data() ) == static_cast< void const * >( src.data() ) )
+  {
+    LVARRAY_ASSERT_EQ( dstSize, srcSize );
+    return;
+  }
 
   using T = typename DST_BUFFER::value_type;
-  T * const LVARRAY_RESTRICT dstData = dst.data();
-  T const * const LVARRAY_RESTRICT srcData = src.data();
 
-  for( std::ptrdiff_t i = 0; i < srcSize; ++i )
+  if( !std::is_trivially_copyable< T >::value )
+  {
+    resize( dst, dstSize, srcSize );
+
+    T * const LVARRAY_RESTRICT dstData = dst.data();
+    T const * const LVARRAY_RESTRICT srcData = src.data();
+    for( std::ptrdiff_t i = 0; i < srcSize; ++i )
+    {
+      dstData[ i ] = srcData[ i ];
+    }
+
+    return;
+  }
+
+  reserve( dst, 0, srcSize );
+  arrayManipulation::uninitializedCopy( dst.data(), srcSize, src.data() );
+  registerSize( dst, srcSize );
+
+#if !defined(__CUDA_ARCH__)
+  if( srcSize > 0 )
+  {
+    dst.registerTouch( MemorySpace::CPU );
+  }
+#endif
+}
+
+/**
+ * @brief Copy values from the source buffer into the destination buffer in parallel.
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam DST_BUFFER the destination buffer type.
+ * @tparam SRC_BUFFER the source buffer type.
+ * @param dst the destination buffer.
+ * @param dstSize the size of the destination buffer.
+ * @param src the source buffer.
+ * @param srcSize the size of the source buffer.
+ * @details Like the serial version except that the values are copied with @p POLICY, trivially
+ *   copyable values in chunks, see uninitializedCopy. If the destination is reallocated each page
+ *   is first touched by the thread that copies it.
+ */
+template< typename POLICY, typename DST_BUFFER, typename SRC_BUFFER >
+void copyInto( DST_BUFFER & dst,
+               std::ptrdiff_t const dstSize,
+               SRC_BUFFER const & src,
+               std::ptrdiff_t const srcSize )
+{
+  check( dst, dstSize );
+  check( src, srcSize );
+
+  if( static_cast< void const * >( dst.data() ) == static_cast< void const * >( src.data() ) )
+  {
+    LVARRAY_ASSERT_EQ( dstSize, srcSize );
+    return;
+  }
+
+  using T = typename DST_BUFFER::value_type;
+
+  if( !std::is_trivially_copyable< T >::value )
+  {
+    resize( dst, dstSize, srcSize );
+
+    T * const dstData = dst.data();
+    T const * const srcData = src.data();
+    RAJA::forall< POLICY >( RAJA::TypedRangeSegment< std::ptrdiff_t >( 0, srcSize ),
+                            [dstData, srcData] ( std::ptrdiff_t const i )
+    {
+      dstData[ i ] = srcData[ i ];
+    } );
+
+    return;
+  }
+
+  reserve( dst, 0, srcSize );
+  uninitializedCopy< POLICY >( dst.data(), srcSize, src.data() );
+  registerSize( dst, srcSize );
+
+  if( srcSize > 0 )
   {
-    dstData[ i ] = srcData[ i ];
+    dst.registerTouch( MemorySpace::CPU );
   }
 }
 
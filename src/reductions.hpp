@@ -0,0 +1,724 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+/**
+ * @file reductions.hpp
+ * @brief Reductions over the values of an ArraySlice, ArrayView or Array.
+ * @details Each reduction takes an optional RAJA policy, which should NOT be a device policy, and anything
+ *   with a toSliceConst() method. The values are split into pieces, each of which is reduced by a single
+ *   iteration of the policy into its own partial result, the partial results are then combined in order.
+ *   So the result doesn't depend on the number of threads, but for floating point values it may differ
+ *   from a naive loop. Each piece is reduced with NUM_ACCUMULATORS independent accumulators which breaks
+ *   the loop carried dependence on a single accumulator and lets the compiler vectorize the loop.
+ *
+ *   A contiguous slice is reduced as a flat range of values split into chunks of CHUNK_SIZE. Otherwise
+ *   each row along the unit stride dimension is a piece, see the policy version of forValuesInSliceWithIndices.
+ */
+
+#pragma once
+
+// Source includes
+#include "ArraySlice.hpp"
+#include "sliceHelpers.hpp"
+
+// TPL includes
+#include <RAJA/RAJA.hpp>
+
+// System includes
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace LvArray
+{
+
+/**
+ * @brief Contains the reductions over slices.
+ */
+namespace reductions
+{
+
+namespace internal
+{
+
+/// The number of independent accumulators used to reduce each piece.
+constexpr int NUM_ACCUMULATORS = 8;
+
+/// The number of values in each piece of a contiguous slice.
+constexpr std::ptrdiff_t CHUNK_SIZE = 1 << 14;
+
+/**
+ * @tparam R The type of the result.
+ * @tparam INDEX_TYPE The integer used to index the terms.
+ * @tparam COMBINE The type of the function that combines two results.
+ * @tparam TERM The type of the function that returns a term.
+ * @brief @return Return the terms [0, @p n) combined with @p combine.
+ * @param identity The identity of @p combine.
+ * @param n The number of terms.
+ * @param combine The function that combines two results, must be associative and commutative.
+ * @param term The function that returns the term at the given index.
+ */
+template< typename R, typename INDEX_TYPE, typename COMBINE, typename TERM >
+inline
+R reduceRange( R const & identity, INDEX_TYPE const n, COMBINE const & combine, TERM const & term )
+{
+  R accumulators[ NUM_ACCUMULATORS ];
+  for( int j = 0; j < NUM_ACCUMULATORS; ++j )
+  {
+    accumulators[ j ] = identity;
+  }
+
+  INDEX_TYPE i = 0;
+  for( ; i + NUM_ACCUMULATORS <= n; i += NUM_ACCUMULATORS )
+  {
+    for( int j = 0; j < NUM_ACCUMULATORS; ++j )
+    {
+      accumulators[ j ] = combine( accumulators[ j ], term( i + j ) );
+    }
+  }
+
+  for( ; i < n; ++i )
+  {
+    accumulators[ 0 ] = combine( accumulators[ 0 ], term( i ) );
+  }
+
+  for( int j = 1; j < NUM_ACCUMULATORS; ++j )
+  {
+    accumulators[ 0 ] = combine( accumulators[ 0 ], accumulators[ j ] );
+  }
+
+  return accumulators[ 0 ];
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use.
+ * @tparam R The type of the result.
+ * @tparam INDEX_TYPE The integer used to index the pieces.
+ * @tparam COMBINE The type of the function that combines two results.
+ * @tparam PIECE The type of the function that reduces a piece.
+ * @brief @return Return the result of each piece combined with @p combine.
+ * @param identity The identity of @p combine.
+ * @param numPieces The number of pieces.
+ * @param combine The function that combines two results.
+ * @param piece The function that returns the result of the given piece.
+ */
+template< typename POLICY, typename R, typename INDEX_TYPE, typename COMBINE, typename PIECE >
+R reducePieces( R const & identity, INDEX_TYPE const numPieces, COMBINE const & combine, PIECE const & piece )
+{
+  if( numPieces == 1 )
+  { return piece( 0 ); }
+
+  std::vector< R > partialResults( numPieces, identity );
+  R * const results = partialResults.data();
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numPieces ),
+                          [results, &piece] ( INDEX_TYPE const i )
+  {
+    results[ i ] = piece( i );
+  } );
+
+  R result = identity;
+  for( R const & partialResult : partialResults )
+  {
+    result = combine( result, partialResult );
+  }
+
+  return result;
+}
+
+/**
+ * @tparam T The type of the values in @p slice.
+ * @tparam NDIM The number of dimensions of @p slice.
+ * @tparam USD The unit stride dimension of @p slice.
+ * @tparam INDEX_TYPE The integer used to index into @p slice.
+ * @tparam STRIDES The static strides of @p slice.
+ * @brief @return Return a pointer to the value of @p slice at @p indices.
+ * @param slice The slice to access.
+ * @param indices The index of the value in each dimension.
+ */
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES >
+inline
+T * addressOf( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice, INDEX_TYPE const ( &indices )[ NDIM ] )
+{
+  T * address = nullptr;
+  LvArray::internal::callWithIndices( slice, [&address] ( T & value, auto const ... )
+  {
+    address = &value;
+  }, indices, std::make_index_sequence< NDIM >() );
+  return address;
+}
+
+/**
+ * @tparam SLICE An ArraySlice.
+ * @brief Contains the type of the values in SLICE without the const qualifier.
+ */
+template< typename SLICE >
+struct ValueTypeHelper;
+
+/**
+ * @tparam T The type of the values in the slice.
+ * @tparam NDIM The number of dimensions of the slice.
+ * @tparam USD The unit stride dimension of the slice.
+ * @tparam INDEX_TYPE The integer used to index into the slice.
+ * @tparam STRIDES The static strides of the slice.
+ * @brief Contains the type of the values in an ArraySlice without the const qualifier.
+ */
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES >
+struct ValueTypeHelper< ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > >
+{
+  /// The type of the values without the const qualifier.
+  using type = std::remove_const_t< T >;
+};
+
+/// The type of the values in an ARRAY without the const qualifier.
+template< typename ARRAY >
+using ValueType = typename ValueTypeHelper< std::decay_t< decltype( std::declval< ARRAY const & >().toSliceConst() ) > >::type;
+
+/**
+ * @tparam POLICY The RAJA policy to use.
+ * @tparam R The type of the result.
+ * @tparam T The type of the values in @p slice.
+ * @tparam NDIM The number of dimensions of @p slice.
+ * @tparam USD The unit stride dimension of @p slice.
+ * @tparam INDEX_TYPE The integer used to index into @p slice.
+ * @tparam STRIDES The static strides of @p slice.
+ * @tparam COMBINE The type of the function that combines two results.
+ * @tparam TRANSFORM The type of the function that converts a value into a term.
+ * @brief @return Return the values of @p slice transformed with @p transform and combined with @p combine.
+ * @param slice The slice to reduce.
+ * @param identity The identity of @p combine.
+ * @param combine The function that combines two results, must be associative and commutative.
+ * @param transform The function that converts a value into a term.
+ */
+template< typename POLICY, typename R, typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES,
+          typename COMBINE, typename TRANSFORM >
+R reduce( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice,
+          R const & identity,
+          COMBINE const & combine,
+          TRANSFORM const & transform )
+{
+  INDEX_TYPE const size = slice.size();
+  if( size == 0 )
+  { return identity; }
+
+  if( slice.isContiguous() )
+  {
+    T * const LVARRAY_RESTRICT values = slice.dataIfContiguous();
+    INDEX_TYPE const chunkSize = CHUNK_SIZE;
+    INDEX_TYPE const numChunks = ( size + chunkSize - 1 ) / chunkSize;
+    return reducePieces< POLICY >( identity, numChunks, combine, [=, &combine, &transform] ( INDEX_TYPE const chunk )
+    {
+      T * const LVARRAY_RESTRICT chunkValues = values + chunk * chunkSize;
+      INDEX_TYPE const n = std::min( chunkSize, size - chunk * chunkSize );
+      return reduceRange( identity, n, combine, [chunkValues, &transform] ( INDEX_TYPE const i )
+      {
+        return transform( chunkValues[ i ] );
+      } );
+    } );
+  }
+
+  constexpr int INNER = LvArray::internal::innerDimension< NDIM, USD >();
+  INDEX_TYPE const innerSize = slice.size( INNER );
+  return reducePieces< POLICY >( identity, size / innerSize, combine, [&] ( INDEX_TYPE const row )
+  {
+    INDEX_TYPE indices[ NDIM ];
+    LvArray::internal::outerIndices< NDIM, USD >( slice, row, indices );
+    indices[ INNER ] = 0;
+    T * const LVARRAY_RESTRICT rowValues = addressOf( slice, indices );
+
+    if( INNER == USD )
+    {
+      return reduceRange( identity, innerSize, combine, [rowValues, &transform] ( INDEX_TYPE const i )
+      {
+        return transform( rowValues[ i ] );
+      } );
+    }
+
+    indices[ INNER ] = innerSize > 1;
+    INDEX_TYPE const stride = addressOf( slice, indices ) - rowValues;
+    return reduceRange( identity, innerSize, combine, [rowValues, stride, &transform] ( INDEX_TYPE const i )
+    {
+      return transform( rowValues[ i * stride ] );
+    } );
+  } );
+}
+
+/**
+ * @brief @return Return the sum of @p a and @p b.
+ */
+struct Plus
+{
+  /**
+   * @tparam T The type of the values.
+   * @brief @return Return @p a + @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T operator()( T const & a, T const & b ) const
+  { return a + b; }
+};
+
+/**
+ * @brief The smaller of two values.
+ */
+struct Min
+{
+  /**
+   * @tparam T The type of the values.
+   * @brief @return Return the smaller of @p a and @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T operator()( T const & a, T const & b ) const
+  { return b < a ? b : a; }
+};
+
+/**
+ * @brief The larger of two values.
+ */
+struct Max
+{
+  /**
+   * @tparam T The type of the values.
+   * @brief @return Return the larger of @p a and @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  T operator()( T const & a, T const & b ) const
+  { return a < b ? b : a; }
+};
+
+/**
+ * @brief Returns a value unchanged.
+ */
+struct Identity
+{
+  /**
+   * @tparam T The type of the value.
+   * @brief @return Return @p value.
+   * @param value The value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  std::remove_const_t< T > operator()( T const & value ) const
+  { return value; }
+};
+
+/**
+ * @brief Returns the absolute value of a value.
+ */
+struct Abs
+{
+  /**
+   * @tparam T The type of the value.
+   * @brief @return Return the absolute value of @p value.
+   * @param value The value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  std::remove_const_t< T > operator()( T const & value ) const
+  { return value < 0 ? -value : value; }
+};
+
+/**
+ * @brief Returns the square of a value.
+ */
+struct Square
+{
+  /**
+   * @tparam T The type of the value.
+   * @brief @return Return @p value squared.
+   * @param value The value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  std::remove_const_t< T > operator()( T const & value ) const
+  { return value * value; }
+};
+
+/**
+ * @brief Compares two values with <.
+ */
+struct Less
+{
+  /**
+   * @tparam T The type of the values.
+   * @brief @return Return @p a < @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  bool operator()( T const & a, T const & b ) const
+  { return a < b; }
+};
+
+/**
+ * @brief Compares two values with >.
+ */
+struct Greater
+{
+  /**
+   * @tparam T The type of the values.
+   * @brief @return Return @p a > @p b.
+   * @param a The first value.
+   * @param b The second value.
+   */
+  template< typename T >
+  LVARRAY_HOST_DEVICE inline constexpr
+  bool operator()( T const & a, T const & b ) const
+  { return b < a; }
+};
+
+/**
+ * @class ValueAndIndex
+ * @brief A value and the position it was found at, used by minLoc and maxLoc.
+ * @tparam T The type of the value.
+ * @tparam INDEX_TYPE The type of the index.
+ */
+template< typename T, typename INDEX_TYPE >
+struct ValueAndIndex
+{
+  /// The value.
+  T value;
+
+  /// The position of the value.
+  INDEX_TYPE index;
+};
+
+/**
+ * @tparam T The type of the values.
+ * @brief @return Return the identity of Min, infinity if @p T has one and std::numeric_limits::max otherwise.
+ */
+template< typename T >
+inline constexpr
+T largestValue()
+{ return std::numeric_limits< T >::has_infinity ? std::numeric_limits< T >::infinity() : std::numeric_limits< T >::max(); }
+
+/**
+ * @tparam T The type of the values.
+ * @brief @return Return the identity of Max, minus infinity if @p T has one and std::numeric_limits::lowest otherwise.
+ */
+template< typename T >
+inline constexpr
+T smallestValue()
+{ return std::numeric_limits< T >::has_infinity ? -std::numeric_limits< T >::infinity() : std::numeric_limits< T >::lowest(); }
+
+/**
+ * @tparam COMPARE The comparison that decides which value wins.
+ * @brief Picks the ValueAndIndex whose value wins the comparison, ties go to the smaller index.
+ */
+template< typename COMPARE >
+struct PickLoc
+{
+  /**
+   * @tparam T The type of the values.
+   * @tparam INDEX_TYPE The type of the indices.
+   * @brief @return Return the winner of @p a and @p b.
+   * @param a The first value and index.
+   * @param b The second value and index.
+   */
+  template< typename T, typename INDEX_TYPE >
+  LVARRAY_HOST_DEVICE inline constexpr
+  ValueAndIndex< T, INDEX_TYPE > operator()( ValueAndIndex< T, INDEX_TYPE > const & a,
+                                             ValueAndIndex< T, INDEX_TYPE > const & b ) const
+  {
+    COMPARE const compare{};
+    bool const bWins = compare( b.value, a.value ) || ( !compare( a.value, b.value ) && b.index < a.index );
+    return bWins ? b : a;
+  }
+};
+
+/**
+ * @tparam POLICY The RAJA policy to use.
+ * @tparam COMPARE The comparison that decides which value wins.
+ * @tparam T The type of the values in @p slice.
+ * @tparam USD The unit stride dimension of @p slice.
+ * @tparam INDEX_TYPE The integer used to index into @p slice.
+ * @tparam STRIDES The static strides of @p slice.
+ * @brief @return Return the index of the value that wins @p COMPARE, -1 if @p slice is empty.
+ * @param slice The slice to search.
+ * @param worst The value that no value in @p slice loses to, ties with it go to the value in @p slice.
+ */
+template< typename POLICY, typename COMPARE, typename T, int USD, typename INDEX_TYPE, typename STRIDES >
+INDEX_TYPE findLoc( ArraySlice< T, 1, USD, INDEX_TYPE, STRIDES > const & slice, std::remove_const_t< T > const & worst )
+{
+  using R = ValueAndIndex< std::remove_const_t< T >, INDEX_TYPE >;
+
+  INDEX_TYPE const size = slice.size();
+  if( size == 0 )
+  { return -1; }
+
+  R const identity{ worst, std::numeric_limits< INDEX_TYPE >::max() };
+  PickLoc< COMPARE > const combine{};
+  INDEX_TYPE const chunkSize = CHUNK_SIZE;
+  INDEX_TYPE const numChunks = ( size + chunkSize - 1 ) / chunkSize;
+  return reducePieces< POLICY >( identity, numChunks, combine, [&] ( INDEX_TYPE const chunk )
+  {
+    INDEX_TYPE const offset = chunk * chunkSize;
+    INDEX_TYPE const n = std::min( chunkSize, size - offset );
+    return reduceRange( identity, n, combine, [&slice, offset] ( INDEX_TYPE const i )
+    {
+      return R{ slice[ offset + i ], offset + i };
+    } );
+  } ).index;
+}
+
+/**
+ * @tparam T The type of the values in @p a.
+ * @tparam U The type of the values in @p b.
+ * @tparam NDIM The number of dimensions.
+ * @tparam USD_A The unit stride dimension of @p a.
+ * @tparam USD_B The unit stride dimension of @p b.
+ * @tparam INDEX_TYPE The integer used to index into the slices.
+ * @tparam STRIDES_A The static strides of @p a.
+ * @tparam STRIDES_B The static strides of @p b.
+ * @brief @return Return true iff @p a and @p b are contiguous and each value is at the same offset in both.
+ * @param a The first slice.
+ * @param b The second slice, must have the same dimensions as @p a.
+ */
+template< typename T, typename U, int NDIM, int USD_A, int USD_B, typename INDEX_TYPE, typename STRIDES_A, typename STRIDES_B >
+bool haveSameLayout( ArraySlice< T, NDIM, USD_A, INDEX_TYPE, STRIDES_A > const & a,
+                     ArraySlice< U, NDIM, USD_B, INDEX_TYPE, STRIDES_B > const & b )
+{
+  if( !a.isContiguous() || !b.isContiguous() )
+  { return false; }
+
+  INDEX_TYPE indices[ NDIM ] = {};
+  T * const aValues = addressOf( a, indices );
+  U * const bValues = addressOf( b, indices );
+  for( int dim = 0; dim < NDIM; ++dim )
+  {
+    if( a.size( dim ) == 1 )
+    { continue; }
+
+    indices[ dim ] = 1;
+    if( addressOf( a, indices ) - aValues != addressOf( b, indices ) - bValues )
+    { return false; }
+
+    indices[ dim ] = 0;
+  }
+
+  return true;
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use.
+ * @tparam T The type of the values in @p a.
+ * @tparam U The type of the values in @p b.
+ * @tparam NDIM The number of dimensions.
+ * @tparam USD_A The unit stride dimension of @p a.
+ * @tparam USD_B The unit stride dimension of @p b.
+ * @tparam INDEX_TYPE The integer used to index into the slices.
+ * @tparam STRIDES_A The static strides of @p a.
+ * @tparam STRIDES_B The static strides of @p b.
+ * @brief @return Return the sum of the products of the values of @p a and @p b at each index.
+ * @param a The first slice.
+ * @param b The second slice, must have the same dimensions as @p a.
+ */
+template< typename POLICY, typename T, typename U, int NDIM, int USD_A, int USD_B, typename INDEX_TYPE,
+          typename STRIDES_A, typename STRIDES_B >
+std::remove_const_t< T > dot( ArraySlice< T, NDIM, USD_A, INDEX_TYPE, STRIDES_A > const & a,
+                              ArraySlice< U, NDIM, USD_B, INDEX_TYPE, STRIDES_B > const & b )
+{
+  using R = std::remove_const_t< T >;
+
+#ifdef ARRAY_SLICE_CHECK_BOUNDS
+  for( int dim = 0; dim < NDIM; ++dim )
+  {
+    LVARRAY_ERROR_IF_NE( a.size( dim ), b.size( dim ) );
+  }
+#endif
+
+  INDEX_TYPE const size = a.size();
+  if( size == 0 )
+  { return R( 0 ); }
+
+  Plus const combine{};
+
+  if( haveSameLayout( a, b ) )
+  {
+    INDEX_TYPE indices[ NDIM ] = {};
+    T * const LVARRAY_RESTRICT aValues = addressOf( a, indices );
+    U * const LVARRAY_RESTRICT bValues = addressOf( b, indices );
+    INDEX_TYPE const chunkSize = CHUNK_SIZE;
+    INDEX_TYPE const numChunks = ( size + chunkSize - 1 ) / chunkSize;
+    return reducePieces< POLICY >( R( 0 ), numChunks, combine, [=] ( INDEX_TYPE const chunk )
+    {
+      INDEX_TYPE const offset = chunk * chunkSize;
+      T * const LVARRAY_RESTRICT aChunk = aValues + offset;
+      U * const LVARRAY_RESTRICT bChunk = bValues + offset;
+      return reduceRange( R( 0 ), std::min( chunkSize, size - offset ), combine, [aChunk, bChunk] ( INDEX_TYPE const i )
+      {
+        return R( aChunk[ i ] * bChunk[ i ] );
+      } );
+    } );
+  }
+
+  constexpr int INNER = LvArray::internal::innerDimension< NDIM, USD_A >();
+  INDEX_TYPE const innerSize = a.size( INNER );
+  return reducePieces< POLICY >( R( 0 ), size / innerSize, combine, [&] ( INDEX_TYPE const row )
+  {
+    INDEX_TYPE indices[ NDIM ];
+    LvArray::internal::outerIndices< NDIM, USD_A >( a, row, indices );
+    indices[ INNER ] = 0;
+    T * const LVARRAY_RESTRICT aRow = addressOf( a, indices );
+    U * const LVARRAY_RESTRICT bRow = addressOf( b, indices );
+
+    indices[ INNER ] = innerSize > 1;
+    INDEX_TYPE const aStride = addressOf( a, indices ) - aRow;
+    INDEX_TYPE const bStride = addressOf( b, indices ) - bRow;
+    return reduceRange( R( 0 ), innerSize, combine, [aRow, bRow, aStride, bStride] ( INDEX_TYPE const i )
+    {
+      return R( aRow[ i * aStride ] * bRow[ i * bStride ] );
+    } );
+  } );
+}
+
+} // namespace internal
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, an ArraySlice, ArrayView or Array.
+ * @brief @return Return the sum of the values in @p array, zero if it is empty.
+ * @param array The values to sum.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+internal::ValueType< ARRAY > sum( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return internal::reduce< POLICY >( array.toSliceConst(), T( 0 ), internal::Plus{}, internal::Identity{} );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, an ArraySlice, ArrayView or Array.
+ * @brief @return Return the smallest value in @p array, infinity (or std::numeric_limits::max if @p ARRAY holds
+ *   integral values) if it is empty.
+ * @param array The values to search.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+internal::ValueType< ARRAY > min( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return internal::reduce< POLICY >( array.toSliceConst(), internal::largestValue< T >(), internal::Min{}, internal::Identity{} );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, an ArraySlice, ArrayView or Array.
+ * @brief @return Return the largest value in @p array, minus infinity (or std::numeric_limits::lowest if @p ARRAY
+ *   holds integral values) if it is empty.
+ * @param array The values to search.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+internal::ValueType< ARRAY > max( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return internal::reduce< POLICY >( array.toSliceConst(), internal::smallestValue< T >(), internal::Max{}, internal::Identity{} );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, a one dimensional ArraySlice, ArrayView or Array.
+ * @brief @return Return the index of the first occurrence of the smallest value in @p array, -1 if it is empty.
+ * @param array The values to search.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+auto minLoc( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return internal::findLoc< POLICY, internal::Less >( array.toSliceConst(), internal::largestValue< T >() );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, a one dimensional ArraySlice, ArrayView or Array.
+ * @brief @return Return the index of the first occurrence of the largest value in @p array, -1 if it is empty.
+ * @param array The values to search.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+auto maxLoc( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return internal::findLoc< POLICY, internal::Greater >( array.toSliceConst(), internal::smallestValue< T >() );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, an ArraySlice, ArrayView or Array.
+ * @brief @return Return the sum of the absolute values in @p array.
+ * @param array The values to take the norm of.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+internal::ValueType< ARRAY > l1Norm( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return internal::reduce< POLICY >( array.toSliceConst(), T( 0 ), internal::Plus{}, internal::Abs{} );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, an ArraySlice, ArrayView or Array.
+ * @brief @return Return the square root of the sum of the squares of the values in @p array, the type
+ *   is that of std::sqrt so integral values produce a double.
+ * @param array The values to take the norm of.
+ * @note No scaling is done to avoid overflow of the intermediate sum.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+auto l2Norm( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return std::sqrt( internal::reduce< POLICY >( array.toSliceConst(), T( 0 ), internal::Plus{}, internal::Square{} ) );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY The type of @p array, an ArraySlice, ArrayView or Array.
+ * @brief @return Return the largest absolute value in @p array, zero if it is empty.
+ * @param array The values to take the norm of.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY >
+internal::ValueType< ARRAY > infNorm( ARRAY const & array )
+{
+  using T = internal::ValueType< ARRAY >;
+  return internal::reduce< POLICY >( array.toSliceConst(), T( 0 ), internal::Max{}, internal::Abs{} );
+}
+
+/**
+ * @tparam POLICY The RAJA policy to use, should NOT be a device policy.
+ * @tparam ARRAY_A The type of @p a, an ArraySlice, ArrayView or Array.
+ * @tparam ARRAY_B The type of @p b, an ArraySlice, ArrayView or Array.
+ * @brief @return Return the sum of the products of the values of @p a and @p b at each index.
+ * @param a The first array.
+ * @param b The second array, must have the same dimensions as @p a but may have a different permutation.
+ * @details The values are traversed in the order of @p a. If both are contiguous and have the same layout
+ *   they are reduced as flat ranges, otherwise row by row.
+ */
+template< typename POLICY=RAJA::loop_exec, typename ARRAY_A, typename ARRAY_B >
+internal::ValueType< ARRAY_A > dot( ARRAY_A const & a, ARRAY_B const & b )
+{ return internal::dot< POLICY >( a.toSliceConst(), b.toSliceConst() ); }
+
+} // namespace reductions
+} // namespace LvArray
@@ -26,9 +26,163 @@
 // Source includes
 #include "ArraySlice.hpp"
 
+// TPL includes
+#include <RAJA/RAJA.hpp>
+
+// System includes
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace LvArray
 {
 
+namespace internal
+{
+
+/// The number of values summed by each iteration of a parallel sumOverFirstDimension of a one dimensional slice.
+constexpr std::ptrdiff_t PARALLEL_SUM_CHUNK_SIZE = 4096;
+
+/**
+ * @tparam NDIM the dimension of the slice.
+ * @tparam USD the unit stride dimension of the slice.
+ * @brief @return The dimension iterated over by the innermost loop, the unit stride dimension if there is one.
+ */
+template< int NDIM, int USD >
+LVARRAY_HOST_DEVICE inline constexpr
+int innerDimension()
+{ return USD >= 0 ? USD : NDIM - 1; }
+
+/**
+ * @tparam NDIM the dimension of @p slice.
+ * @tparam USD the unit stride dimension of @p slice.
+ * @tparam SLICE the type of @p slice.
+ * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @brief Convert @p outer into an index for every dimension of @p slice except the inner dimension.
+ * @param slice the slice being iterated over.
+ * @param outer the collapsed index of the outer loops, in [ 0, size / size( innerDimension ) ).
+ * @param indices the array to write the indices to.
+ * @details The outer dimensions are ordered by their stride, the dimension with the smallest stride varies
+ *   the fastest. So a contiguous slice of any permutation is traversed in memory order, ties go to the
+ *   dimension closest to the inner dimension.
+ */
+template< int NDIM, int USD, typename SLICE, typename INDEX_TYPE >
+LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+void outerIndices( SLICE const & slice, INDEX_TYPE outer, INDEX_TYPE ( & indices )[ NDIM ] )
+{
+  constexpr int INNER = innerDimension< NDIM, USD >();
+
+  // Insertion sort the outer dimensions by stride, there are at most a handful of them.
+  int order[ NDIM ] = {};
+  int numOuter = 0;
+  for( int distance = 1; distance < NDIM; ++distance )
+  {
+    int const dims[ 2 ] = { INNER + distance, INNER - distance };
+    for( int const dim : dims )
+    {
+      if( dim >= 0 && dim < NDIM )
+      {
+        INDEX_TYPE const stride = slice.stride( dim );
+        int pos = numOuter++;
+        for( ; pos > 0 && slice.stride( order[ pos - 1 ] ) > stride; --pos )
+        {
+          order[ pos ] = order[ pos - 1 ];
+        }
+
+        order[ pos ] = dim;
+      }
+    }
+  }
+
+  for( int i = 0; i < numOuter; ++i )
+  {
+    INDEX_TYPE const size = slice.size( order[ i ] );
+    indices[ order[ i ] ] = outer % size;
+    outer /= size;
+  }
+}
+
+/**
+ * @tparam SLICE the type of @p slice.
+ * @tparam LAMBDA the type of the function @p f to apply.
+ * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @tparam I the dimensions of @p slice.
+ * @brief Apply @p f to the value of @p slice at @p indices also passing it the indices.
+ * @param slice the slice to access.
+ * @param f the function to apply.
+ * @param indices the index of the value in each dimension.
+ */
+DISABLE_HD_WARNING
+template< typename SLICE, typename LAMBDA, typename INDEX_TYPE, std::size_t ... I >
+LVARRAY_HOST_DEVICE inline
+void callWithIndices( SLICE const & slice,
+                      LAMBDA const & f,
+                      INDEX_TYPE const * const indices,
+                      std::index_sequence< I ... > )
+{ f( slice( indices[ I ] ... ), indices[ I ] ... ); }
+
+/**
+ * @tparam T the type of the values being permuted.
+ * @brief @return The number of indices in each dimension of a tile of permuteInto, the largest power of two
+ *   such that a square tile of values takes up no more than 8KB.
+ */
+template< typename T >
+LVARRAY_HOST_DEVICE inline constexpr
+std::ptrdiff_t permuteTileSize()
+{
+  std::ptrdiff_t size = 1;
+  while( 4 * size * size * sizeof( T ) <= 8192 )
+  {
+    size *= 2;
+  }
+
+  return size;
+}
+
+/**
+ * @tparam SLICE the type of @p slice.
+ * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @tparam I the dimensions of @p slice.
+ * @brief @return The linear index of the value of @p slice at @p indices.
+ * @param slice the slice to access.
+ * @param indices the index of the value in each dimension.
+ */
+template< typename SLICE, typename INDEX_TYPE, std::size_t ... I >
+LVARRAY_HOST_DEVICE inline CONSTEXPR_WITHOUT_BOUNDS_CHECK
+INDEX_TYPE linearIndex( SLICE const & slice, INDEX_TYPE const * const indices, std::index_sequence< I ... > )
+{ return slice.linearIndex( indices[ I ] ... ); }
+
+/**
+ * @tparam T The type of values stored in @p slice.
+ * @tparam NDIM the dimension of @p slice.
+ * @tparam USD the unit stride dimension of @p slice.
+ * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @tparam STRIDES the static strides of @p slice.
+ * @brief @return A pointer to the first value of @p slice.
+ * @param slice the slice to get the strides of, must not be empty.
+ * @param strides the array to write the stride of each dimension to, dimensions of size one get a stride of zero.
+ */
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES >
+T * dataAndStrides( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice, INDEX_TYPE ( & strides )[ NDIM ] )
+{
+  INDEX_TYPE indices[ NDIM ] = {};
+  for( int dim = 0; dim < NDIM; ++dim )
+  {
+    indices[ dim ] = slice.size( dim ) > 1;
+    strides[ dim ] = linearIndex( slice, indices, std::make_index_sequence< NDIM >() );
+    indices[ dim ] = 0;
+  }
+
+  T * data = nullptr;
+  callWithIndices( slice, [&data] ( T & value, auto const ... )
+  {
+    data = &value;
+  }, indices, std::make_index_sequence< NDIM >() );
+  return data;
+}
+
+} // namespace internal
+
 /**
  * @tparam T The type of @p value.
  * @tparam LAMBDA the type of the function @p f to apply.
@@ -47,15 +201,16 @@ void forValuesInSlice( T & value, LAMBDA && f )
  * @tparam NDIM the dimension of @p slice.
  * @tparam USD the unit stride dimension of @p slice.
  * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @tparam STRIDES the static strides of @p slice.
  * @tparam LAMBDA the type of the function @p f to apply.
  * @brief Iterate over the values in the slice in lexicographic order.
  * @param slice the slice to iterate over.
  * @param f the function to apply to each value.
  */
 DISABLE_HD_WARNING
-template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename LAMBDA >
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES, typename LAMBDA >
 LVARRAY_HOST_DEVICE
-void forValuesInSlice( ArraySlice< T, NDIM, USD, INDEX_TYPE > const & slice, LAMBDA && f )
+void forValuesInSlice( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice, LAMBDA && f )
 {
   INDEX_TYPE const bounds = slice.size( 0 );
   for( INDEX_TYPE i = 0; i < bounds; ++i )
@@ -84,6 +239,7 @@ void forValuesInSliceWithIndices( T & value, LAMBDA && f, INDICES const ... indi
  * @tparam NDIM the dimension of @p slice.
  * @tparam USD the unit stride dimension of @p slice.
  * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @tparam STRIDES the static strides of @p slice.
  * @tparam INDICES variadic pack of indices.
  * @tparam LAMBDA the type of the function @p f to apply.
  * @brief Iterate over the values in the slice in lexicographic order, passing the indices as well as the value to the
@@ -93,9 +249,9 @@ void forValuesInSliceWithIndices( T & value, LAMBDA && f, INDICES const ... indi
  * @param indices The previous sliced off indices.
  */
 DISABLE_HD_WARNING
-template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename LAMBDA, typename ... INDICES >
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES, typename LAMBDA, typename ... INDICES >
 LVARRAY_HOST_DEVICE
-void forValuesInSliceWithIndices( ArraySlice< T, NDIM, USD, INDEX_TYPE > const & slice,
+void forValuesInSliceWithIndices( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice,
                                   LAMBDA && f,
                                   INDICES const ... indices )
 {
@@ -106,17 +262,94 @@ void forValuesInSliceWithIndices( ArraySlice< T, NDIM, USD, INDEX_TYPE > const &
   }
 }
 
+/**
+ * @tparam POLICY the RAJA policy to use.
+ * @tparam T The type of values stored in @p slice.
+ * @tparam NDIM the dimension of @p slice.
+ * @tparam USD the unit stride dimension of @p slice.
+ * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @tparam STRIDES the static strides of @p slice.
+ * @tparam LAMBDA the type of the function @p f to apply.
+ * @brief Iterate over the values in the slice with the given policy, passing the indices as well as the value
+ *   to the lambda.
+ * @param slice The slice to iterate over.
+ * @param f The lambda to apply to each value, it is passed the value followed by an index for each dimension.
+ * @details Every dimension except the unit stride dimension is collapsed into a single loop executed with
+ *   @p POLICY, each iteration of which loops serially over the unit stride dimension. Slices without a unit
+ *   stride dimension use the last dimension instead. A one dimensional slice is iterated over directly with
+ *   @p POLICY. Unlike the serial version the values are not visited in lexicographic order, see
+ *   internal::outerIndices for the order.
+ * @note With a parallel policy @p f is called concurrently and is captured by value.
+ */
+template< typename POLICY, typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES, typename LAMBDA >
+void forValuesInSliceWithIndices( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice, LAMBDA && f )
+{
+  constexpr int INNER = internal::innerDimension< NDIM, USD >();
+  INDEX_TYPE const innerSize = slice.size( INNER );
+  if( innerSize == 0 )
+  { return; }
+
+  if( NDIM == 1 )
+  {
+    RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, innerSize ),
+                            [slice, f] LVARRAY_HOST_DEVICE ( INDEX_TYPE const i )
+    {
+      INDEX_TYPE const indices[ NDIM ] = { i };
+      internal::callWithIndices( slice, f, indices, std::make_index_sequence< NDIM >() );
+    } );
+
+    return;
+  }
+
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, slice.size() / innerSize ),
+                          [slice, f] LVARRAY_HOST_DEVICE ( INDEX_TYPE const outer )
+  {
+    INDEX_TYPE indices[ NDIM ];
+    internal::outerIndices< NDIM, USD >( slice, outer, indices );
+
+    INDEX_TYPE const bounds = slice.size( internal::innerDimension< NDIM, USD >() );
+    for( INDEX_TYPE i = 0; i < bounds; ++i )
+    {
+      indices[ internal::innerDimension< NDIM, USD >() ] = i;
+      internal::callWithIndices( slice, f, indices, std::make_index_sequence< NDIM >() );
+    }
+  } );
+}
+
+/**
+ * @tparam POLICY the RAJA policy to use.
+ * @tparam T The type of values stored in @p slice.
+ * @tparam NDIM the dimension of @p slice.
+ * @tparam USD the unit stride dimension of @p slice.
+ * @tparam INDEX_TYPE the integer used to index into @p slice.
+ * @tparam STRIDES the static strides of @p slice.
+ * @tparam LAMBDA the type of the function @p f to apply.
+ * @brief Iterate over the values in the slice with the given policy.
+ * @param slice the slice to iterate over.
+ * @param f the function to apply to each value.
+ * @note See the policy version of forValuesInSliceWithIndices for the iteration order.
+ */
+template< typename POLICY, typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES, typename LAMBDA >
+void forValuesInSlice( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice, LAMBDA && f )
+{
+  forValuesInSliceWithIndices< POLICY >( slice, [f] LVARRAY_HOST_DEVICE ( T & value, auto const ... )
+  {
+    f( value );
+  } );
+}
+
 /**
  * @tparam T The type of values stored in @p src.
  * @tparam NDIM the dimension of @p src.
  * @tparam USD_SRC the unit stride dimension of @p src.
  * @tparam INDEX_TYPE the integer used to index into @p src.
+ * @tparam STRIDES_SRC the static strides of @p src.
  * @brief Add the values in @p src to @p dst.
  * @param src The array slice to sum over.
  * @param dst The value to add the sum to.
  */
-template< typename T, int USD_SRC, typename INDEX_TYPE >
-void sumOverFirstDimension( ArraySlice< T const, 1, USD_SRC, INDEX_TYPE > const & src,
+template< typename T, int USD_SRC, typename INDEX_TYPE, typename STRIDES_SRC >
+void sumOverFirstDimension( ArraySlice< T const, 1, USD_SRC, INDEX_TYPE, STRIDES_SRC > const & src,
                             T & dst )
 {
   INDEX_TYPE const bounds = src.size( 0 );
@@ -132,13 +365,15 @@ void sumOverFirstDimension( ArraySlice< T const, 1, USD_SRC, INDEX_TYPE > const
  * @tparam USD_SRC the unit stride dimension of @p src.
  * @tparam USD_DST the unit stride dimension of @p dst.
  * @tparam INDEX_TYPE the integer used to index into @p src and @p dst.
+ * @tparam STRIDES_SRC the static strides of @p src.
+ * @tparam STRIDES_DST the static strides of @p dst.
  * @brief Sum over the first dimension of @p src adding the results to dst.
  * @param src The slice to sum over.
  * @param dst The slice to add to.
  */
-template< typename T, int NDIM, int USD_SRC, int USD_DST, typename INDEX_TYPE >
-void sumOverFirstDimension( ArraySlice< T const, NDIM, USD_SRC, INDEX_TYPE > const & src,
-                            ArraySlice< T, NDIM - 1, USD_DST, INDEX_TYPE > const & dst )
+template< typename T, int NDIM, int USD_SRC, int USD_DST, typename INDEX_TYPE, typename STRIDES_SRC, typename STRIDES_DST >
+void sumOverFirstDimension( ArraySlice< T const, NDIM, USD_SRC, INDEX_TYPE, STRIDES_SRC > const & src,
+                            ArraySlice< T, NDIM - 1, USD_DST, INDEX_TYPE, STRIDES_DST > const & dst )
 {
 #ifdef ARRAY_SLICE_CHECK_BOUNDS
   for( int i = 1; i < NDIM; ++i )
@@ -153,6 +388,209 @@ void sumOverFirstDimension( ArraySlice< T const, NDIM, USD_SRC, INDEX_TYPE > con
   } );
 }
 
+/**
+ * @tparam POLICY the RAJA policy to use, should NOT be a device policy.
+ * @tparam T The type of values stored in @p src.
+ * @tparam USD_SRC the unit stride dimension of @p src.
+ * @tparam INDEX_TYPE the integer used to index into @p src.
+ * @tparam STRIDES_SRC the static strides of @p src.
+ * @brief Add the values in @p src to @p dst in parallel.
+ * @param src The array slice to sum over.
+ * @param dst The value to add the sum to.
+ * @details Each chunk of PARALLEL_SUM_CHUNK_SIZE values is summed by a single iteration of @p POLICY, the
+ *   partial sums are then added to @p dst in order. The result doesn't depend on the number of threads but
+ *   for floating point values it may differ from the serial version.
+ */
+template< typename POLICY, typename T, int USD_SRC, typename INDEX_TYPE, typename STRIDES_SRC >
+void sumOverFirstDimension( ArraySlice< T const, 1, USD_SRC, INDEX_TYPE, STRIDES_SRC > const & src,
+                            T & dst )
+{
+  INDEX_TYPE const size = src.size( 0 );
+  INDEX_TYPE const chunkSize = internal::PARALLEL_SUM_CHUNK_SIZE;
+  INDEX_TYPE const numChunks = ( size + chunkSize - 1 ) / chunkSize;
+
+  std::vector< T > partialSums( numChunks );
+  T * const sums = partialSums.data();
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numChunks ),
+                          [src, size, chunkSize, sums] ( INDEX_TYPE const chunk )
+  {
+    INDEX_TYPE const begin = chunk * chunkSize;
+    INDEX_TYPE const end = std::min( begin + chunkSize, size );
+
+    T sum = src( begin );
+    for( INDEX_TYPE i = begin + 1; i < end; ++i )
+    {
+      sum += src( i );
+    }
+
+    sums[ chunk ] = sum;
+  } );
+
+  for( T const & sum : partialSums )
+  {
+    dst += sum;
+  }
+}
+
+/**
+ * @tparam POLICY the RAJA policy to use.
+ * @tparam T The type of values stored in @p src.
+ * @tparam NDIM the dimension of @p src.
+ * @tparam USD_SRC the unit stride dimension of @p src.
+ * @tparam USD_DST the unit stride dimension of @p dst.
+ * @tparam INDEX_TYPE the integer used to index into @p src and @p dst.
+ * @tparam STRIDES_SRC the static strides of @p src.
+ * @tparam STRIDES_DST the static strides of @p dst.
+ * @brief Sum over the first dimension of @p src adding the results to dst in parallel.
+ * @param src The slice to sum over.
+ * @param dst The slice to add to.
+ * @details The values of @p dst are iterated over with @p POLICY and each one sums its column of @p src
+ *   serially, so there are no races and the result is the same as the serial version.
+ */
+template< typename POLICY, typename T, int NDIM, int USD_SRC, int USD_DST, typename INDEX_TYPE,
+          typename STRIDES_SRC, typename STRIDES_DST >
+void sumOverFirstDimension( ArraySlice< T const, NDIM, USD_SRC, INDEX_TYPE, STRIDES_SRC > const & src,
+                            ArraySlice< T, NDIM - 1, USD_DST, INDEX_TYPE, STRIDES_DST > const & dst )
+{
+#ifdef ARRAY_SLICE_CHECK_BOUNDS
+  for( int i = 1; i < NDIM; ++i )
+  {
+    LVARRAY_ERROR_IF_NE( src.size( i ), dst.size( i - 1 ) );
+  }
+#endif
+
+  forValuesInSliceWithIndices< POLICY >( dst, [src] LVARRAY_HOST_DEVICE ( T & value, auto const ... indices )
+  {
+    INDEX_TYPE const bounds = src.size( 0 );
+    for( INDEX_TYPE i = 0; i < bounds; ++i )
+    {
+      value += src( i, indices ... );
+    }
+  } );
+}
+
+/**
+ * @tparam POLICY the RAJA policy to use, should NOT be a device policy.
+ * @tparam T The type of values stored in @p src.
+ * @tparam NDIM the dimension of @p src and @p dst.
+ * @tparam USD_SRC the unit stride dimension of @p src.
+ * @tparam USD_DST the unit stride dimension of @p dst.
+ * @tparam INDEX_TYPE the integer used to index into @p src and @p dst.
+ * @tparam STRIDES_SRC the static strides of @p src.
+ * @tparam STRIDES_DST the static strides of @p dst.
+ * @brief Copy the values of @p src into @p dst with the given policy, the two may have different permutations.
+ * @param src The slice to copy from.
+ * @param dst The slice to copy to, must have the same dimensions as @p src.
+ * @details This is how to convert between layouts, for example from an Array< T, 3, RAJA::PERM_IJK > to an
+ *   Array< T, 3, RAJA::PERM_KJI >. If the innermost dimension (see internal::innerDimension) of the two
+ *   slices is the same the rows are copied directly. Otherwise copying value by value would stride through
+ *   one of the two slices, so instead the plane spanned by the two inner dimensions is split into square
+ *   tiles small enough that both the source and destination tile stay in the L1 cache. Each iteration of
+ *   @p POLICY copies one tile, reading @p src along its inner dimension and writing @p dst along its own.
+ */
+template< typename POLICY, typename T, int NDIM, int USD_SRC, int USD_DST, typename INDEX_TYPE,
+          typename STRIDES_SRC, typename STRIDES_DST >
+void permuteInto( ArraySlice< T const, NDIM, USD_SRC, INDEX_TYPE, STRIDES_SRC > const & src,
+                  ArraySlice< T, NDIM, USD_DST, INDEX_TYPE, STRIDES_DST > const & dst )
+{
+  for( int dim = 0; dim < NDIM; ++dim )
+  {
+    LVARRAY_ERROR_IF_NE_MSG( src.size( dim ), dst.size( dim ), "Dimension " << dim << " doesn't match." );
+  }
+
+  constexpr int SRC_INNER = internal::innerDimension< NDIM, USD_SRC >();
+  constexpr int DST_INNER = internal::innerDimension< NDIM, USD_DST >();
+
+  if( SRC_INNER == DST_INNER )
+  {
+    forValuesInSliceWithIndices< POLICY >( dst, [src] LVARRAY_HOST_DEVICE ( T & value, auto const ... indices )
+    {
+      value = src( indices ... );
+    } );
+
+    return;
+  }
+
+  if( dst.size() == 0 )
+  { return; }
+
+  INDEX_TYPE dims[ NDIM ];
+  for( int dim = 0; dim < NDIM; ++dim )
+  {
+    dims[ dim ] = dst.size( dim );
+  }
+
+  INDEX_TYPE srcStrides[ NDIM ];
+  INDEX_TYPE dstStrides[ NDIM ];
+  T const * const LVARRAY_RESTRICT srcData = internal::dataAndStrides( src, srcStrides );
+  T * const LVARRAY_RESTRICT dstData = internal::dataAndStrides( dst, dstStrides );
+
+  INDEX_TYPE const tileSize = internal::permuteTileSize< T >();
+  INDEX_TYPE const numSrcTiles = ( dims[ SRC_INNER ] + tileSize - 1 ) / tileSize;
+  INDEX_TYPE const numDstTiles = ( dims[ DST_INNER ] + tileSize - 1 ) / tileSize;
+  INDEX_TYPE const numTiles = dst.size() / ( dims[ SRC_INNER ] * dims[ DST_INNER ] ) * numSrcTiles * numDstTiles;
+
+  // Consecutive tiles are consecutive along the inner dimension of dst so that the writes stream.
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, numTiles ),
+                          [=] LVARRAY_HOST_DEVICE ( INDEX_TYPE tile )
+  {
+    INDEX_TYPE const dstTile = tile % numDstTiles;
+    tile /= numDstTiles;
+    INDEX_TYPE const srcTile = tile % numSrcTiles;
+    tile /= numSrcTiles;
+
+    INDEX_TYPE srcOffset = 0;
+    INDEX_TYPE dstOffset = 0;
+    for( int dim = NDIM - 1; dim >= 0; --dim )
+    {
+      if( dim != SRC_INNER && dim != DST_INNER )
+      {
+        INDEX_TYPE const index = tile % dims[ dim ];
+        tile /= dims[ dim ];
+        srcOffset += index * srcStrides[ dim ];
+        dstOffset += index * dstStrides[ dim ];
+      }
+    }
+
+    // The unit strides are known at compile time, this lets the compiler vectorize the inner loop.
+    INDEX_TYPE const srcInnerStride = ( SRC_INNER == USD_SRC ) ? 1 : srcStrides[ SRC_INNER ];
+    INDEX_TYPE const dstInnerStride = ( DST_INNER == USD_DST ) ? 1 : dstStrides[ DST_INNER ];
+
+    INDEX_TYPE const srcBegin = srcTile * tileSize;
+    INDEX_TYPE const srcEnd = ( srcBegin + tileSize < dims[ SRC_INNER ] ) ? srcBegin + tileSize : dims[ SRC_INNER ];
+    INDEX_TYPE const dstBegin = dstTile * tileSize;
+    INDEX_TYPE const dstEnd = ( dstBegin + tileSize < dims[ DST_INNER ] ) ? dstBegin + tileSize : dims[ DST_INNER ];
+
+    for( INDEX_TYPE i = srcBegin; i < srcEnd; ++i )
+    {
+      T const * const LVARRAY_RESTRICT srcValues = srcData + srcOffset + i * srcInnerStride;
+      T * const LVARRAY_RESTRICT dstValues = dstData + dstOffset + i * dstStrides[ SRC_INNER ];
+      for( INDEX_TYPE j = dstBegin; j < dstEnd; ++j )
+      {
+        dstValues[ j * dstInnerStride ] = srcValues[ j * srcStrides[ DST_INNER ] ];
+      }
+    }
+  } );
+}
+
+/**
+ * @tparam T The type of values stored in @p src.
+ * @tparam NDIM the dimension of @p src and @p dst.
+ * @tparam USD_SRC the unit stride dimension of @p src.
+ * @tparam USD_DST the unit stride dimension of @p dst.
+ * @tparam INDEX_TYPE the integer used to index into @p src and @p dst.
+ * @tparam STRIDES_SRC the static strides of @p src.
+ * @tparam STRIDES_DST the static strides of @p dst.
+ * @brief Copy the values of @p src into @p dst, which may have a different permutation.
+ * @param src The slice to copy from.
+ * @param dst The slice to copy to, must have the same dimensions as @p src.
+ * @details See the policy version.
+ */
+template< typename T, int NDIM, int USD_SRC, int USD_DST, typename INDEX_TYPE, typename STRIDES_SRC, typename STRIDES_DST >
+void permuteInto( ArraySlice< T const, NDIM, USD_SRC, INDEX_TYPE, STRIDES_SRC > const & src,
+                  ArraySlice< T, NDIM, USD_DST, INDEX_TYPE, STRIDES_DST > const & dst )
+{ permuteInto< RAJA::loop_exec >( src, dst ); }
+
 } // namespace LvArray
 
 #endif /// SLICE_HELPERS_HPP_
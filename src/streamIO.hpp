@@ -80,9 +80,9 @@ struct stringToArrayHelper
    * @param dims The dimensions of the array.
    * @param inputStream The stream to read from.
    */
-  template< int NDIM, int USD >
+  template< int NDIM, int USD, typename STRIDES >
   static void
-  Read( ArraySlice< T, NDIM, USD, INDEX_TYPE > const & arraySlice,
+  Read( ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & arraySlice,
         INDEX_TYPE const * const dims,
         std::istringstream & inputStream )
   {
@@ -124,8 +124,9 @@ template< typename T,
           int NDIM,
           typename PERMUTATION,
           typename INDEX_TYPE,
-          template< typename > class BUFFER_TYPE >
-static void stringToArray( Array< T, NDIM, PERMUTATION, INDEX_TYPE, BUFFER_TYPE > & array,
+          template< typename > class BUFFER_TYPE,
+          typename EXTENTS >
+static void stringToArray( Array< T, NDIM, PERMUTATION, INDEX_TYPE, BUFFER_TYPE, EXTENTS > & array,
                            std::string valueString )
 {
   // Check to make sure there are no space delimited values. The assumption is anything that is not
@@ -302,14 +303,15 @@ static void stringToArray( Array< T, NDIM, PERMUTATION, INDEX_TYPE, BUFFER_TYPE
  * @tparam NDIM The number of dimensions of @p slice.
  * @tparam USD The unit stride dimension of @p slice.
  * @tparam INDEX_TYPE The integer used by @p slice.
+ * @tparam STRIDES The static strides of @p slice.
  * @brief This function outputs the contents of an array slice to an output stream.
  * @param stream The output stream to write to.
  * @param slice The slice to output.
  * @return @p stream .
  */
-template< typename T, int NDIM, int USD, typename INDEX_TYPE >
+template< typename T, int NDIM, int USD, typename INDEX_TYPE, typename STRIDES >
 std::ostream & operator<<( std::ostream & stream,
-                           ArraySlice< T, NDIM, USD, INDEX_TYPE > const & slice )
+                           ArraySlice< T, NDIM, USD, INDEX_TYPE, STRIDES > const & slice )
 {
   stream << "{ ";
 
@@ -331,6 +333,7 @@ std::ostream & operator<<( std::ostream & stream,
  * @tparam USD The unit stride dimension of @p view.
  * @tparam INDEX_TYPE The integer used by @p view.
  * @tparam BUFFER_TYPE The buffer type used by @p view.
+ * @tparam STRIDES The static strides of @p view.
  * @brief This function outputs the contents of an ArrayView to an output stream.
  * @param stream The output stream to write to.
  * @param view The view to output.
@@ -340,9 +343,10 @@ template< typename T,
           int NDIM,
           int USD,
           typename INDEX_TYPE,
-          template< typename > class BUFFER_TYPE >
+          template< typename > class BUFFER_TYPE,
+          typename STRIDES >
 std::ostream & operator<<( std::ostream & stream,
-                           ArrayView< T, NDIM, USD, INDEX_TYPE, BUFFER_TYPE > const & view )
+                           ArrayView< T, NDIM, USD, INDEX_TYPE, BUFFER_TYPE, STRIDES > const & view )
 { return stream << view.toSliceConst(); }
 
 /**
@@ -0,0 +1,187 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+/**
+ * @file transpose.hpp
+ * @brief Inverting a map stored in an ArraySlice or an ArrayOfArraysView, for example building the
+ *   node to element map of a mesh from its element to node map.
+ * @details Each source i maps to the targets listed in its row, transposing builds the array where
+ *   row t lists every source that maps to target t. The result is built in parallel with the two pass
+ *   ArrayOfArrays::buildFromItems and then the rows are sorted, so each row lists its sources in
+ *   increasing order and the result doesn't depend on the number of threads.
+ */
+
+#pragma once
+
+// Source includes
+#include "ArrayOfArrays.hpp"
+#include "ArrayOfSets.hpp"
+#include "ArraySlice.hpp"
+#include "arrayManipulation.hpp"
+#include "sortedArrayManipulation.hpp"
+
+// TPL includes
+#include <RAJA/RAJA.hpp>
+
+// System includes
+#include <type_traits>
+
+namespace LvArray
+{
+
+namespace internal
+{
+
+/**
+ * @tparam POLICY The RAJA policy used to sort the arrays.
+ * @tparam T The type of the values in @p dst.
+ * @tparam INDEX_TYPE The integer used by @p dst.
+ * @tparam BUFFER_TYPE The buffer type used by @p dst.
+ * @brief Sort the values of each array of @p dst.
+ * @param dst The ArrayOfArrays to sort.
+ */
+template< typename POLICY, typename T, typename INDEX_TYPE, template< typename > class BUFFER_TYPE >
+void sortArrays( ArrayOfArrays< T, INDEX_TYPE, BUFFER_TYPE > & dst )
+{
+  ArrayOfArraysView< T, INDEX_TYPE const, true, BUFFER_TYPE > const & view = dst.toViewConstSizes();
+  RAJA::forall< POLICY >( RAJA::TypedRangeSegment< INDEX_TYPE >( 0, view.size() ), [view] ( INDEX_TYPE const i )
+  {
+    ArraySlice< T, 1, 0, INDEX_TYPE > const values = view[ i ];
+    sortedArrayManipulation::makeSorted( values.begin(), values.end() );
+  } );
+}
+
+/**
+ * @tparam POLICY The RAJA policy, unused.
+ * @tparam T The type of the values in the ArrayOfSets.
+ * @tparam INDEX_TYPE The integer used by the ArrayOfSets.
+ * @tparam BUFFER_TYPE The buffer type used by the ArrayOfSets.
+ * @brief Does nothing since ArrayOfSets::buildFromItems already sorts each set.
+ */
+template< typename POLICY, typename T, typename INDEX_TYPE, template< typename > class BUFFER_TYPE >
+void sortArrays( ArrayOfSets< T, INDEX_TYPE, BUFFER_TYPE > & )
+{}
+
+/**
+ * @tparam POLICY The RAJA policy used to iterate over the sources and targets, should NOT be a device policy.
+ * @tparam ATOMIC_POLICY The RAJA atomic policy used to count and append the sources.
+ * @tparam INDEX_TYPE The integer used to index the sources.
+ * @tparam DST The type of the destination, either an ArrayOfArrays or an ArrayOfSets.
+ * @tparam FUNC The type of @p forTargetsOf.
+ * @brief Transpose the map given by @p forTargetsOf into @p dst.
+ * @param numSources The number of sources.
+ * @param numTargets The number of targets, the new size of @p dst.
+ * @param dst The array to hold the result.
+ * @param forTargetsOf Called as forTargetsOf( i, emit ) it calls emit( t ) for each target t of source i.
+ */
+template< typename POLICY, typename ATOMIC_POLICY, typename INDEX_TYPE, typename DST, typename FUNC >
+void transpose( INDEX_TYPE const numSources, INDEX_TYPE const numTargets, DST & dst, FUNC && forTargetsOf )
+{
+  dst.template buildFromItems< POLICY, ATOMIC_POLICY >( numTargets, numSources,
+                                                        [&forTargetsOf] ( INDEX_TYPE const i, auto && emit )
+  {
+    forTargetsOf( i, [&emit, i] ( auto const t )
+    {
+      if( arrayManipulation::isPositive( t ) )
+      {
+        emit( t, i );
+      }
+    } );
+  } );
+
+  sortArrays< POLICY >( dst );
+}
+
+} // namespace internal
+
+/**
+ * @tparam POLICY The RAJA policy used to iterate over the sources and targets, should NOT be a device policy.
+ * @tparam ATOMIC_POLICY The RAJA atomic policy used to count and append the sources.
+ * @tparam T The type of the values in @p src, an integral type.
+ * @tparam USD The unit stride dimension of @p src.
+ * @tparam INDEX_TYPE The integer used to index into @p src.
+ * @tparam STRIDES The static strides of @p src.
+ * @tparam DST The type of the destination, either an ArrayOfArrays or an ArrayOfSets.
+ * @brief Clear @p dst and fill it with the transpose of @p src, array t of @p dst holds each i where
+ *   @p src( i, j ) == t in increasing order.
+ * @param src The map to transpose, row i holds the targets of source i.
+ * @param numTargets The number of targets, the new size of @p dst.
+ * @param dst The array to hold the result.
+ * @details Negative values in @p src are skipped, so rows padded with -1 can be transposed. If a target is
+ *   repeated in row i of @p src then an ArrayOfArrays holds i once for each time it is repeated, an ArrayOfSets
+ *   holds it once.
+ */
+template< typename POLICY,
+          typename ATOMIC_POLICY=RAJA::auto_atomic,
+          typename T,
+          int USD,
+          typename INDEX_TYPE,
+          typename STRIDES,
+          typename DST >
+void transpose( ArraySlice< T const, 2, USD, INDEX_TYPE, STRIDES > const & src,
+                std::remove_const_t< INDEX_TYPE > const numTargets,
+                DST & dst )
+{
+  internal::transpose< POLICY, ATOMIC_POLICY >( src.size( 0 ), numTargets, dst,
+                                                [src] ( INDEX_TYPE const i, auto && emit )
+  {
+    INDEX_TYPE const numTargetsOfSource = src.size( 1 );
+    for( INDEX_TYPE j = 0; j < numTargetsOfSource; ++j )
+    {
+      emit( src( i, j ) );
+    }
+  } );
+}
+
+/**
+ * @tparam POLICY The RAJA policy used to iterate over the sources and targets, should NOT be a device policy.
+ * @tparam ATOMIC_POLICY The RAJA atomic policy used to count and append the sources.
+ * @tparam T The type of the values in @p src, an integral type.
+ * @tparam INDEX_TYPE The integer used by @p src.
+ * @tparam CONST_SIZES True iff the sizes of the arrays of @p src are constant.
+ * @tparam BUFFER_TYPE The buffer type used by @p src.
+ * @tparam DST The type of the destination, either an ArrayOfArrays or an ArrayOfSets.
+ * @brief Clear @p dst and fill it with the transpose of @p src, array t of @p dst holds each i where
+ *   @p src( i, j ) == t in increasing order.
+ * @param src The map to transpose, array i holds the targets of source i.
+ * @param numTargets The number of targets, the new size of @p dst.
+ * @param dst The array to hold the result.
+ * @details See the ArraySlice version.
+ */
+template< typename POLICY,
+          typename ATOMIC_POLICY=RAJA::auto_atomic,
+          typename T,
+          typename INDEX_TYPE,
+          bool CONST_SIZES,
+          template< typename > class BUFFER_TYPE,
+          typename DST >
+void transpose( ArrayOfArraysView< T const, INDEX_TYPE const, CONST_SIZES, BUFFER_TYPE > const & src,
+                std::remove_const_t< INDEX_TYPE > const numTargets,
+                DST & dst )
+{
+  internal::transpose< POLICY, ATOMIC_POLICY >( src.size(), numTargets, dst,
+                                                [src] ( INDEX_TYPE const i, auto && emit )
+  {
+    for( T const & t : src[ i ] )
+    {
+      emit( t );
+    }
+  } );
+}
+
+} // namespace LvArray
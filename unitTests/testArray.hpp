@@ -26,6 +26,7 @@
 #include <gtest/gtest.h>
 
 // System includes
+#include <cmath>
 #include <random>
 
 namespace LvArray
@@ -262,6 +263,39 @@ public:
     checkResize( *array, oldSizes, newSizes, NDIM == 1, true );
   }
 
+  template< typename POLICY >
+  static void resizeFromArgsWithPolicy()
+  {
+    std::unique_ptr< ARRAY > array = sizedConstructor();
+
+    std::array< INDEX_TYPE, NDIM > newSizes;
+    std::array< INDEX_TYPE, NDIM > oldSizes;
+
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      oldSizes[ dim ] = array->size( dim );
+      newSizes[ dim ] = randomInteger( 1, getMaxDimSize() );
+    }
+    forwardArrayAsArgs( newSizes, [&array]( auto const ... indices )
+    {
+      return array->template resize< POLICY >( indices ... );
+    } );
+    checkResize( *array, oldSizes, newSizes, NDIM == 1, true );
+
+    // Resize an empty Array so every value is constructed with POLICY.
+    array->clear();
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      oldSizes[ dim ] = array->size( dim );
+      newSizes[ dim ] = randomInteger( 1, getMaxDimSize() );
+    }
+    forwardArrayAsArgs( newSizes, [&array]( auto const ... indices )
+    {
+      return array->template resize< POLICY >( indices ... );
+    } );
+    checkResize( *array, oldSizes, newSizes, NDIM == 1, true );
+  }
+
   template< int _NDIM=NDIM >
   static std::enable_if_t< _NDIM == 1 >
   resizeDimension()
@@ -382,6 +416,100 @@ public:
     }
   }
 
+  template< typename POLICY >
+  static void resizeDefaultWithPolicy()
+  {
+    ARRAY array;
+
+    INDEX_TYPE const maxDimSize = getMaxDimSize();
+
+    for( int i = 0; i < 4; ++i )
+    {
+      for( int dim = 0; dim < NDIM; ++dim )
+      {
+        array.setSingleParameterResizeIndex( dim );
+
+        std::array< INDEX_TYPE, NDIM > oldSizes;
+        for( int d = 0; d < NDIM; ++d )
+        { oldSizes[ d ] = randomInteger( 1, maxDimSize / 2 ); }
+
+        std::array< INDEX_TYPE, NDIM > newSizes = oldSizes;
+
+        array.resize( NDIM, oldSizes.data() );
+
+        fill( array );
+
+        // Increase the size
+        newSizes[ dim ] = randomInteger( oldSizes[ dim ], maxDimSize );
+        array.template resizeDefault< POLICY >( newSizes[ dim ], T( -i * dim ) );
+        checkResize( array, oldSizes, newSizes, true, true, T( -i * dim ) );
+        oldSizes = newSizes;
+
+        // Decrease the size
+        newSizes[ dim ] = randomInteger( 0, oldSizes[ dim ] );
+        array.template resizeDefault< POLICY >( newSizes[ dim ], T( -i * dim - 1 ) );
+        checkResize( array, oldSizes, newSizes, true, true, T( -i * dim - 1 ) );
+      }
+    }
+
+    // Large enough that some of the blocks are relocated in parallel.
+    INDEX_TYPE const largeDimSize = INDEX_TYPE( std::pow( 1 << 18, 1.0 / NDIM ) );
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      array.setSingleParameterResizeIndex( dim );
+
+      std::array< INDEX_TYPE, NDIM > oldSizes;
+      oldSizes.fill( largeDimSize );
+      std::array< INDEX_TYPE, NDIM > newSizes = oldSizes;
+
+      array.resize( NDIM, oldSizes.data() );
+      fill( array );
+
+      newSizes[ dim ] = 2 * largeDimSize + 1;
+      array.template resizeDefault< POLICY >( newSizes[ dim ], T( dim ) );
+      checkResize( array, oldSizes, newSizes, true, true, T( dim ) );
+      oldSizes = newSizes;
+
+      newSizes[ dim ] = largeDimSize / 3;
+      array.template resizeDefault< POLICY >( newSizes[ dim ], T( dim ) );
+      checkResize( array, oldSizes, newSizes, true, true, T( dim ) );
+    }
+  }
+
+  static void reserveDefaultDimension()
+  {
+    std::unique_ptr< ARRAY > array = sizedConstructor();
+
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      array->setSingleParameterResizeIndex( dim );
+      INDEX_TYPE const defaultDimSize = array->size( dim );
+      array->reserveDefaultDimension( 3 * defaultDimSize );
+      T const * const pointerAfterReserve = array->data();
+      EXPECT_EQ( array->capacity(), 3 * array->size() );
+
+      std::array< INDEX_TYPE, NDIM > oldSizes;
+      for( int d = 0; d < NDIM; ++d )
+      { oldSizes[ d ] = array->size( d ); }
+
+      // Growing within the reserved size happens in place.
+      fill( *array );
+      for( INDEX_TYPE newSize : { 2 * defaultDimSize, 3 * defaultDimSize } )
+      {
+        std::array< INDEX_TYPE, NDIM > newSizes = oldSizes;
+        newSizes[ dim ] = newSize;
+
+        array->resize( newSize );
+        checkResize( *array, oldSizes, newSizes, true, true );
+        EXPECT_EQ( array->data(), pointerAfterReserve );
+        oldSizes = newSizes;
+      }
+
+      array->resize( defaultDimSize );
+      array->shrinkToFit();
+    }
+  }
+
   static void reserveAndCapacity()
   {
     std::unique_ptr< ARRAY > array = sizedConstructor();
@@ -414,6 +542,28 @@ public:
     EXPECT_EQ( array->data(), pointerAfterReserve );
   }
 
+  static void shrinkToFit()
+  {
+    std::unique_ptr< ARRAY > array = sizedConstructor();
+    INDEX_TYPE const defaultDimSize = array->size( array->getSingleParameterResizeIndex() );
+
+    array->reserve( 2 * array->size() );
+    array->resize( defaultDimSize / 2 );
+    fill( *array );
+
+    array->shrinkToFit();
+    EXPECT_EQ( array->capacity(), array->size() );
+    checkFill( *array );
+
+    array->clear();
+    array->shrinkToFit();
+    EXPECT_EQ( array->size(), 0 );
+    EXPECT_EQ( array->capacity(), 0 );
+
+    array->resize( defaultDimSize );
+    fill( *array );
+  }
+
   static void clear()
   {
     std::unique_ptr< ARRAY > array = sizedConstructor();
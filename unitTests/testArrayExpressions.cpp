@@ -0,0 +1,191 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "arrayExpressions.hpp"
+#include "Array.hpp"
+#include "testUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+namespace LvArray
+{
+namespace testing
+{
+
+using INDEX_TYPE = std::ptrdiff_t;
+
+template< typename T, typename PERMUTATION >
+using ArrayT = Array< T, getDimension( PERMUTATION {} ), PERMUTATION, INDEX_TYPE, DEFAULT_BUFFER >;
+
+template< typename T, typename PERMUTATION >
+void fill( ArrayT< T, PERMUTATION > & array, INDEX_TYPE const n, INDEX_TYPE const m, INDEX_TYPE const p, T const offset )
+{
+  array.resize( n, m, p );
+  forValuesInSliceWithIndices( array.toSlice(), [offset]( T & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+  {
+    value = offset + 100 * i + 10 * j + k;
+  } );
+}
+
+template< typename POLICY_AND_PERMUTATIONS >
+class ArrayExpressionsTest : public ::testing::Test
+{
+public:
+  using POLICY = std::tuple_element_t< 0, POLICY_AND_PERMUTATIONS >;
+  using PERM_U = std::tuple_element_t< 1, POLICY_AND_PERMUTATIONS >;
+  using PERM_V = std::tuple_element_t< 2, POLICY_AND_PERMUTATIONS >;
+
+  void SetUp() override
+  {
+    fill( m_u, N, M, P, 1.0 );
+    fill( m_v, N, M, P, 2.0 );
+    fill( m_w, N, M, P, 3.0 );
+  }
+
+  void axpy()
+  {
+    using namespace expressions;
+
+    ArrayT< double, PERM_U > const uCopy( m_u );
+
+    double const dt = 0.5;
+    double const c = 3;
+    assign< POLICY >( m_u, ref( m_u ) + dt * ref( m_v ) - c * ref( m_w ) );
+
+    forValuesInSliceWithIndices( m_u.toSliceConst(), [&]( double const & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+    {
+      EXPECT_EQ( value, uCopy( i, j, k ) + dt * m_v( i, j, k ) - c * m_w( i, j, k ) );
+    } );
+  }
+
+  void operators()
+  {
+    using namespace expressions;
+
+    ArrayT< double, PERM_U > result;
+    result.resize( N, M, P );
+
+    assign< POLICY >( result.toSlice(), -( ref( m_v ) * ref( m_w ) ) / 4.0 + ref( m_u ) * 2 );
+
+    forValuesInSliceWithIndices( result.toSliceConst(), [&]( double const & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+    {
+      EXPECT_EQ( value, -( m_v( i, j, k ) * m_w( i, j, k ) ) / 4.0 + m_u( i, j, k ) * 2 );
+    } );
+  }
+
+  void mapLambda()
+  {
+    using namespace expressions;
+
+    ArrayT< double, PERM_V > result;
+    result.resize( N, M, P );
+
+    auto const clamp = [] LVARRAY_HOST_DEVICE ( double const x, double const lower, double const upper )
+    {
+      return x < lower ? lower : ( x > upper ? upper : x );
+    };
+
+    assign< POLICY >( result, map( clamp, ref( m_u ), ref( m_v ) - 100.0 * ref( m_w ) / 100.0, ref( m_w ) ) );
+
+    forValuesInSliceWithIndices( result.toSliceConst(), [&]( double const & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+    {
+      EXPECT_EQ( value, clamp( m_u( i, j, k ), m_v( i, j, k ) - 100.0 * m_w( i, j, k ) / 100.0, m_w( i, j, k ) ) );
+    } );
+  }
+
+  void slices()
+  {
+    using namespace expressions;
+
+    // Only modify the second row of u.
+    ArrayT< double, PERM_U > const uCopy( m_u );
+    assign< POLICY >( m_u[ 1 ], ref( m_v[ 1 ] ) + ref( m_w[ 2 ] ) );
+
+    forValuesInSliceWithIndices( m_u.toSliceConst(), [&]( double const & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+    {
+      if( i == 1 )
+      { EXPECT_EQ( value, m_v( 1, j, k ) + m_w( 2, j, k ) ); }
+      else
+      { EXPECT_EQ( value, uCopy( i, j, k ) ); }
+    } );
+  }
+
+protected:
+  static constexpr INDEX_TYPE N = 4;
+  static constexpr INDEX_TYPE M = 5;
+  static constexpr INDEX_TYPE P = 7;
+
+  ArrayT< double, PERM_U > m_u;
+  ArrayT< double, PERM_V > m_v;
+  ArrayT< double, RAJA::PERM_JIK > m_w;
+};
+
+using ArrayExpressionsTestTypes = ::testing::Types<
+  std::tuple< serialPolicy, RAJA::PERM_IJK, RAJA::PERM_IJK >
+  , std::tuple< serialPolicy, RAJA::PERM_KJI, RAJA::PERM_IJK >
+  , std::tuple< serialPolicy, RAJA::PERM_IKJ, RAJA::PERM_KIJ >
+#if defined(USE_OPENMP)
+  , std::tuple< parallelHostPolicy, RAJA::PERM_IJK, RAJA::PERM_IJK >
+  , std::tuple< parallelHostPolicy, RAJA::PERM_KJI, RAJA::PERM_IJK >
+#endif
+  >;
+
+TYPED_TEST_SUITE( ArrayExpressionsTest, ArrayExpressionsTestTypes, );
+
+TYPED_TEST( ArrayExpressionsTest, axpy )
+{
+  this->axpy();
+}
+
+TYPED_TEST( ArrayExpressionsTest, operators )
+{
+  this->operators();
+}
+
+TYPED_TEST( ArrayExpressionsTest, map )
+{
+  this->mapLambda();
+}
+
+TYPED_TEST( ArrayExpressionsTest, slices )
+{
+  this->slices();
+}
+
+TEST( ArrayExpressions, sizeMismatch )
+{
+  using namespace expressions;
+
+  ArrayT< double, RAJA::PERM_IJK > a;
+  fill( a, 2, 3, 4, 0.0 );
+
+  ArrayT< double, RAJA::PERM_IJK > b;
+  fill( b, 2, 4, 3, 0.0 );
+
+#if defined(USE_ARRAY_BOUNDS_CHECK)
+  EXPECT_DEATH_IF_SUPPORTED( assign( a, ref( a ) + ref( b ) ), "" );
+#endif
+
+  assign( a, 2 * ref( a ) );
+  EXPECT_EQ( a( 1, 2, 3 ), 2 * 123 );
+}
+
+} // namespace testing
+} // namespace LvArray
@@ -29,6 +29,7 @@
 // System includes
 #include <vector>
 #include <random>
+#include <map>
 
 namespace LvArray
 {
@@ -244,7 +245,7 @@ public:
     COMPARE_TO_REFERENCE;
   }
 
-  template< typename POLICY >
+  template< typename POLICY, bool FIRST_TOUCH=false >
   void resizeFromCapacities( INDEX_TYPE const newSize, INDEX_TYPE const maxCapacity )
   {
     COMPARE_TO_REFERENCE;
@@ -256,7 +257,7 @@ public:
       capacity = rand( 0, maxCapacity );
     }
 
-    m_array.template resizeFromCapacities< POLICY >( newSize, newCapacities.data() );
+    m_array.template resizeFromCapacities< POLICY, FIRST_TOUCH >( newSize, newCapacities.data() );
 
     EXPECT_EQ( m_array.size(), newSize );
     for( INDEX_TYPE i = 0; i < m_array.size(); ++i )
@@ -270,6 +271,41 @@ public:
     COMPARE_TO_REFERENCE;
   }
 
+  template< typename POLICY >
+  void buildFromPairs( INDEX_TYPE const newSize, INDEX_TYPE const numPairs )
+  {
+    COMPARE_TO_REFERENCE;
+
+    typename ArrayConverter< ARRAY_OF_ARRAYS >::template Array< INDEX_TYPE, 1, RAJA::PERM_I > arrays;
+    typename ArrayConverter< ARRAY_OF_ARRAYS >::template Array< T, 1, RAJA::PERM_I > values;
+
+    m_ref.clear();
+    m_ref.resize( newSize );
+    for( INDEX_TYPE j = 0; j < numPairs; ++j )
+    {
+      INDEX_TYPE const i = rand( 0, newSize - 1 );
+      arrays.emplace_back( i );
+      values.emplace_back( T( LARGE_NUMBER * i + j ) );
+      m_ref[ i ].emplace_back( values[ j ] );
+    }
+
+    using AtomicPolicy = typename RAJAHelper< POLICY >::AtomicPolicy;
+    m_array.template buildFromPairs< POLICY, AtomicPolicy >( newSize, arrays.toSliceConst(), values.toSliceConst() );
+
+    EXPECT_EQ( m_array.size(), newSize );
+    for( INDEX_TYPE i = 0; i < m_array.size(); ++i )
+    {
+      EXPECT_EQ( m_array.capacityOfArray( i ), INDEX_TYPE( m_ref[ i ].size() ) );
+
+      // With a parallel policy the order of the values in each array is unspecified.
+      T * const arrayValues = m_array[ i ];
+      std::sort( arrayValues, arrayValues + m_array.sizeOfArray( i ) );
+      std::sort( m_ref[ i ].begin(), m_ref[ i ].end() );
+    }
+
+    COMPARE_TO_REFERENCE;
+  }
+
   void resize()
   {
     COMPARE_TO_REFERENCE;
@@ -477,6 +513,20 @@ public:
     COMPARE_TO_REFERENCE;
 
     m_array.compress();
+    checkCompressed();
+  }
+
+  template< typename POLICY >
+  void compress()
+  {
+    COMPARE_TO_REFERENCE;
+
+    m_array.template compress< POLICY >();
+    checkCompressed();
+  }
+
+  void checkCompressed()
+  {
     T const * const values = m_array[0];
 
     INDEX_TYPE curOffset = 0;
@@ -493,6 +543,25 @@ public:
     COMPARE_TO_REFERENCE;
   }
 
+  void shrinkToFit()
+  {
+    COMPARE_TO_REFERENCE;
+
+    m_array.shrinkToFit();
+
+    INDEX_TYPE totalSize = 0;
+    for( INDEX_TYPE i = 0; i < m_array.size(); ++i )
+    {
+      ASSERT_EQ( m_array.sizeOfArray( i ), m_array.capacityOfArray( i ));
+      totalSize += m_array.sizeOfArray( i );
+    }
+
+    EXPECT_EQ( m_array.capacity(), m_array.size() );
+    EXPECT_EQ( m_array.valueCapacity(), totalSize );
+
+    COMPARE_TO_REFERENCE;
+  }
+
   void fill()
   {
     COMPARE_TO_REFERENCE;
@@ -541,6 +610,46 @@ public:
     COMPARE_TO_REFERENCE;
   }
 
+  void capacitiesOfArrays( INDEX_TYPE const maxCapacity )
+  {
+    COMPARE_TO_REFERENCE;
+
+    // Pick some of the arrays, possibly more than once, and give each a new capacity.
+    INDEX_TYPE const numArraysToChange = rand( 0, m_array.size() );
+    std::vector< INDEX_TYPE > arrays( numArraysToChange );
+    std::vector< INDEX_TYPE > newCapacities( numArraysToChange );
+    std::map< INDEX_TYPE, INDEX_TYPE > finalCapacities;
+    for( INDEX_TYPE j = 0; j < numArraysToChange; ++j )
+    {
+      arrays[ j ] = rand( 0, m_array.size() - 1 );
+      newCapacities[ j ] = rand( 0, maxCapacity );
+      finalCapacities[ arrays[ j ] ] = newCapacities[ j ];
+    }
+
+    m_array.setCapacitiesOfArrays( numArraysToChange, arrays.data(), newCapacities.data() );
+
+    for( auto const & arrayAndCapacity : finalCapacities )
+    {
+      INDEX_TYPE const i = arrayAndCapacity.first;
+      INDEX_TYPE const newCapacity = arrayAndCapacity.second;
+      ASSERT_EQ( m_array.capacityOfArray( i ), newCapacity );
+
+      if( newCapacity < INDEX_TYPE( m_ref[ i ].size() ) )
+      {
+        m_ref[ i ].resize( newCapacity );
+      }
+    }
+
+    COMPARE_TO_REFERENCE;
+
+    for( auto const & arrayAndCapacity : finalCapacities )
+    {
+      fillArray( arrayAndCapacity.first );
+    }
+
+    COMPARE_TO_REFERENCE;
+  }
+
   void deepCopy()
   {
     COMPARE_TO_REFERENCE;
@@ -827,6 +936,20 @@ TYPED_TEST( ArrayOfArraysTest, resizeWithCapacity )
   }
 }
 
+TYPED_TEST( ArrayOfArraysTest, buildFromPairs )
+{
+  for( INDEX_TYPE i = 0; i < 3; ++i )
+  {
+    this->template buildFromPairs< serialPolicy >( 100, 1000 );
+    this->emplace( 10 );
+
+#if defined( USE_OPENMP )
+    this->template buildFromPairs< parallelHostPolicy >( 150, 1000 );
+    this->emplace( 10 );
+#endif
+  }
+}
+
 TYPED_TEST( ArrayOfArraysTest, resizeFromCapacities )
 {
   for( INDEX_TYPE i = 0; i < 3; ++i )
@@ -837,6 +960,9 @@ TYPED_TEST( ArrayOfArraysTest, resizeFromCapacities )
 #if defined( USE_OPENMP )
     this->template resizeFromCapacities< parallelHostPolicy >( 150, 10 );
     this->emplace( 10 );
+
+    this->template resizeFromCapacities< parallelHostPolicy, true >( 200, 10 );
+    this->emplace( 10 );
 #endif
   }
 }
@@ -924,6 +1050,46 @@ TYPED_TEST( ArrayOfArraysTest, compress )
   }
 }
 
+TYPED_TEST( ArrayOfArraysTest, compressWithPolicy )
+{
+  this->resize( 100 );
+
+  for( INDEX_TYPE i = 0; i < 3; ++i )
+  {
+    this->appendToArray( 10 );
+    this->template compress< serialPolicy >();
+
+#if defined( USE_OPENMP )
+    this->appendToArray( 10 );
+    this->template compress< parallelHostPolicy >();
+#endif
+  }
+
+  // Enough values that the later batches are relocated in parallel.
+  this->resize( 1000 );
+  this->appendToArray( 1000 );
+  this->template compress< serialPolicy >();
+
+#if defined( USE_OPENMP )
+  this->appendToArray( 1000 );
+  this->template compress< parallelHostPolicy >();
+#endif
+}
+
+TYPED_TEST( ArrayOfArraysTest, shrinkToFit )
+{
+  this->resize( 100 );
+
+  for( INDEX_TYPE i = 0; i < 3; ++i )
+  {
+    this->appendToArray( 10 );
+    this->shrinkToFit();
+  }
+
+  this->resize( 0 );
+  this->shrinkToFit();
+}
+
 TYPED_TEST( ArrayOfArraysTest, capacity )
 {
   this->resize( 100 );
@@ -945,6 +1111,17 @@ TYPED_TEST( ArrayOfArraysTest, capacityOfArray )
   }
 }
 
+TYPED_TEST( ArrayOfArraysTest, capacitiesOfArrays )
+{
+  this->resize( 100 );
+
+  for( INDEX_TYPE i = 0; i < 3; ++i )
+  {
+    this->appendToArray( 10 );
+    this->capacitiesOfArrays( 30 );
+  }
+}
+
 TYPED_TEST( ArrayOfArraysTest, deepCopy )
 {
   this->resize( 100 );
@@ -1471,6 +1648,132 @@ public:
     }
   }
 
+  template< INDEX_TYPE APPENDS_PER_ARRAY_PER_THREAD >
+  void appendToArrayAtomic( INDEX_TYPE const numThreads )
+  {
+    INDEX_TYPE const nArrays = m_array.size();
+
+    for( INDEX_TYPE i = 0; i < nArrays; ++i )
+    {
+      ASSERT_EQ( m_array.sizeOfArray( i ), 0 );
+    }
+
+    ViewType const & view = m_array.toView();
+    forall< POLICY >( numThreads,
+                      [view, nArrays] LVARRAY_HOST_DEVICE ( INDEX_TYPE const threadNum )
+        {
+          for( INDEX_TYPE i = 0; i < nArrays; ++i )
+          {
+            T values[ APPENDS_PER_ARRAY_PER_THREAD ];
+            for( INDEX_TYPE j = 0; j < APPENDS_PER_ARRAY_PER_THREAD; ++j )
+            {
+              values[ j ] = T( i * LARGE_NUMBER + threadNum * APPENDS_PER_ARRAY_PER_THREAD + j );
+            }
+
+            view.template appendToArrayAtomic< AtomicPolicy >( i, values, values + APPENDS_PER_ARRAY_PER_THREAD );
+          }
+        } );
+
+    // Check that the values from each thread are contiguous, then sort each array and check the values.
+    m_array.move( MemorySpace::CPU );
+    INDEX_TYPE const appendsPerArray = numThreads * APPENDS_PER_ARRAY_PER_THREAD;
+    for( INDEX_TYPE i = 0; i < nArrays; ++i )
+    {
+      ASSERT_EQ( m_array.sizeOfArray( i ), appendsPerArray );
+      ASSERT_LE( m_array.sizeOfArray( i ), m_array.capacityOfArray( i ));
+
+      for( INDEX_TYPE j = 0; j < appendsPerArray; j += APPENDS_PER_ARRAY_PER_THREAD )
+      {
+        INDEX_TYPE threadNum = 0;
+        while( threadNum < numThreads &&
+               !( m_array( i, j ) == T( i * LARGE_NUMBER + threadNum * APPENDS_PER_ARRAY_PER_THREAD ) ) )
+        { ++threadNum; }
+
+        ASSERT_LT( threadNum, numThreads ) << i << ", " << j;
+        for( INDEX_TYPE k = 1; k < APPENDS_PER_ARRAY_PER_THREAD; ++k )
+        {
+          T const value = T( i * LARGE_NUMBER + threadNum * APPENDS_PER_ARRAY_PER_THREAD + k );
+          EXPECT_EQ( value, m_array( i, j + k ) ) << i << ", " << j << ", " << k;
+        }
+      }
+
+      T * const subArrayPtr = m_array[ i ];
+      std::sort( subArrayPtr, subArrayPtr + appendsPerArray );
+
+      for( INDEX_TYPE j = 0; j < appendsPerArray; ++j )
+      {
+        T const value = T( i * LARGE_NUMBER + j );
+        EXPECT_EQ( value, m_array( i, j ) ) << i << ", " << j;
+      }
+    }
+  }
+
+  void emplaceBackAtomicOrOverflow( INDEX_TYPE const numThreads, INDEX_TYPE const appendsPerArrayPerThread )
+  {
+    INDEX_TYPE const nArrays = m_array.size();
+
+    for( INDEX_TYPE i = 0; i < nArrays; ++i )
+    {
+      ASSERT_EQ( m_array.sizeOfArray( i ), 0 );
+    }
+
+    // The arrays have a random capacity, some of them too small to hold all the values.
+    std::vector< INDEX_TYPE > arrays( nArrays );
+    std::vector< INDEX_TYPE > capacities( nArrays );
+    INDEX_TYPE const appendsPerArray = numThreads * appendsPerArrayPerThread;
+    for( INDEX_TYPE i = 0; i < nArrays; ++i )
+    {
+      arrays[ i ] = i;
+      capacities[ i ] = rand( 0, 2 * appendsPerArray );
+    }
+    m_array.setCapacitiesOfArrays( nArrays, arrays.data(), capacities.data() );
+
+    // The overflow buffer lives on the host so a device policy is replaced by the serial policy.
+    using HOST_POLICY = std::conditional_t< RAJAHelper< POLICY >::space == MemorySpace::CPU, POLICY, serialPolicy >;
+    using HostAtomicPolicy = typename RAJAHelper< HOST_POLICY >::AtomicPolicy;
+
+    ArrayOfArraysOverflow< T, INDEX_TYPE > overflow;
+    ViewType const & view = m_array.toView();
+    forall< HOST_POLICY >( numThreads, [view, nArrays, appendsPerArrayPerThread, &overflow] ( INDEX_TYPE const threadNum )
+        {
+          for( INDEX_TYPE i = 0; i < nArrays; ++i )
+          {
+            for( INDEX_TYPE j = 0; j < appendsPerArrayPerThread; ++j )
+            {
+              T const value = T( i * LARGE_NUMBER + threadNum * appendsPerArrayPerThread + j );
+              view.template emplaceBackAtomicOrOverflow< HostAtomicPolicy >( i, overflow, value );
+            }
+          }
+        } );
+
+    INDEX_TYPE expectedOverflow = 0;
+    for( INDEX_TYPE i = 0; i < nArrays; ++i )
+    {
+      ASSERT_EQ( m_array.sizeOfArray( i ), std::min( capacities[ i ], appendsPerArray ) );
+      expectedOverflow += std::max( appendsPerArray - capacities[ i ], INDEX_TYPE( 0 ) );
+    }
+    ASSERT_EQ( overflow.size(), expectedOverflow );
+
+    m_array.template mergeOverflow< HOST_POLICY >( overflow );
+    EXPECT_EQ( overflow.size(), 0 );
+
+    // Now sort each array and check that the values are as expected.
+    for( INDEX_TYPE i = 0; i < nArrays; ++i )
+    {
+      ASSERT_EQ( m_array.sizeOfArray( i ), appendsPerArray );
+      ASSERT_EQ( m_array.capacityOfArray( i ), std::max( capacities[ i ], appendsPerArray ) );
+
+      T * const subArrayPtr = m_array[ i ];
+      std::sort( subArrayPtr, subArrayPtr + appendsPerArray );
+
+      for( INDEX_TYPE j = 0; j < appendsPerArray; ++j )
+      {
+        T const value = T( i * LARGE_NUMBER + j );
+        EXPECT_EQ( value, m_array( i, j ) ) << i << ", " << j;
+      }
+    }
+  }
+
 protected:
   using ParentClass::rand;
   using ParentClass::LARGE_NUMBER;
@@ -1516,6 +1819,24 @@ TYPED_TEST( ArrayOfArraysViewAtomicTest, atomicAppend )
   this->emplaceBackAtomic( NUM_THREADS, APPENDS_PER_THREAD );
 }
 
+TYPED_TEST( ArrayOfArraysViewAtomicTest, atomicAppendRange )
+{
+  INDEX_TYPE const NUM_THREADS = 10;
+  INDEX_TYPE const APPENDS_PER_THREAD = 10;
+
+  this->resize( 100, NUM_THREADS * APPENDS_PER_THREAD );
+  this->template appendToArrayAtomic< APPENDS_PER_THREAD >( NUM_THREADS );
+}
+
+TYPED_TEST( ArrayOfArraysViewAtomicTest, atomicAppendOrOverflow )
+{
+  INDEX_TYPE const NUM_THREADS = 10;
+  INDEX_TYPE const APPENDS_PER_THREAD = 10;
+
+  this->resize( 100, 0 );
+  this->emplaceBackAtomicOrOverflow( NUM_THREADS, APPENDS_PER_THREAD );
+}
+
 
 } // namespace testing
 } // namespace LvArray
@@ -321,6 +321,20 @@ public:
     COMPARE_TO_REFERENCE
 
     m_array.compress();
+    checkCompressed();
+  }
+
+  template< typename POLICY >
+  void compress()
+  {
+    COMPARE_TO_REFERENCE
+
+    m_array.template compress< POLICY >();
+    checkCompressed();
+  }
+
+  void checkCompressed()
+  {
     T const * const values = m_array[0];
 
     INDEX_TYPE curOffset = 0;
@@ -350,6 +364,30 @@ public:
     }
   }
 
+  void reserveSets( INDEX_TYPE const maxIncrease )
+  {
+    COMPARE_TO_REFERENCE
+
+    // Grow every set in one call, listing the sets from the back.
+    INDEX_TYPE const nSets = m_array.size();
+    std::vector< INDEX_TYPE > sets( nSets );
+    std::vector< INDEX_TYPE > newCapacities( nSets );
+    for( INDEX_TYPE j = 0; j < nSets; ++j )
+    {
+      sets[ j ] = nSets - 1 - j;
+      newCapacities[ j ] = m_array.sizeOfSet( sets[ j ] ) + rand( 0, maxIncrease );
+    }
+
+    m_array.setCapacitiesOfSets( nSets, sets.data(), newCapacities.data() );
+
+    for( INDEX_TYPE j = 0; j < nSets; ++j )
+    {
+      ASSERT_EQ( m_array.capacityOfSet( sets[ j ] ), newCapacities[ j ] );
+    }
+
+    COMPARE_TO_REFERENCE
+  }
+
   void fill()
   {
     COMPARE_TO_REFERENCE
@@ -468,6 +506,28 @@ public:
     COMPARE_TO_REFERENCE
   }
 
+  template< typename POLICY >
+  void buildFromPairs( INDEX_TYPE const newSize, INDEX_TYPE const numPairs, INDEX_TYPE const maxValue )
+  {
+    typename ArrayConverter< ARRAY_OF_SETS >::template Array< INDEX_TYPE, 1, RAJA::PERM_I > sets;
+    typename ArrayConverter< ARRAY_OF_SETS >::template Array< T, 1, RAJA::PERM_I > values;
+
+    m_ref.clear();
+    m_ref.resize( newSize );
+    for( INDEX_TYPE j = 0; j < numPairs; ++j )
+    {
+      INDEX_TYPE const i = rand( 0, newSize - 1 );
+      sets.emplace_back( i );
+      values.emplace_back( T( rand( 0, maxValue ) ) );
+      m_ref[ i ].insert( values[ j ] );
+    }
+
+    using AtomicPolicy = typename RAJAHelper< POLICY >::AtomicPolicy;
+    m_array.template buildFromPairs< POLICY, AtomicPolicy >( newSize, sets.toSliceConst(), values.toSliceConst() );
+
+    COMPARE_TO_REFERENCE
+  }
+
 protected:
 
   template< typename CONTAINER >
@@ -694,6 +754,21 @@ TYPED_TEST( ArrayOfSetsTest, compress )
   }
 }
 
+TYPED_TEST( ArrayOfSetsTest, compressWithPolicy )
+{
+  this->resize( 50 );
+  for( INDEX_TYPE i = 0; i < 2; ++i )
+  {
+    this->insertIntoSet( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VALUE );
+    this->template compress< serialPolicy >();
+
+#if defined( USE_OPENMP )
+    this->insertIntoSet( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VALUE );
+    this->template compress< parallelHostPolicy >();
+#endif
+  }
+}
+
 TYPED_TEST( ArrayOfSetsTest, capacity )
 {
   this->resize( 50 );
@@ -704,6 +779,16 @@ TYPED_TEST( ArrayOfSetsTest, capacity )
   }
 }
 
+TYPED_TEST( ArrayOfSetsTest, capacitiesOfSets )
+{
+  this->resize( 50 );
+  for( INDEX_TYPE i = 0; i < 2; ++i )
+  {
+    this->reserveSets( 50 );
+    this->fill();
+  }
+}
+
 TYPED_TEST( ArrayOfSetsTest, deepCopy )
 {
   this->resize( 50 );
@@ -742,6 +827,20 @@ TYPED_TEST( ArrayOfSetsTest, assimilateUnsortedWithDuplicates )
   this->assimilate( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VALUE, sortedArrayManipulation::UNSORTED_WITH_DUPLICATES );
 }
 
+TYPED_TEST( ArrayOfSetsTest, buildFromPairs )
+{
+  for( INDEX_TYPE i = 0; i < 2; ++i )
+  {
+    this->template buildFromPairs< serialPolicy >( 50, 1000, DEFAULT_MAX_VALUE );
+    this->insertIntoSet( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VALUE );
+
+#if defined( USE_OPENMP )
+    this->template buildFromPairs< parallelHostPolicy >( 75, 1000, DEFAULT_MAX_VALUE );
+    this->insertIntoSet( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VALUE );
+#endif
+  }
+}
+
 // This is testing capabilities of the ArrayOfArrays class, however it needs to first populate
 // the ArrayOfSets so it involves less code duplication to put it here.
 TYPED_TEST( ArrayOfSetsTest, ArrayOfArraysStealFrom )
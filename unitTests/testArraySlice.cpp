@@ -19,6 +19,7 @@
 // Source includes
 #include "Array.hpp"
 #include "MallocBuffer.hpp"
+#include "sliceHelpers.hpp"
 
 // TPL includes
 #include <gtest/gtest.h>
@@ -112,6 +113,53 @@ protected:
     }
   }
 
+  template< int DIM >
+  void subRange()
+  {
+    std::ptrdiff_t const end = m_array.size( DIM );
+
+    // Every index but the first.
+    checkSubRange< DIM >( m_array.template subRange< DIM >( 1, end ), 1, 1 );
+
+    // Every other index.
+    checkSubRange< DIM >( m_array.template subRange< DIM >( 0, end, 2 ), 0, 2 );
+  }
+
+  template< int DIM, typename SUB_SLICE >
+  void checkSubRange( SUB_SLICE const & subSlice, std::ptrdiff_t const begin, std::ptrdiff_t const step )
+  {
+    EXPECT_EQ( subSlice.size( DIM ), ( m_array.size( DIM ) - begin + step - 1 ) / step );
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      if( dim != DIM )
+      { EXPECT_EQ( subSlice.size( dim ), m_array.size( dim ) ); }
+    }
+
+    // Only ranges of the largest stride dimension are contiguous.
+    bool const contiguous = RAJA::as_array< PERMUTATION >::get()[ 0 ] == DIM && step == 1;
+    EXPECT_EQ( subSlice.isContiguous(), contiguous );
+
+    std::ptrdiff_t numValues = 0;
+    forValuesInSliceWithIndices( subSlice.toSlice(), [&]( int const & value, auto const ... indices )
+    {
+      std::array< std::ptrdiff_t, NDIM > parentIndices{ { indices ... } };
+      parentIndices[ DIM ] = begin + step * parentIndices[ DIM ];
+
+      std::ptrdiff_t offset = 0;
+      for( int dim = 0; dim < NDIM; ++dim )
+      { offset += parentIndices[ dim ] * m_array.strides()[ dim ]; }
+
+      EXPECT_EQ( &value, m_array.data() + offset );
+      EXPECT_EQ( &subSlice( indices ... ), &value );
+      ++numValues;
+    } );
+
+    EXPECT_EQ( numValues, subSlice.size() );
+
+    if( contiguous )
+    { EXPECT_EQ( subSlice.dataIfContiguous(), m_array.data() + begin * m_array.strides()[ DIM ] ); }
+  }
+
   ARRAY m_array;
 };
 
@@ -158,6 +206,50 @@ TYPED_TEST( ArraySliceTest, IsContiguous )
   this->checkOneSlice();
 }
 
+TYPED_TEST( ArraySliceTest, subRange )
+{
+  this->resize();
+  this->template subRange< 0 >();
+  this->template subRange< 1 >();
+}
+
+TEST( ArraySlice, subRangeChained )
+{
+  Array< int, 2, RAJA::PERM_IJ, std::ptrdiff_t, MallocBuffer > array( 6, 8 );
+  forValuesInSliceWithIndices( array.toSlice(), []( int & value, std::ptrdiff_t const i, std::ptrdiff_t const j )
+  {
+    value = 10 * i + j;
+  } );
+
+  // Rows 2 through 4 are contiguous.
+  auto const rows = array.subRange< 0 >( 2, 5 );
+  EXPECT_TRUE( rows.isContiguous() );
+  EXPECT_EQ( rows.dataIfContiguous(), &array( 2, 0 ) );
+  EXPECT_EQ( rows.end() - rows.begin(), 3 * 8 );
+
+  // Every third column of those rows is not.
+  auto const block = rows.subRange< 1 >( 1, 8, 3 );
+  EXPECT_FALSE( block.isContiguous() );
+  ASSERT_EQ( block.size( 0 ), 3 );
+  ASSERT_EQ( block.size( 1 ), 3 );
+
+  for( std::ptrdiff_t i = 0; i < block.size( 0 ); ++i )
+  {
+    for( std::ptrdiff_t j = 0; j < block.size( 1 ); ++j )
+    {
+      EXPECT_EQ( block[ i ][ j ], 10 * ( 2 + i ) + ( 1 + 3 * j ) );
+      EXPECT_EQ( &block( i, j ), &array( 2 + i, 1 + 3 * j ) );
+    }
+  }
+
+  // Writing through the range modifies the array.
+  block( 1, 2 ) = -1;
+  EXPECT_EQ( array( 3, 7 ), -1 );
+
+  // An empty range.
+  EXPECT_EQ( array.subRange< 0 >( 3, 3 ).size(), 0 );
+}
+
 } // namespace LvArray
 
 // This is the default gtest main method. It is included for ease of debugging.
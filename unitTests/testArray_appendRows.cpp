@@ -0,0 +1,161 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "Array.hpp"
+#include "testUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <set>
+
+namespace LvArray
+{
+namespace testing
+{
+
+using INDEX_TYPE = std::ptrdiff_t;
+
+template< typename ARRAY_PERM_PAIR >
+class AppendRowsTest : public ::testing::Test
+{
+public:
+  using ARRAY = typename ARRAY_PERM_PAIR::first_type;
+  using T = typename ARRAY::value_type;
+  static constexpr int NDIM = ARRAY::ndim;
+
+  using SRC_PERM = typename ARRAY_PERM_PAIR::second_type;
+
+  void emplaceBackRow()
+  {
+    resizeInnerDimensions( m_array );
+
+    std::set< T const * > allocations;
+    for( INDEX_TYPE row = 0; row < NUM_ROWS; ++row )
+    {
+      m_array.emplaceBackRow( row );
+      allocations.insert( m_array.data() );
+
+      EXPECT_EQ( m_array.size( 0 ), row + 1 );
+      EXPECT_GE( m_array.capacity(), m_array.size() );
+    }
+
+    // The capacity grows geometrically.
+    EXPECT_LT( allocations.size(), 20 );
+
+    forValuesInSliceWithIndices( m_array.toSliceConst(), [] ( T const & value, INDEX_TYPE const row, auto const ... )
+    {
+      EXPECT_EQ( value, T( row ) );
+    } );
+  }
+
+  void appendRows()
+  {
+    resizeInnerDimensions( m_array );
+
+    Array< T, NDIM, SRC_PERM, INDEX_TYPE, DEFAULT_BUFFER > rows;
+    resizeInnerDimensions( rows );
+
+    INDEX_TYPE numRows = 0;
+    for( INDEX_TYPE numToAppend = 0; numRows + numToAppend <= NUM_ROWS; ++numToAppend )
+    {
+      rows.resize( numToAppend );
+      forValuesInSliceWithIndices( rows.toSlice(), [numRows] ( T & value, INDEX_TYPE const row, auto const ... indices )
+      {
+        value = T( valueAt( numRows + row, indices ... ) );
+      } );
+
+      m_array.appendRows( rows.toSliceConst() );
+      numRows += numToAppend;
+      EXPECT_EQ( m_array.size( 0 ), numRows );
+    }
+
+    forValuesInSliceWithIndices( m_array.toSliceConst(), [] ( T const & value, auto const ... indices )
+    {
+      EXPECT_EQ( value, T( valueAt( indices ... ) ) );
+    } );
+  }
+
+private:
+  static constexpr INDEX_TYPE NUM_ROWS = 500;
+
+  template< typename ... INDICES >
+  static INDEX_TYPE valueAt( INDICES const ... indices )
+  {
+    INDEX_TYPE value = 0;
+    forEachArg( [&value] ( INDEX_TYPE const index )
+    {
+      value = 10 * value + index;
+    }, indices ... );
+
+    return value;
+  }
+
+  template< typename ARRAY_TYPE >
+  static void resizeInnerDimensions( ARRAY_TYPE & array )
+  {
+    INDEX_TYPE dims[ NDIM ];
+    dims[ 0 ] = 0;
+    for( int dim = 1; dim < NDIM; ++dim )
+    {
+      dims[ dim ] = 1 + dim;
+    }
+
+    array.resize( NDIM, dims );
+  }
+
+  ARRAY m_array;
+};
+
+using AppendRowsTestTypes = ::testing::Types<
+  std::pair< Array< int, 1, RAJA::PERM_I, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_I >
+  , std::pair< Array< int, 2, RAJA::PERM_IJ, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_IJ >
+  , std::pair< Array< int, 2, RAJA::PERM_IJ, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_JI >
+  , std::pair< Array< int, 3, RAJA::PERM_IJK, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_KJI >
+  , std::pair< Array< int, 3, RAJA::PERM_IKJ, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_IJK >
+  , std::pair< Array< Tensor, 2, RAJA::PERM_IJ, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_JI >
+  , std::pair< Array< Tensor, 3, RAJA::PERM_IJK, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_IJK >
+  , std::pair< Array< TestString, 1, RAJA::PERM_I, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_I >
+  , std::pair< Array< TestString, 2, RAJA::PERM_IJ, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_JI >
+  , std::pair< Array< TestString, 4, RAJA::PERM_IJKL, INDEX_TYPE, DEFAULT_BUFFER >, RAJA::PERM_LKJI >
+  >;
+
+TYPED_TEST_SUITE( AppendRowsTest, AppendRowsTestTypes, );
+
+TYPED_TEST( AppendRowsTest, emplaceBackRow )
+{
+  this->emplaceBackRow();
+}
+
+TYPED_TEST( AppendRowsTest, appendRows )
+{
+  this->appendRows();
+}
+
+} // namespace testing
+} // namespace LvArray
+
+// This is the default gtest main method. It is included for ease of debugging.
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+  return result;
+}
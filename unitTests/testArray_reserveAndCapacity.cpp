@@ -29,6 +29,16 @@ TYPED_TEST( ArrayTest, reserveAndCapacity )
   this->reserveAndCapacity();
 }
 
+TYPED_TEST( ArrayTest, reserveDefaultDimension )
+{
+  this->reserveDefaultDimension();
+}
+
+TYPED_TEST( ArrayTest, shrinkToFit )
+{
+  this->shrinkToFit();
+}
+
 } // namespace testing
 } // namespace LvArray
 
@@ -29,6 +29,15 @@ TYPED_TEST( ArrayTest, resizeDefault )
   this->resize( true );
 }
 
+TYPED_TEST( ArrayTest, resizeDefaultWithPolicy )
+{
+  this->template resizeDefaultWithPolicy< serialPolicy >();
+
+#if defined(USE_OPENMP)
+  this->template resizeDefaultWithPolicy< parallelHostPolicy >();
+#endif
+}
+
 } // namespace testing
 } // namespace LvArray
 
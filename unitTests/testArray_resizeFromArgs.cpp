@@ -29,6 +29,15 @@ TYPED_TEST( ArrayTest, resizeFromArgs )
   this->resizeFromArgs();
 }
 
+TYPED_TEST( ArrayTest, resizeFromArgsWithPolicy )
+{
+  this->template resizeFromArgsWithPolicy< serialPolicy >();
+
+#if defined(USE_OPENMP)
+  this->template resizeFromArgsWithPolicy< parallelHostPolicy >();
+#endif
+}
+
 } // namespace testing
 } // namespace LvArray
 
@@ -0,0 +1,181 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "Array.hpp"
+#include "testUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+namespace LvArray
+{
+namespace testing
+{
+
+template< typename PERMUTATION >
+using StaticArray4D = Array< int, 4, PERMUTATION, std::ptrdiff_t, MallocBuffer, Extents< DYNAMIC_EXTENT, 8, 3, 3 > >;
+
+template< typename PERMUTATION >
+using DynamicArray4D = Array< int, 4, PERMUTATION, std::ptrdiff_t, MallocBuffer >;
+
+template< typename PERMUTATION >
+class StaticExtentsTest : public ::testing::Test
+{
+public:
+  using STATIC_ARRAY = StaticArray4D< PERMUTATION >;
+  using DYNAMIC_ARRAY = DynamicArray4D< PERMUTATION >;
+
+  void indexing()
+  {
+    fill( 13 );
+
+    for( std::ptrdiff_t i = 0; i < m_static.size( 0 ); ++i )
+    {
+      for( std::ptrdiff_t j = 0; j < 8; ++j )
+      {
+        for( std::ptrdiff_t k = 0; k < 3; ++k )
+        {
+          for( std::ptrdiff_t l = 0; l < 3; ++l )
+          {
+            EXPECT_EQ( &m_static( i, j, k, l ) - m_static.data(), &m_dynamic( i, j, k, l ) - m_dynamic.data() );
+            EXPECT_EQ( m_static[ i ][ j ][ k ][ l ], m_dynamic( i, j, k, l ) );
+            EXPECT_EQ( m_static.toSliceConst()[ i ][ j ]( k, l ), m_dynamic( i, j, k, l ) );
+            EXPECT_EQ( m_static.toView()[ i ]( j, k, l ), m_dynamic( i, j, k, l ) );
+          }
+        }
+      }
+    }
+  }
+
+  void resize()
+  {
+    fill( 5 );
+
+    m_static.resize( std::ptrdiff_t( 9 ) );
+    m_dynamic.resize( std::ptrdiff_t( 9 ) );
+    EXPECT_EQ( m_static.size(), m_dynamic.size() );
+    EXPECT_EQ( m_static.size( 1 ), 8 );
+
+    for( std::ptrdiff_t i = 0; i < m_static.size(); ++i )
+    { EXPECT_EQ( m_static.data()[ i ], m_dynamic.data()[ i ] ); }
+
+    m_static.resize( 2, 8, 3, 3 );
+    EXPECT_EQ( m_static.size(), 2 * 8 * 3 * 3 );
+
+    m_static.clear();
+    EXPECT_EQ( m_static.size(), 0 );
+    EXPECT_EQ( m_static.size( 1 ), 8 );
+    EXPECT_EQ( m_static.size( 3 ), 3 );
+
+    EXPECT_DEATH_IF_SUPPORTED( m_static.resize( 2, 7, 3, 3 ), "" );
+    EXPECT_DEATH_IF_SUPPORTED( m_static.template resizeDimension< 2 >( 4 ), "" );
+  }
+
+  void dynamicSlice()
+  {
+    fill( 4 );
+
+    ArraySlice< int const, 4, STATIC_ARRAY::USD, std::ptrdiff_t > const slice = m_static.toSliceConst();
+    ArraySlice< int, 3, STATIC_ARRAY::USD - 1, std::ptrdiff_t > const subSlice = m_static[ 2 ];
+
+    for( std::ptrdiff_t j = 0; j < 8; ++j )
+    {
+      for( std::ptrdiff_t k = 0; k < 3; ++k )
+      {
+        for( std::ptrdiff_t l = 0; l < 3; ++l )
+        {
+          EXPECT_EQ( slice( 2, j, k, l ), m_dynamic( 2, j, k, l ) );
+          EXPECT_EQ( subSlice( j, k, l ), m_dynamic( 2, j, k, l ) );
+        }
+      }
+    }
+  }
+
+private:
+  void fill( std::ptrdiff_t const n )
+  {
+    m_static.resize( n, 8, 3, 3 );
+    m_dynamic.resize( n, 8, 3, 3 );
+
+    for( std::ptrdiff_t i = 0; i < m_dynamic.size(); ++i )
+    {
+      m_static.data()[ i ] = i;
+      m_dynamic.data()[ i ] = i;
+    }
+  }
+
+  STATIC_ARRAY m_static;
+  DYNAMIC_ARRAY m_dynamic;
+};
+
+using StaticExtentsTestTypes = ::testing::Types<
+  RAJA::PERM_IJKL
+  , RAJA::PERM_LKJI
+  , RAJA::PERM_JILK
+  , RAJA::PERM_KLIJ
+  >;
+
+TYPED_TEST_SUITE( StaticExtentsTest, StaticExtentsTestTypes, );
+
+TYPED_TEST( StaticExtentsTest, indexing )
+{
+  this->indexing();
+}
+
+TYPED_TEST( StaticExtentsTest, resize )
+{
+  this->resize();
+}
+
+TYPED_TEST( StaticExtentsTest, dynamicSlice )
+{
+  this->dynamicSlice();
+}
+
+TEST( StaticExtents, strides )
+{
+  using ARRAY = StaticArray4D< RAJA::PERM_IJKL >;
+  static_assert( std::is_same< typename ARRAY::STRIDES, camp::idx_seq< 72, 9, 3, DYNAMIC_EXTENT > >::value, "Should be true." );
+  static_assert( std::is_same< std::remove_const_t< typename ARRAY::ViewType >,
+                               ArrayView< int, 4, 3, std::ptrdiff_t, MallocBuffer, typename ARRAY::STRIDES > >::value,
+                 "Should be true." );
+  static_assert( std::is_same< decltype( std::declval< ARRAY & >()[ 0 ] ),
+                               ArraySlice< int, 3, 2, std::ptrdiff_t, camp::idx_seq< 9, 3, DYNAMIC_EXTENT > > >::value,
+                 "Should be true." );
+
+  static_assert( std::is_same< typename DynamicArray4D< RAJA::PERM_IJKL >::ViewType,
+                               ArrayView< int, 4, 3, std::ptrdiff_t, MallocBuffer > const >::value, "Should be true." );
+
+  ARRAY array( 2, 8, 3, 3 );
+  EXPECT_EQ( array.strides()[ 0 ], 72 );
+  EXPECT_EQ( array.strides()[ 1 ], 9 );
+  EXPECT_EQ( array.strides()[ 2 ], 3 );
+  EXPECT_EQ( array.strides()[ 3 ], 1 );
+}
+
+} // namespace testing
+} // namespace LvArray
+
+// This is the default gtest main method. It is included for ease of debugging.
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+  return result;
+}
@@ -25,6 +25,14 @@
 #include "bufferManipulation.hpp"
 #include "StackBuffer.hpp"
 #include "MallocBuffer.hpp"
+#include "PoolBuffer.hpp"
+#include "AlignedBuffer.hpp"
+#include "MmapBuffer.hpp"
+#include "SmallBuffer.hpp"
+#include "CopyOnWriteBuffer.hpp"
+#include "AllocationRegistry.hpp"
+#include "ArrayOfArrays.hpp"
+#include "CRSMatrix.hpp"
 
 // TPL includes
 #include <gtest/gtest.h>
@@ -32,6 +40,11 @@
 // System includes
 #include <vector>
 #include <random>
+#include <memory>
+#include <cstring>
+#include <cstdlib>
+
+#include <unistd.h>
 
 
 namespace LvArray
@@ -39,6 +52,59 @@ namespace LvArray
 namespace testing
 {
 
+/**
+ * @class RelocatableInt
+ * @brief A heap allocated integer that is not trivially copyable but is trivially relocatable.
+ *   Used to test the relocation code paths with a type that owns memory.
+ */
+class RelocatableInt
+{
+public:
+
+  RelocatableInt( int const value=0 ):
+    m_value( new int( value ) )
+  {}
+
+  RelocatableInt( RelocatableInt const & src ):
+    m_value( new int( *src.m_value ) )
+  {}
+
+  RelocatableInt( RelocatableInt && src ) = default;
+
+  RelocatableInt & operator=( RelocatableInt const & src )
+  {
+    m_value.reset( new int( *src.m_value ) );
+    return *this;
+  }
+
+  RelocatableInt & operator=( RelocatableInt && src ) = default;
+
+  bool operator==( RelocatableInt const & rhs ) const
+  { return *m_value == *rhs.m_value; }
+
+  friend std::ostream & operator<<( std::ostream & os, RelocatableInt const & x )
+  { return os << *x.m_value; }
+
+private:
+  std::unique_ptr< int > m_value;
+};
+
+} // namespace testing
+
+/**
+ * @brief Specialization of IsTriviallyRelocatable for RelocatableInt.
+ */
+template<>
+struct IsTriviallyRelocatable< testing::RelocatableInt > : std::true_type
+{};
+
+static_assert( isTriviallyRelocatable< int >, "int should be trivially relocatable." );
+static_assert( isTriviallyRelocatable< testing::RelocatableInt const >, "RelocatableInt should be trivially relocatable." );
+static_assert( !isTriviallyRelocatable< testing::TestString >, "TestString should not be trivially relocatable." );
+
+namespace testing
+{
+
 /**
  * @tparam BUFFER_TYPE the type of the buffer to check.
  * @brief Check that the provided buffer has identical contents to the std::vector.
@@ -78,6 +144,15 @@ using BufferAPITestTypes = ::testing::Types<
   StackBuffer< int, NO_REALLOC_CAPACITY >
   , MallocBuffer< int >
   , MallocBuffer< TestString >
+  , PoolBuffer< int >
+  , PoolBuffer< TestString >
+  , CacheLineAlignedBuffer< int >
+  , AlignedBuffer< TestString, 128 >
+  , MmapBuffer< int >
+  , MmapBuffer< TestString >
+  , SmallBuffer< int, 16 >
+  , SmallBuffer< int, NO_REALLOC_CAPACITY >
+  , CopyOnWriteBuffer< int >
 #if defined(USE_CHAI)
   , NewChaiBuffer< int >
   , NewChaiBuffer< TestString >
@@ -628,6 +703,38 @@ public:
 
     COMPARE_TO_REFERENCE( m_buffer, m_ref );
   }
+
+  /**
+   * @tparam POLICY the RAJA policy to use.
+   * @brief Test the policy versions of resize and reserve.
+   */
+  template< typename POLICY >
+  void resizeAndReserveWithPolicy()
+  {
+    COMPARE_TO_REFERENCE( m_buffer, m_ref );
+
+    T const val( randInt() );
+    bufferManipulation::resize< POLICY >( m_buffer, size(), size() + 1000, val );
+    m_ref.resize( size() + 1000, val );
+
+    COMPARE_TO_REFERENCE( m_buffer, m_ref );
+
+    bufferManipulation::reserve< POLICY >( m_buffer, size(), size() + 500 );
+    EXPECT_GE( m_buffer.capacity(), size() + 500 );
+    T const * const ptr = m_buffer.data();
+
+    T const newVal( randInt() );
+    bufferManipulation::resize< POLICY >( m_buffer, size(), size() + 500, newVal );
+    m_ref.resize( size() + 500, newVal );
+
+    EXPECT_EQ( ptr, m_buffer.data() );
+    COMPARE_TO_REFERENCE( m_buffer, m_ref );
+
+    bufferManipulation::resize< POLICY >( m_buffer, size(), size() - 700 );
+    m_ref.resize( size() - 700 );
+
+    COMPARE_TO_REFERENCE( m_buffer, m_ref );
+  }
 };
 
 /// The list of types to instantiate BufferTestWithRealloc with,
@@ -635,6 +742,18 @@ public:
 using BufferTestWithReallocTypes = ::testing::Types<
   MallocBuffer< int >
   , MallocBuffer< TestString >
+  , MallocBuffer< RelocatableInt >
+  , PoolBuffer< int >
+  , PoolBuffer< TestString >
+  , PoolBuffer< RelocatableInt >
+  , CacheLineAlignedBuffer< int >
+  , AlignedBuffer< TestString, 128 >
+  , MmapBuffer< int >
+  , MmapBuffer< TestString >
+  , MmapBuffer< RelocatableInt >
+  , SmallBuffer< int, 16 >
+  , SmallBuffer< RelocatableInt, 4 >
+  , CopyOnWriteBuffer< int >
 #if defined(USE_CHAI)
   , NewChaiBuffer< int >
   , NewChaiBuffer< TestString >
@@ -659,6 +778,18 @@ TYPED_TEST( BufferTestWithRealloc, reserve )
   this->reserve();
 }
 
+/**
+ * @brief Test bufferManipulation::resize and bufferManipulation::reserve with a RAJA policy.
+ */
+TYPED_TEST( BufferTestWithRealloc, resizeAndReserveWithPolicy )
+{
+  this->template resizeAndReserveWithPolicy< serialPolicy >();
+
+#if defined(USE_OPENMP)
+  this->template resizeAndReserveWithPolicy< parallelHostPolicy >();
+#endif
+}
+
 /**
  * @brief Test bufferManipulation::emplaceBack.
  */
@@ -706,6 +837,929 @@ TYPED_TEST( BufferTestWithRealloc, combination )
   this->popBack( 100 );
 }
 
+/**
+ * @brief Test that containers using PoolBuffer can be built concurrently and that the memory is recycled.
+ */
+TEST( PoolBuffer, concurrentContainers )
+{
+#if defined(USE_OPENMP)
+  using POLICY = parallelHostPolicy;
+#else
+  using POLICY = serialPolicy;
+#endif
+
+  std::ptrdiff_t const numTasks = 64;
+  std::ptrdiff_t const numValues = 500;
+
+  Array< std::ptrdiff_t, 1, RAJA::PERM_I, std::ptrdiff_t, MallocBuffer > sums( numTasks );
+  ArrayView< std::ptrdiff_t, 1, 0, std::ptrdiff_t, MallocBuffer > const & sumsView = sums.toView();
+
+  forall< POLICY >( numTasks, [sumsView, numValues] ( std::ptrdiff_t const task )
+  {
+    for( std::ptrdiff_t iter = 0; iter < 10; ++iter )
+    {
+      Array< std::ptrdiff_t, 1, RAJA::PERM_I, std::ptrdiff_t, PoolBuffer > array;
+      ArrayOfArrays< std::ptrdiff_t, std::ptrdiff_t, PoolBuffer > arrayOfArrays( 10 );
+      SortedArray< std::ptrdiff_t, std::ptrdiff_t, PoolBuffer > set;
+      for( std::ptrdiff_t i = 0; i < numValues; ++i )
+      {
+        array.emplace_back( task + i );
+        arrayOfArrays.emplaceBack( i % 10, i );
+        set.insert( i );
+      }
+
+      std::ptrdiff_t sum = 0;
+      for( std::ptrdiff_t i = 0; i < numValues; ++i )
+      {
+        sum += array[ i ] - set[ i ];
+      }
+
+      for( std::ptrdiff_t i = 0; i < arrayOfArrays.size(); ++i )
+      {
+        for( std::ptrdiff_t const value : arrayOfArrays[ i ] )
+        {
+          sum -= value;
+        }
+      }
+
+      sumsView[ task ] += sum;
+    }
+  } );
+
+  for( std::ptrdiff_t task = 0; task < numTasks; ++task )
+  {
+    EXPECT_EQ( sums[ task ], 10 * task * numValues - 10 * numValues * ( numValues - 1 ) / 2 );
+  }
+
+  memoryPool::release();
+  EXPECT_EQ( memoryPool::numCachedBytes(), 0 );
+}
+
+/**
+ * @brief Test that reallocating a PoolBuffer to zero capacity returns its block instead of allocating a new one.
+ */
+TEST( PoolBuffer, reallocateToZero )
+{
+  PoolBuffer< TestString > buffer( true );
+  EXPECT_EQ( buffer.data(), nullptr );
+
+  // Reallocating an empty buffer to zero shouldn't allocate.
+  buffer.reallocate( 0, 0 );
+  EXPECT_EQ( buffer.data(), nullptr );
+  EXPECT_EQ( buffer.capacity(), 0 );
+
+  buffer.reallocate( 0, 10 );
+  for( int i = 0; i < 5; ++i )
+  {
+    new ( buffer.data() + i ) TestString( i );
+  }
+
+  // The values are destroyed and the block is returned.
+  buffer.reallocate( 5, 0 );
+  EXPECT_EQ( buffer.data(), nullptr );
+  EXPECT_EQ( buffer.capacity(), 0 );
+
+  buffer.free();
+}
+
+/**
+ * @brief Test that memoryPool::allocate rounds small requests up to a power of two and recycles them.
+ */
+TEST( MemoryPool, recycling )
+{
+  memoryPool::release();
+
+  EXPECT_EQ( memoryPool::allocate( 0 ), nullptr );
+  EXPECT_EQ( memoryPool::blockSize( 100 ), 128 );
+  EXPECT_EQ( memoryPool::blockSize( memoryPool::maxBlockSize() + 1 ), memoryPool::maxBlockSize() + 1 );
+
+  void * const ptr = memoryPool::allocate( 100 );
+  std::memset( ptr, 0, memoryPool::blockSize( 100 ) );
+  memoryPool::deallocate( ptr, 100 );
+  EXPECT_EQ( memoryPool::numCachedBytes(), 128 );
+
+  EXPECT_EQ( memoryPool::allocate( 128 ), ptr );
+  EXPECT_EQ( memoryPool::numCachedBytes(), 0 );
+  memoryPool::deallocate( ptr, 128 );
+
+  void * const bigPtr = memoryPool::allocate( 2 * memoryPool::maxBlockSize() );
+  memoryPool::deallocate( bigPtr, 2 * memoryPool::maxBlockSize() );
+  EXPECT_EQ( memoryPool::numCachedBytes(), 128 );
+
+  memoryPool::release();
+  EXPECT_EQ( memoryPool::numCachedBytes(), 0 );
+}
+
+/**
+ * @brief Test that AlignedBuffer allocations are aligned and that the alignment is published to ArrayView.
+ */
+TEST( AlignedBuffer, alignment )
+{
+  static_assert( bufferManipulation::Alignment< MallocBuffer< double > >::value == alignof( double ),
+                 "MallocBuffer should use the alignment of its type." );
+  static_assert( bufferManipulation::Alignment< CacheLineAlignedBuffer< double > >::value == CACHE_LINE_SIZE,
+                 "CacheLineAlignedBuffer should be aligned to a cache line." );
+  static_assert( ArrayView< double, 2, 1, std::ptrdiff_t, CacheLineAlignedBuffer >::alignment == CACHE_LINE_SIZE,
+                 "ArrayView should publish the alignment of the buffer." );
+
+  Array< double, 1, RAJA::PERM_I, std::ptrdiff_t, CacheLineAlignedBuffer > array;
+  for( std::ptrdiff_t i = 0; i < 1000; ++i )
+  {
+    array.emplace_back( i );
+    EXPECT_EQ( reinterpret_cast< std::uintptr_t >( array.data() ) % CACHE_LINE_SIZE, 0 );
+    EXPECT_EQ( array.toView().alignedData(), array.data() );
+  }
+
+  for( std::ptrdiff_t i = 0; i < 1000; ++i )
+  {
+    EXPECT_EQ( array[ i ], i );
+  }
+
+  enableHugePages( HUGE_PAGE_SIZE );
+  array.resize( 2 * HUGE_PAGE_SIZE / sizeof( double ) );
+  EXPECT_EQ( reinterpret_cast< std::uintptr_t >( array.data() ) % HUGE_PAGE_SIZE, 0 );
+  disableHugePages();
+
+  for( std::ptrdiff_t i = 0; i < 1000; ++i )
+  {
+    EXPECT_EQ( array[ i ], i );
+  }
+}
+
+/**
+ * @brief @return The path of a new empty temporary file.
+ */
+std::string temporaryFile()
+{
+  char const * const tmpDir = std::getenv( "TMPDIR" );
+  std::string path = std::string( tmpDir == nullptr ? "/tmp" : tmpDir ) + "/testBuffersXXXXXX";
+  int const fd = mkstemp( &path[ 0 ] );
+  LVARRAY_ERROR_IF_EQ( fd, -1 );
+  close( fd );
+  return path;
+}
+
+TEST( MmapBuffer, fileModes )
+{
+  std::string const path = temporaryFile();
+
+  // Grow a file backed buffer one value at a time.
+  {
+    MmapBuffer< std::ptrdiff_t > buffer( path, MmapMode::READ_WRITE );
+    EXPECT_TRUE( buffer.isFileBacked() );
+    EXPECT_EQ( buffer.capacity(), 0 );
+
+    for( std::ptrdiff_t i = 0; i < 10000; ++i )
+    {
+      bufferManipulation::emplaceBack( buffer, i, 2 * i );
+    }
+
+    bufferManipulation::setCapacity( buffer, 10000, 10000 );
+    buffer.sync();
+    bufferManipulation::free( buffer, 10000 );
+  }
+
+  // Modify a copy on write mapping and grow it.
+  {
+    MmapBuffer< std::ptrdiff_t > buffer( path, MmapMode::COPY_ON_WRITE );
+    ASSERT_EQ( buffer.capacity(), 10000 );
+    for( std::ptrdiff_t i = 0; i < 10000; ++i )
+    {
+      EXPECT_EQ( buffer[ i ], 2 * i );
+      buffer[ i ] = -1;
+    }
+
+    bufferManipulation::emplaceBack( buffer, 10000, -1 );
+    EXPECT_FALSE( buffer.isFileBacked() );
+    for( std::ptrdiff_t i = 0; i < 10001; ++i )
+    {
+      EXPECT_EQ( buffer[ i ], -1 );
+    }
+
+    bufferManipulation::free( buffer, 10001 );
+  }
+
+  // The file is unchanged.
+  {
+    MmapBuffer< std::ptrdiff_t > buffer( path, MmapMode::READ_ONLY );
+    ASSERT_EQ( buffer.capacity(), 10000 );
+    for( std::ptrdiff_t i = 0; i < 10000; ++i )
+    {
+      EXPECT_EQ( buffer[ i ], 2 * i );
+    }
+
+    bufferManipulation::free( buffer, 10000 );
+  }
+
+  std::remove( path.c_str() );
+}
+
+TEST( MmapBuffer, reopenContainers )
+{
+  std::string const arrayPath = temporaryFile();
+  std::string const offsetsPath = temporaryFile();
+  std::string const sizesPath = temporaryFile();
+  std::string const columnsPath = temporaryFile();
+  std::string const entriesPath = temporaryFile();
+
+  // Build the containers directly in the files.
+  {
+    Array< int, 2, RAJA::PERM_IJ, std::ptrdiff_t, MmapBuffer > array;
+    array.adoptBuffer( MmapBuffer< int >( arrayPath, MmapMode::READ_WRITE ), 0, 3 );
+    array.resize( 100, 3 );
+    for( std::ptrdiff_t i = 0; i < 100; ++i )
+    {
+      for( std::ptrdiff_t j = 0; j < 3; ++j )
+      {
+        array( i, j ) = 3 * i + j;
+      }
+    }
+
+    CRSMatrix< double, int, std::ptrdiff_t, MmapBuffer > matrix;
+    matrix.adoptBuffers( 0, 50,
+                         MmapBuffer< std::ptrdiff_t >( offsetsPath, MmapMode::READ_WRITE ),
+                         MmapBuffer< std::ptrdiff_t >( sizesPath, MmapMode::READ_WRITE ),
+                         MmapBuffer< int >( columnsPath, MmapMode::READ_WRITE ),
+                         MmapBuffer< double >( entriesPath, MmapMode::READ_WRITE ) );
+    matrix.resize( 50, 50, 3 );
+    for( int row = 0; row < 50; ++row )
+    {
+      for( int col = std::max( row - 1, 0 ); col < std::min( row + 2, 50 ); ++col )
+      {
+        matrix.insertNonZero( row, col, row - col );
+      }
+    }
+  }
+
+  // Reopen them without copying.
+  {
+    Array< int, 2, RAJA::PERM_IJ, std::ptrdiff_t, MmapBuffer > array;
+    array.adoptBuffer( MmapBuffer< int >( arrayPath, MmapMode::READ_ONLY ), 100, 3 );
+    for( std::ptrdiff_t i = 0; i < 100; ++i )
+    {
+      for( std::ptrdiff_t j = 0; j < 3; ++j )
+      {
+        EXPECT_EQ( array( i, j ), 3 * i + j );
+      }
+    }
+
+    ArrayOfArrays< int, std::ptrdiff_t, MmapBuffer > columns;
+    columns.adoptBuffers( 50,
+                          MmapBuffer< std::ptrdiff_t >( offsetsPath, MmapMode::READ_ONLY ),
+                          MmapBuffer< std::ptrdiff_t >( sizesPath, MmapMode::READ_ONLY ),
+                          MmapBuffer< int >( columnsPath, MmapMode::READ_ONLY ) );
+
+    CRSMatrix< double, int, std::ptrdiff_t, MmapBuffer > matrix;
+    matrix.adoptBuffers( 50, 50,
+                         MmapBuffer< std::ptrdiff_t >( offsetsPath, MmapMode::COPY_ON_WRITE ),
+                         MmapBuffer< std::ptrdiff_t >( sizesPath, MmapMode::COPY_ON_WRITE ),
+                         MmapBuffer< int >( columnsPath, MmapMode::COPY_ON_WRITE ),
+                         MmapBuffer< double >( entriesPath, MmapMode::COPY_ON_WRITE ) );
+
+    EXPECT_EQ( matrix.numRows(), 50 );
+    EXPECT_EQ( matrix.numColumns(), 50 );
+    for( int row = 0; row < 50; ++row )
+    {
+      ASSERT_EQ( columns.sizeOfArray( row ), matrix.numNonZeros( row ) );
+      for( std::ptrdiff_t i = 0; i < matrix.numNonZeros( row ); ++i )
+      {
+        int const col = matrix.getColumns( row )[ i ];
+        EXPECT_EQ( columns( row, i ), col );
+        EXPECT_EQ( matrix.getEntries( row )[ i ], row - col );
+      }
+    }
+
+    // Copy on write allows modifying the matrix without changing the files.
+    matrix.insertNonZero( 0, 49, 1.0 );
+    EXPECT_EQ( matrix.numNonZeros( 0 ), 3 );
+    EXPECT_EQ( columns.sizeOfArray( 0 ), 2 );
+  }
+
+  for( std::string const & path : { arrayPath, offsetsPath, sizesPath, columnsPath, entriesPath } )
+  {
+    std::remove( path.c_str() );
+  }
+}
+
+TEST( SmallBuffer, spillAndMove )
+{
+  using ArrayT = SmallArray< std::ptrdiff_t, 1, RAJA::PERM_I, std::ptrdiff_t, 4 >;
+
+  ArrayT small;
+  for( std::ptrdiff_t i = 0; i < 4; ++i )
+  {
+    small.emplace_back( i );
+  }
+  EXPECT_EQ( small.capacity(), 4 );
+
+  // Moving an inline Array relocates the values.
+  ArrayT movedSmall( std::move( small ) );
+  EXPECT_EQ( small.size(), 0 );
+  ASSERT_EQ( movedSmall.size(), 4 );
+
+  ArrayT large( movedSmall );
+  for( std::ptrdiff_t i = 4; i < 100; ++i )
+  {
+    large.emplace_back( i );
+  }
+  EXPECT_GE( large.capacity(), 100 );
+
+  // Moving a spilled Array steals the allocation.
+  std::ptrdiff_t const * const largeData = large.data();
+  ArrayT movedLarge;
+  movedLarge = std::move( large );
+  EXPECT_EQ( movedLarge.data(), largeData );
+
+  for( std::ptrdiff_t i = 0; i < 4; ++i )
+  {
+    EXPECT_EQ( movedSmall[ i ], i );
+  }
+
+  ASSERT_EQ( movedLarge.size(), 100 );
+  for( std::ptrdiff_t i = 0; i < 100; ++i )
+  {
+    EXPECT_EQ( movedLarge[ i ], i );
+  }
+
+}
+
+TEST( SmallBuffer, shrinkInline )
+{
+  SmallBuffer< std::ptrdiff_t, 4 > buffer;
+  EXPECT_TRUE( buffer.isInline() );
+
+  for( std::ptrdiff_t i = 0; i < 10; ++i )
+  {
+    bufferManipulation::emplaceBack( buffer, i, i );
+  }
+  EXPECT_FALSE( buffer.isInline() );
+
+  // Shrinking to the inline capacity moves the values back inline.
+  bufferManipulation::setCapacity( buffer, 10, 3 );
+  EXPECT_TRUE( buffer.isInline() );
+  EXPECT_EQ( buffer.capacity(), 4 );
+
+  for( std::ptrdiff_t i = 0; i < 3; ++i )
+  {
+    EXPECT_EQ( buffer[ i ], i );
+  }
+
+  bufferManipulation::free( buffer, 3 );
+}
+
+TEST( CopyOnWriteBuffer, snapshotAndRollback )
+{
+  using ArrayT = Array< int, 2, RAJA::PERM_IJ, std::ptrdiff_t, CopyOnWriteBuffer >;
+
+  ArrayT state( 10, 10 );
+  for( int & value : state )
+  {
+    value = 1;
+  }
+
+  // Taking a snapshot shares the allocation, which becomes read only.
+  ArrayT snapshot( state );
+  EXPECT_EQ( snapshot.toViewConst().data(), state.toViewConst().data() );
+  EXPECT_EQ( snapshot.size( 0 ), 10 );
+  EXPECT_EQ( snapshot.size( 1 ), 10 );
+  EXPECT_DEATH_IF_SUPPORTED( state( 3, 4 ) = 2, "" );
+
+  // Touching the owner detaches it, the snapshot keeps the old values.
+  state.move( MemorySpace::CPU );
+  EXPECT_NE( state.toViewConst().data(), snapshot.toViewConst().data() );
+  state( 3, 4 ) = 2;
+  EXPECT_EQ( snapshot.toViewConst()( 3, 4 ), 1 );
+
+  // Rolling back shares the snapshot again.
+  state = snapshot;
+  EXPECT_EQ( snapshot.toViewConst().data(), state.toViewConst().data() );
+  EXPECT_EQ( state( 3, 4 ), 1 );
+
+  // Resizing a shared array detaches it and keeps the snapshot intact.
+  state.resize( 20, 10 );
+  state( 3, 4 ) = 3;
+  EXPECT_EQ( snapshot.size( 0 ), 10 );
+
+  for( std::ptrdiff_t i = 0; i < snapshot.size( 0 ); ++i )
+  {
+    for( std::ptrdiff_t j = 0; j < snapshot.size( 1 ); ++j )
+    {
+      EXPECT_EQ( snapshot.toViewConst()( i, j ), 1 );
+    }
+  }
+}
+
+TEST( CopyOnWriteBuffer, referenceCounting )
+{
+  CopyOnWriteBuffer< int > buffer;
+  for( int i = 0; i < 10; ++i )
+  {
+    bufferManipulation::emplaceBack( buffer, i, i );
+  }
+  EXPECT_EQ( buffer.useCount(), 1 );
+  EXPECT_FALSE( buffer.isReadOnly() );
+
+  CopyOnWriteBuffer< int > first;
+  CopyOnWriteBuffer< int > second;
+  bufferManipulation::share( first, 0, buffer );
+  bufferManipulation::share( second, 0, first );
+  EXPECT_EQ( buffer.useCount(), 3 );
+  EXPECT_TRUE( buffer.isReadOnly() );
+
+  // A shallow copy doesn't hold a reference and doesn't detach the source.
+  CopyOnWriteBuffer< int > const copy( second );
+  EXPECT_EQ( copy.useCount(), 0 );
+  EXPECT_EQ( buffer.useCount(), 3 );
+  CopyOnWriteBuffer< int > const & constBuffer = buffer;
+  EXPECT_EQ( copy.data(), constBuffer.data() );
+  EXPECT_EQ( buffer.useCount(), 3 );
+
+  // Emplacing into a shared buffer detaches it into a writable allocation.
+  bufferManipulation::emplaceBack( first, 10, 10 );
+  EXPECT_EQ( buffer.useCount(), 2 );
+  EXPECT_EQ( first.useCount(), 1 );
+  EXPECT_FALSE( first.isReadOnly() );
+  EXPECT_TRUE( buffer.isReadOnly() );
+
+  for( int i = 0; i < 10; ++i )
+  {
+    EXPECT_EQ( constBuffer[ i ], i );
+    EXPECT_EQ( first[ i ], i );
+    EXPECT_EQ( copy[ i ], i );
+  }
+
+  // Once the last other reference is released touching just makes the allocation writable again.
+  bufferManipulation::free( second, 10 );
+  EXPECT_EQ( buffer.useCount(), 1 );
+  EXPECT_TRUE( buffer.isReadOnly() );
+  buffer.registerTouch( MemorySpace::CPU );
+  EXPECT_EQ( constBuffer.data(), copy.data() );
+  EXPECT_FALSE( buffer.isReadOnly() );
+  buffer[ 0 ] = 10;
+  EXPECT_EQ( copy[ 0 ], 10 );
+
+  bufferManipulation::free( buffer, 10 );
+  bufferManipulation::free( first, 11 );
+}
+
+TEST( CopyOnWriteBuffer, constReadsDontDetach )
+{
+#if defined(USE_OPENMP)
+  using POLICY = parallelHostPolicy;
+#else
+  using POLICY = serialPolicy;
+#endif
+
+  using ArrayT = Array< int, 2, RAJA::PERM_IJ, std::ptrdiff_t, CopyOnWriteBuffer >;
+
+  ArrayT state( 64, 64 );
+  for( int & value : state )
+  {
+    value = 1;
+  }
+
+  ArrayT const snapshot( state );
+  ArrayT const & constState = state;
+  EXPECT_EQ( constState.data(), snapshot.data() );
+
+  // Concurrent reads through the const owner share the allocation with the snapshot.
+  Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, MallocBuffer > sums( constState.size( 0 ) );
+  ArrayView< int, 1, 0, std::ptrdiff_t, MallocBuffer > const & sumsView = sums.toView();
+  forall< POLICY >( constState.size( 0 ), [&constState, sumsView] ( std::ptrdiff_t const i )
+  {
+    for( std::ptrdiff_t j = 0; j < constState.size( 1 ); ++j )
+    {
+      sumsView[ i ] += constState( i, j ) + constState[ i ][ j ];
+    }
+  } );
+
+  for( std::ptrdiff_t i = 0; i < constState.size( 0 ); ++i )
+  {
+    EXPECT_EQ( sums[ i ], 2 * constState.size( 1 ) );
+  }
+
+  EXPECT_EQ( constState.data(), snapshot.data() );
+
+  // Touching the owner detaches it.
+  state.move( MemorySpace::CPU );
+  state( 0, 0 ) = 2;
+  EXPECT_NE( constState.data(), snapshot.data() );
+  EXPECT_EQ( snapshot( 0, 0 ), 1 );
+}
+
+TEST( CopyOnWriteBuffer, viewsAndSnapshots )
+{
+  using ArrayT = Array< int, 2, RAJA::PERM_IJ, std::ptrdiff_t, CopyOnWriteBuffer >;
+  using ViewT = ArrayView< int, 2, 1, std::ptrdiff_t, CopyOnWriteBuffer >;
+
+  ArrayT state( 10, 10 );
+  for( int & value : state )
+  {
+    value = 1;
+  }
+
+  // A view created before the snapshot can't change it, neither by writing nor by touching.
+  ViewT const view = state.toView();
+  ArrayT const snapshot( state );
+  EXPECT_DEATH_IF_SUPPORTED( view( 0, 0 ) = 2, "" );
+  EXPECT_DEATH_IF_SUPPORTED( view.move( MemorySpace::CPU ), "" );
+
+  // Neither can a view created after the snapshot until the owner is touched.
+  EXPECT_DEATH_IF_SUPPORTED( state.toView()( 0, 0 ) = 2, "" );
+  state.move( MemorySpace::CPU );
+  ViewT const newView = state.toView();
+  newView( 0, 0 ) = 2;
+  EXPECT_EQ( state( 0, 0 ), 2 );
+  EXPECT_EQ( snapshot( 0, 0 ), 1 );
+
+  // The old view still references the snapshot.
+  EXPECT_EQ( view.data(), snapshot.data() );
+  EXPECT_DEATH_IF_SUPPORTED( view( 0, 0 ) = 2, "" );
+
+  // Once the snapshot is released a view can be touched, it just makes the allocation writable again.
+  {
+    ArrayT const laterSnapshot( state );
+  }
+
+  EXPECT_DEATH_IF_SUPPORTED( newView( 1, 1 ) = 3, "" );
+  newView.move( MemorySpace::CPU );
+  EXPECT_EQ( newView.data(), state.data() );
+  newView( 1, 1 ) = 3;
+  EXPECT_EQ( state( 1, 1 ), 3 );
+  EXPECT_EQ( snapshot( 1, 1 ), 1 );
+}
+
+TEST( CopyOnWriteBuffer, sparseSnapshots )
+{
+  using MatrixT = CRSMatrix< double, int, std::ptrdiff_t, CopyOnWriteBuffer >;
+
+  MatrixT matrix( 10, 10, 3 );
+  for( int row = 0; row < 10; ++row )
+  {
+    matrix.insertNonZero( row, row, 1.0 );
+  }
+
+  // Taking a snapshot shares the columns and the entries.
+  MatrixT snapshot( matrix );
+  EXPECT_EQ( snapshot.getColumns( 0 ).dataIfContiguous(), matrix.getColumns( 0 ).dataIfContiguous() );
+  EXPECT_EQ( snapshot.getEntries( 0 ).dataIfContiguous(), matrix.getEntries( 0 ).dataIfContiguous() );
+  EXPECT_DEATH_IF_SUPPORTED( matrix.getEntries( 0 )[ 0 ] = 2.0, "" );
+  EXPECT_DEATH_IF_SUPPORTED( matrix.insertNonZero( 0, 1, 2.0 ), "" );
+
+  // Touching the matrix detaches it, the snapshot keeps the old values.
+  matrix.move( MemorySpace::CPU );
+  matrix.getEntries( 0 )[ 0 ] = 2.0;
+  matrix.insertNonZero( 0, 1, 2.0 );
+  EXPECT_EQ( matrix.numNonZeros( 0 ), 2 );
+  EXPECT_EQ( snapshot.numNonZeros( 0 ), 1 );
+  EXPECT_EQ( snapshot.getEntries( 0 )[ 0 ], 1.0 );
+
+  // Rolling back shares the snapshot again.
+  matrix = snapshot;
+  EXPECT_EQ( snapshot.getEntries( 0 ).dataIfContiguous(), matrix.getEntries( 0 ).dataIfContiguous() );
+  EXPECT_EQ( matrix.numNonZeros( 0 ), 1 );
+  EXPECT_EQ( matrix.getEntries( 0 )[ 0 ], 1.0 );
+}
+
+TEST( GrowthPolicy, grow )
+{
+  using bufferManipulation::GrowthPolicy;
+
+  EXPECT_EQ( GrowthPolicy::doubling().grow( 10, sizeof( int ) ), 20 );
+  EXPECT_EQ( GrowthPolicy::oneAndAHalf().grow( 10, sizeof( int ) ), 15 );
+
+  // Small buffers grow geometrically in whole pages.
+  GrowthPolicy const paged = GrowthPolicy::pageGeometric( 4 * 4096, 4096 );
+  EXPECT_EQ( paged.grow( 1000, sizeof( double ) ), 1536 );
+  EXPECT_EQ( paged.grow( 1, sizeof( double ) ), 512 );
+
+  // Large buffers grow by at most the overshoot, rounded up to a page.
+  std::ptrdiff_t const large = 1000000;
+  std::ptrdiff_t const grown = paged.grow( large, sizeof( double ) );
+  EXPECT_GE( grown, large );
+  EXPECT_LE( ( grown - large ) * sizeof( double ), 4 * 4096 + 4096 );
+  EXPECT_EQ( grown * sizeof( double ) % 4096, 0 );
+}
+
+TEST( GrowthPolicy, dynamicReserve )
+{
+  using bufferManipulation::GrowthPolicy;
+
+  MallocBuffer< int > buffer( true );
+  bufferManipulation::dynamicReserve( buffer, 0, 100, GrowthPolicy::oneAndAHalf() );
+  EXPECT_EQ( buffer.capacity(), 150 );
+  bufferManipulation::free( buffer, 0 );
+
+  // The process wide policy is used by the containers.
+  bufferManipulation::setGrowthPolicy( GrowthPolicy::oneAndAHalf() );
+  EXPECT_EQ( bufferManipulation::getGrowthPolicy().percent, 150 );
+
+  Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, MallocBuffer > array;
+  for( int i = 0; i < 100; ++i )
+  {
+    array.emplace_back( i );
+    EXPECT_LE( array.capacity(), std::max( 3 * array.size() / 2, std::ptrdiff_t( 1 ) ) );
+  }
+
+  bufferManipulation::setGrowthPolicy( GrowthPolicy::doubling() );
+  EXPECT_EQ( bufferManipulation::getGrowthPolicy().percent, 200 );
+
+  array.shrinkToFit();
+  EXPECT_EQ( array.capacity(), 100 );
+  for( int i = 0; i < 100; ++i )
+  {
+    EXPECT_EQ( array[ i ], i );
+  }
+}
+
+template< typename POLICY >
+void testCopyInto()
+{
+  // Large enough to be copied in several chunks.
+  std::ptrdiff_t const size = 3 * bufferManipulation::PARALLEL_COPY_CHUNK_BYTES / std::ptrdiff_t( sizeof( double ) ) + 7;
+
+  Array< double, 2, RAJA::PERM_IJ, std::ptrdiff_t, MallocBuffer > src( size, 2 );
+  for( std::ptrdiff_t i = 0; i < size; ++i )
+  {
+    src( i, 0 ) = i;
+    src( i, 1 ) = -i;
+  }
+
+  Array< double, 2, RAJA::PERM_IJ, std::ptrdiff_t, MallocBuffer > dst( 10, 2 );
+  dst.template copyFrom< POLICY >( src );
+  ASSERT_EQ( dst.size( 0 ), size );
+  ASSERT_EQ( dst.size( 1 ), 2 );
+  ASSERT_NE( dst.data(), src.data() );
+  for( std::ptrdiff_t i = 0; i < size; ++i )
+  {
+    EXPECT_EQ( dst( i, 0 ), i );
+    EXPECT_EQ( dst( i, 1 ), -i );
+  }
+
+  // Values that aren't trivially copyable are copy assigned.
+  Array< std::string, 1, RAJA::PERM_I, std::ptrdiff_t, MallocBuffer > strings( 100 );
+  for( std::ptrdiff_t i = 0; i < strings.size(); ++i )
+  {
+    strings[ i ] = std::to_string( i );
+  }
+
+  Array< std::string, 1, RAJA::PERM_I, std::ptrdiff_t, MallocBuffer > stringsCopy( 3 );
+  stringsCopy.template copyFrom< POLICY >( strings );
+  ASSERT_EQ( stringsCopy.size(), strings.size() );
+  for( std::ptrdiff_t i = 0; i < strings.size(); ++i )
+  {
+    EXPECT_EQ( stringsCopy[ i ], strings[ i ] );
+  }
+}
+
+TEST( CopyInto, serial )
+{
+  testCopyInto< serialPolicy >();
+}
+
+#if defined(USE_OPENMP)
+TEST( CopyInto, parallel )
+{
+  testCopyInto< parallelHostPolicy >();
+}
+#endif
+
+TEST( AllocationRegistry, accounting )
+{
+  // Buffers named while the registry is disabled aren't tracked.
+  {
+    Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, MallocBuffer > array;
+    array.setName( "registry/untracked" );
+    array.resize( 100 );
+  }
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/untracked" ).peakBytes, 0 );
+
+  allocationRegistry::enable();
+  EXPECT_TRUE( allocationRegistry::isEnabled() );
+
+  {
+    // The existing allocation moves to the new name.
+    Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, MallocBuffer > array( 10 );
+    array.setName( "registry/array" );
+
+    allocationRegistry::Record record = allocationRegistry::getRecord( "registry/array" );
+    EXPECT_EQ( record.numAllocations, 1 );
+    EXPECT_EQ( record.capacityBytes, 10 * sizeof( int ) );
+    EXPECT_EQ( record.currentBytes, 10 * sizeof( int ) );
+
+    // Reserving space changes the capacity but not the usage.
+    array.reserve( 1000 );
+    record = allocationRegistry::getRecord( "registry/array" );
+    EXPECT_EQ( record.capacityBytes, 1000 * sizeof( int ) );
+    EXPECT_EQ( record.currentBytes, 10 * sizeof( int ) );
+
+    array.resize( 20 );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/array" ).currentBytes, 20 * sizeof( int ) );
+    array.shrinkToFit();
+
+    record = allocationRegistry::getRecord( "registry/array" );
+    EXPECT_EQ( record.numAllocations, 1 );
+    EXPECT_EQ( record.capacityBytes, 20 * sizeof( int ) );
+    EXPECT_EQ( record.currentBytes, 20 * sizeof( int ) );
+    EXPECT_EQ( record.peakBytes, 1000 * sizeof( int ) );
+    EXPECT_EQ( record.numReallocations, 2 );
+    EXPECT_LE( record.bytesMoved, 30 * sizeof( int ) );
+
+    ArrayOfArrays< int, std::ptrdiff_t, MallocBuffer > arrayOfArrays( 5, 4 );
+    arrayOfArrays.setName( "registry/arrayOfArrays" );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/arrayOfArrays/m_values" ).capacityBytes, 20 * sizeof( int ) );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/arrayOfArrays/m_sizes" ).capacityBytes, 5 * sizeof( std::ptrdiff_t ) );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/arrayOfArrays/m_sizes" ).currentBytes, 5 * sizeof( std::ptrdiff_t ) );
+
+    // Values in use are those within the extent of the arrays.
+    arrayOfArrays.reserveValues( 100 );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/arrayOfArrays/m_values" ).capacityBytes, 100 * sizeof( int ) );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/arrayOfArrays/m_values" ).currentBytes, 20 * sizeof( int ) );
+
+    std::string const report = allocationRegistry::report();
+    EXPECT_NE( report.find( "registry/array" ), std::string::npos );
+    EXPECT_NE( report.find( "registry/arrayOfArrays/m_offsets" ), std::string::npos );
+    EXPECT_NE( report.find( "capacity" ), std::string::npos );
+  }
+
+  allocationRegistry::Record record = allocationRegistry::getRecord( "registry/array" );
+  EXPECT_EQ( record.numAllocations, 0 );
+  EXPECT_EQ( record.capacityBytes, 0 );
+  EXPECT_EQ( record.currentBytes, 0 );
+  EXPECT_EQ( record.peakBytes, 1000 * sizeof( int ) );
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/arrayOfArrays/m_values" ).capacityBytes, 0 );
+
+  allocationRegistry::reset();
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/array" ).peakBytes, 0 );
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/array" ).numReallocations, 0 );
+
+  allocationRegistry::disable();
+  EXPECT_FALSE( allocationRegistry::isEnabled() );
+}
+
+TEST( AllocationRegistry, bulkOperationsKeepTheRecord )
+{
+  allocationRegistry::enable();
+
+  {
+    ArrayOfArrays< int, std::ptrdiff_t, MallocBuffer > arrayOfArrays( 100, 10 );
+    arrayOfArrays.setName( "registry/bulk/arrayOfArrays" );
+    std::size_t const offsetsBytes = allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_offsets" ).capacityBytes;
+    EXPECT_EQ( offsetsBytes, 101 * sizeof( std::ptrdiff_t ) );
+
+    std::vector< std::ptrdiff_t > arrays( 50 );
+    std::vector< std::ptrdiff_t > capacities( 50 );
+    for( std::ptrdiff_t i = 0; i < 50; ++i )
+    {
+      arrays[ i ] = 2 * i;
+      capacities[ i ] = 20;
+    }
+
+    arrayOfArrays.setCapacitiesOfArrays( 50, arrays.data(), capacities.data() );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_offsets" ).capacityBytes, offsetsBytes );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_values" ).capacityBytes,
+               arrayOfArrays.valueCapacity() * sizeof( int ) );
+
+    for( std::ptrdiff_t i = 0; i < arrayOfArrays.size(); ++i )
+    {
+      arrayOfArrays.emplaceBack( i, int( i ) );
+    }
+
+    std::size_t const valuesBytes = allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_values" ).capacityBytes;
+    arrayOfArrays.compress< serialPolicy >();
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_offsets" ).capacityBytes, offsetsBytes );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_values" ).capacityBytes, valuesBytes );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_values" ).currentBytes, 100 * sizeof( int ) );
+    for( std::ptrdiff_t i = 0; i < arrayOfArrays.size(); ++i )
+    {
+      ASSERT_EQ( arrayOfArrays.sizeOfArray( i ), 1 );
+      EXPECT_EQ( arrayOfArrays( i, 0 ), i );
+    }
+
+    // Memory allocated after compressing is still tracked.
+    arrayOfArrays.reserveValues( 2 * valuesBytes / sizeof( int ) );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_values" ).capacityBytes, 2 * valuesBytes );
+
+    // Resizing a default dimension that isn't first in memory.
+    Array< std::string, 2, RAJA::PERM_JI, std::ptrdiff_t, MallocBuffer > array( 10, 4 );
+    array.setName( "registry/bulk/array" );
+
+    array.resize( 20 );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/array" ).capacityBytes, array.capacity() * sizeof( std::string ) );
+
+    array.resizeDefault< serialPolicy >( 40, "a" );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/array" ).capacityBytes, array.capacity() * sizeof( std::string ) );
+    EXPECT_EQ( array( 39, 3 ), "a" );
+
+    array.resizeDefault< serialPolicy >( 5, "b" );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/array" ).capacityBytes, array.capacity() * sizeof( std::string ) );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/array" ).currentBytes, array.size() * sizeof( std::string ) );
+  }
+
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_offsets" ).capacityBytes, 0 );
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/arrayOfArrays/m_values" ).capacityBytes, 0 );
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/array" ).capacityBytes, 0 );
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/bulk/array" ).currentBytes, 0 );
+
+  allocationRegistry::reset();
+  allocationRegistry::disable();
+}
+
+template< template< typename > class BUFFER_TYPE >
+void testRegistryTracksBuffer( std::string const & name )
+{
+  SCOPED_TRACE( name );
+
+  {
+    Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, BUFFER_TYPE > array( 10 );
+    array.setName( name );
+
+    allocationRegistry::Record record = allocationRegistry::getRecord( name );
+    EXPECT_EQ( record.numAllocations, 1 );
+    EXPECT_GE( record.capacityBytes, 10 * sizeof( int ) );
+    EXPECT_EQ( record.currentBytes, 10 * sizeof( int ) );
+
+    array.resize( 1000 );
+    record = allocationRegistry::getRecord( name );
+    EXPECT_EQ( record.numAllocations, 1 );
+    EXPECT_GE( record.capacityBytes, 1000 * sizeof( int ) );
+    EXPECT_EQ( record.currentBytes, 1000 * sizeof( int ) );
+    EXPECT_GE( record.numReallocations, 1 );
+
+    array.clear();
+    EXPECT_EQ( allocationRegistry::getRecord( name ).currentBytes, 0 );
+  }
+
+  allocationRegistry::Record const record = allocationRegistry::getRecord( name );
+  EXPECT_EQ( record.numAllocations, 0 );
+  EXPECT_EQ( record.capacityBytes, 0 );
+  EXPECT_EQ( record.currentBytes, 0 );
+  EXPECT_GE( record.peakBytes, 1000 * sizeof( int ) );
+}
+
+template< typename T >
+using SmallBuffer4 = SmallBuffer< T, 4 >;
+
+TEST( AllocationRegistry, everyHeapBuffer )
+{
+  allocationRegistry::enable();
+
+  testRegistryTracksBuffer< MallocBuffer >( "registry/buffers/MallocBuffer" );
+  testRegistryTracksBuffer< PoolBuffer >( "registry/buffers/PoolBuffer" );
+  testRegistryTracksBuffer< CacheLineAlignedBuffer >( "registry/buffers/CacheLineAlignedBuffer" );
+  testRegistryTracksBuffer< MmapBuffer >( "registry/buffers/MmapBuffer" );
+  testRegistryTracksBuffer< SmallBuffer4 >( "registry/buffers/SmallBuffer" );
+  testRegistryTracksBuffer< CopyOnWriteBuffer >( "registry/buffers/CopyOnWriteBuffer" );
+
+  // A SmallBuffer only accounts for memory once it spills to the heap.
+  {
+    Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, SmallBuffer4 > array( 4 );
+    array.setName( "registry/buffers/inline" );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/buffers/inline" ).numAllocations, 0 );
+    EXPECT_EQ( allocationRegistry::getRecord( "registry/buffers/inline" ).capacityBytes, 0 );
+  }
+
+  allocationRegistry::reset();
+  allocationRegistry::disable();
+}
+
+TEST( AllocationRegistry, copyOnWriteSnapshots )
+{
+  allocationRegistry::enable();
+
+  {
+    Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, CopyOnWriteBuffer > array( 1000 );
+    array.setName( "registry/cow/array" );
+    std::size_t const capacityBytes = allocationRegistry::getRecord( "registry/cow/array" ).capacityBytes;
+    EXPECT_GE( capacityBytes, 1000 * sizeof( int ) );
+
+    {
+      // Taking a snapshot shares the allocation without charging for it again.
+      Array< int, 1, RAJA::PERM_I, std::ptrdiff_t, CopyOnWriteBuffer > snapshot( array );
+      allocationRegistry::Record record = allocationRegistry::getRecord( "registry/cow/array" );
+      EXPECT_EQ( record.numAllocations, 1 );
+      EXPECT_EQ( record.capacityBytes, capacityBytes );
+
+      // Writing to the shared allocation detaches a private copy.
+      array.emplace_back( 5 );
+      record = allocationRegistry::getRecord( "registry/cow/array" );
+      EXPECT_EQ( record.numAllocations, 2 );
+      EXPECT_GE( record.capacityBytes, capacityBytes + 1001 * sizeof( int ) );
+    }
+
+    // Releasing the snapshot frees the original allocation.
+    allocationRegistry::Record const record = allocationRegistry::getRecord( "registry/cow/array" );
+    EXPECT_EQ( record.numAllocations, 1 );
+    EXPECT_GE( record.capacityBytes, 1001 * sizeof( int ) );
+    EXPECT_EQ( record.currentBytes, 1001 * sizeof( int ) );
+  }
+
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/cow/array" ).numAllocations, 0 );
+  EXPECT_EQ( allocationRegistry::getRecord( "registry/cow/array" ).capacityBytes, 0 );
+
+  allocationRegistry::reset();
+  allocationRegistry::disable();
+}
 
 // TODO:
 // BufferTestNoRealloc on device with StackBuffer + MallocBuffer
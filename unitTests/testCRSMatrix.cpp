@@ -248,6 +248,49 @@ public:
     COMPARE_TO_REFERENCE
   }
 
+  /**
+   * @brief Test the setRowCapacities method of CRSMatrix.
+   */
+  void rowCapacitiesTest()
+  {
+    INDEX_TYPE const numRows = m_matrix.numRows();
+    ASSERT_EQ( numRows, m_ref.size());
+
+    // Change every other row starting from the back, the new capacity will be the index of the row.
+    std::vector< INDEX_TYPE > rows;
+    for( INDEX_TYPE row = numRows - 1; row >= 0; row -= 2 )
+    {
+      rows.push_back( row );
+    }
+
+    m_matrix.setRowCapacities( rows.size(), rows.data(), rows.data() );
+
+    for( INDEX_TYPE const row : rows )
+    {
+      INDEX_TYPE const rowNNZ = m_ref[row].size();
+      INDEX_TYPE const new_capacity = row;
+      if( new_capacity < rowNNZ )
+      {
+        // Erase the last entries from the reference.
+        auto erase_pos = m_ref[row].end();
+        std::advance( erase_pos, -( rowNNZ - new_capacity ) );
+        m_ref[row].erase( erase_pos, m_ref[row].end());
+      }
+
+      ASSERT_EQ( m_matrix.nonZeroCapacity( row ), std::min( new_capacity, INDEX_TYPE( m_matrix.numColumns() ) ) );
+      ASSERT_EQ( m_matrix.numNonZeros( row ), m_ref[row].size());
+    }
+
+    COMPARE_TO_REFERENCE
+
+    for( INDEX_TYPE const row : rows )
+    {
+      fillRow( row );
+    }
+
+    COMPARE_TO_REFERENCE
+  }
+
   /**
    * @brief Test the copy constructor of the CRSMatrix.
    */
@@ -385,10 +428,49 @@ public:
     COMPARE_TO_REFERENCE
   }
 
+  template< typename POLICY >
+  void copyFrom()
+  {
+    CRS_MATRIX copy( 3, 3, 2 );
+    copy.template copyFrom< POLICY >( m_matrix );
+    compareToReference( copy.toViewConst() );
+
+    // Once compressed the columns and entries are copied all at once.
+    m_matrix.compress();
+    copy.template copyFrom< POLICY >( m_matrix );
+    compareToReference( copy.toViewConst() );
+    EXPECT_EQ( copy.numColumns(), m_matrix.numColumns() );
+  }
+
+  void shrinkToFit()
+  {
+    m_matrix.shrinkToFit();
+
+    for( INDEX_TYPE row = 0; row < m_matrix.numRows(); ++row )
+    {
+      EXPECT_EQ( m_matrix.numNonZeros( row ), m_matrix.nonZeroCapacity( row ));
+    }
+
+    EXPECT_EQ( m_matrix.nonZeroCapacity(), m_matrix.numNonZeros() );
+
+    COMPARE_TO_REFERENCE
+  }
+
   void compress()
   {
     m_matrix.compress();
+    checkCompressed();
+  }
 
+  template< typename POLICY >
+  void compress()
+  {
+    m_matrix.template compress< POLICY >();
+    checkCompressed();
+  }
+
+  void checkCompressed()
+  {
     T const * const entries = m_matrix.getEntries( 0 );
     COL_TYPE const * const columns = m_matrix.getColumns( 0 );
     INDEX_TYPE const * const offsets = m_matrix.getOffsets();
@@ -634,6 +716,14 @@ TYPED_TEST( CRSMatrixTest, rowCapacity )
   this->rowCapacityTest( DEFAULT_MAX_INSERTS );
 }
 
+TYPED_TEST( CRSMatrixTest, rowCapacities )
+{
+  this->resize( DEFAULT_NROWS, DEFAULT_NCOLS );
+  this->insert( DEFAULT_MAX_INSERTS );
+  this->rowCapacitiesTest();
+  this->insert( DEFAULT_MAX_INSERTS );
+}
+
 TYPED_TEST( CRSMatrixTest, deepCopy )
 {
   this->resize( DEFAULT_NROWS, DEFAULT_NCOLS );
@@ -662,6 +752,39 @@ TYPED_TEST( CRSMatrixTest, compress )
   this->compress();
 }
 
+TYPED_TEST( CRSMatrixTest, compressWithPolicy )
+{
+  this->resize( DEFAULT_NROWS, DEFAULT_NCOLS );
+  this->insert( DEFAULT_MAX_INSERTS );
+  this->template compress< serialPolicy >();
+
+#if defined(USE_OPENMP)
+  this->insert( DEFAULT_MAX_INSERTS );
+  this->template compress< parallelHostPolicy >();
+#endif
+}
+
+TYPED_TEST( CRSMatrixTest, copyFrom )
+{
+  this->resize( DEFAULT_NROWS, DEFAULT_NCOLS );
+  this->insert( DEFAULT_MAX_INSERTS );
+  this->template copyFrom< serialPolicy >();
+
+#if defined(USE_OPENMP)
+  this->insert( DEFAULT_MAX_INSERTS );
+  this->template copyFrom< parallelHostPolicy >();
+#endif
+}
+
+TYPED_TEST( CRSMatrixTest, shrinkToFit )
+{
+  this->resize( DEFAULT_NROWS, DEFAULT_NCOLS );
+  this->insert( DEFAULT_MAX_INSERTS );
+  this->shrinkToFit();
+  this->insert( DEFAULT_MAX_INSERTS );
+  this->shrinkToFit();
+}
+
 template< typename CRS_MATRIX_POLICY_PAIR >
 class CRSMatrixViewTest : public CRSMatrixTest< typename CRS_MATRIX_POLICY_PAIR::first_type >
 {
@@ -170,5 +170,31 @@ TEST( Permutation, AsArray )
   }
 }
 
+TEST( Permutation, StaticStrides )
+{
+  using DYNAMIC_3 = DynamicExtents< 3 >;
+  static_assert( std::is_same< StaticStrides< RAJA::PERM_IJK, DYNAMIC_3 >, DynamicStrides< 3 > >::value, "Should be true." );
+  static_assert( std::is_same< StaticStrides< RAJA::PERM_KJI, DYNAMIC_3 >, DynamicStrides< 3 > >::value, "Should be true." );
+
+  using MATRICES = Extents< DYNAMIC_EXTENT, 3, 4 >;
+  static_assert( isValidExtents( RAJA::PERM_IJK {}, MATRICES {} ), "Should be true." );
+  static_assert( !isValidExtents( RAJA::PERM_IJ {}, MATRICES {} ), "Should be false." );
+  static_assert( !isValidExtents( RAJA::PERM_IJK {}, Extents< 2, -2, 3 > {} ), "Should be false." );
+
+  static_assert( std::is_same< StaticStrides< RAJA::PERM_IJK, MATRICES >,
+                               camp::idx_seq< 12, 4, DYNAMIC_EXTENT > >::value, "Should be true." );
+  static_assert( std::is_same< StaticStrides< RAJA::PERM_KJI, MATRICES >,
+                               camp::idx_seq< DYNAMIC_EXTENT, DYNAMIC_EXTENT, DYNAMIC_EXTENT > >::value, "Should be true." );
+  static_assert( std::is_same< StaticStrides< RAJA::PERM_JIK, MATRICES >,
+                               camp::idx_seq< 4, DYNAMIC_EXTENT, DYNAMIC_EXTENT > >::value, "Should be true." );
+  static_assert( std::is_same< StaticStrides< RAJA::PERM_KIJ, Extents< 2, DYNAMIC_EXTENT, 5 > >,
+                               camp::idx_seq< DYNAMIC_EXTENT, DYNAMIC_EXTENT, DYNAMIC_EXTENT > >::value, "Should be true." );
+  static_assert( std::is_same< StaticStrides< RAJA::PERM_JKI, Extents< 2, DYNAMIC_EXTENT, 5 > >,
+                               camp::idx_seq< DYNAMIC_EXTENT, 10, 2 > >::value, "Should be true." );
+
+  static_assert( std::is_same< PopFront< camp::idx_seq< 12, 4, DYNAMIC_EXTENT > >,
+                               camp::idx_seq< 4, DYNAMIC_EXTENT > >::value, "Should be true." );
+}
+
 } // namespace testing
 } // namespace LvArray
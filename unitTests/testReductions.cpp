@@ -0,0 +1,283 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "reductions.hpp"
+#include "Array.hpp"
+#include "testUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace LvArray
+{
+namespace testing
+{
+
+using INDEX_TYPE = std::ptrdiff_t;
+
+template< typename T, typename PERMUTATION >
+using ArrayT = Array< T, getDimension( PERMUTATION {} ), PERMUTATION, INDEX_TYPE, DEFAULT_BUFFER >;
+
+template< typename POLICY_AND_ARRAY >
+class ReductionsTest : public ::testing::Test
+{
+public:
+  using POLICY = std::tuple_element_t< 0, POLICY_AND_ARRAY >;
+  using ARRAY = std::tuple_element_t< 1, POLICY_AND_ARRAY >;
+  using T = typename ARRAY::value_type;
+  static constexpr int NDIM = ARRAY::ndim;
+
+  void SetUp() override
+  {
+    // Large enough that a contiguous array is split into several chunks.
+    INDEX_TYPE dims[ NDIM ];
+    INDEX_TYPE innerSize = 1;
+    for( int dim = 1; dim < NDIM; ++dim )
+    {
+      dims[ dim ] = 3 + dim;
+      innerSize *= dims[ dim ];
+    }
+    dims[ 0 ] = 100000 / innerSize;
+
+    m_array.resize( NDIM, dims );
+    m_other.resize( NDIM, dims );
+
+    std::mt19937_64 gen( 0 );
+    std::uniform_int_distribution< int > dis( -1000, 1000 );
+    forValuesInSlice( m_array.toSlice(), [&]( T & value )
+    {
+      value = dis( gen );
+    } );
+
+    forValuesInSlice( m_other.toSlice(), [&]( T & value )
+    {
+      value = dis( gen );
+    } );
+  }
+
+  template< typename SLICE >
+  void checkAll( SLICE const & slice )
+  {
+    T expectedSum = 0;
+    T expectedMin = std::numeric_limits< T >::max();
+    T expectedMax = std::numeric_limits< T >::lowest();
+    T expectedL1 = 0;
+    T expectedL2 = 0;
+    forValuesInSlice( slice, [&]( T const & value )
+    {
+      expectedSum += value;
+      expectedMin = std::min( expectedMin, value );
+      expectedMax = std::max( expectedMax, value );
+      expectedL1 += std::abs( value );
+      expectedL2 += value * value;
+    } );
+
+    EXPECT_EQ( reductions::sum< POLICY >( slice ), expectedSum );
+    EXPECT_EQ( reductions::min< POLICY >( slice ), expectedMin );
+    EXPECT_EQ( reductions::max< POLICY >( slice ), expectedMax );
+    EXPECT_EQ( reductions::l1Norm< POLICY >( slice ), expectedL1 );
+    EXPECT_EQ( reductions::infNorm< POLICY >( slice ), std::max( std::abs( expectedMin ), std::abs( expectedMax ) ) );
+    EXPECT_EQ( reductions::l2Norm< POLICY >( slice ), std::sqrt( expectedL2 ) );
+  }
+
+  void wholeArray()
+  {
+    checkAll( m_array.toSliceConst() );
+
+    // The Array and ArrayView overloads.
+    EXPECT_EQ( reductions::sum< POLICY >( m_array ), reductions::sum< POLICY >( m_array.toSliceConst() ) );
+    EXPECT_EQ( reductions::max< POLICY >( m_array.toViewConst() ), reductions::max< POLICY >( m_array.toSliceConst() ) );
+  }
+
+  void subRanges()
+  {
+    // Not contiguous unless the last dimension is the largest stride dimension.
+    auto const lastDimension = m_array.template subRange< NDIM - 1 >( 1, m_array.size( NDIM - 1 ) );
+    checkAll( lastDimension.toSlice() );
+
+    // Strided along the unit stride dimension, so there is no unit stride dimension.
+    auto const strided = m_array.template subRange< ARRAY::USD >( 0, m_array.size( ARRAY::USD ), 2 );
+    checkAll( strided.toSlice() );
+
+    // A slice of the first index.
+    checkFirstIndex();
+  }
+
+  template< int _NDIM=NDIM >
+  std::enable_if_t< _NDIM == 1 >
+  checkFirstIndex()
+  {}
+
+  template< int _NDIM=NDIM >
+  std::enable_if_t< ( _NDIM > 1 ) >
+  checkFirstIndex()
+  { checkAll( m_array[ 1 ] ); }
+
+  void dot()
+  {
+    T expected = 0;
+    forValuesInSliceWithIndices( m_array.toSliceConst(), [&]( T const & value, auto const ... indices )
+    {
+      expected += value * m_other( indices ... );
+    } );
+
+    EXPECT_EQ( reductions::dot< POLICY >( m_array, m_other ), expected );
+    EXPECT_EQ( reductions::dot< POLICY >( m_other.toSliceConst(), m_array.toSliceConst() ), expected );
+
+  }
+
+protected:
+  ARRAY m_array;
+  ARRAY m_other;
+};
+
+using ReductionsTestTypes = ::testing::Types<
+  std::tuple< serialPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_I > >
+  , std::tuple< serialPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_IJ > >
+  , std::tuple< serialPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_JI > >
+  , std::tuple< serialPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_IJK > >
+  , std::tuple< serialPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_KJI > >
+  , std::tuple< serialPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_JIK > >
+  , std::tuple< serialPolicy, ArrayT< double, RAJA::PERM_IJK > >
+#if defined(USE_OPENMP)
+  , std::tuple< parallelHostPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_I > >
+  , std::tuple< parallelHostPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_JI > >
+  , std::tuple< parallelHostPolicy, ArrayT< INDEX_TYPE, RAJA::PERM_KJI > >
+  , std::tuple< parallelHostPolicy, ArrayT< double, RAJA::PERM_IJK > >
+#endif
+  >;
+
+TYPED_TEST_SUITE( ReductionsTest, ReductionsTestTypes, );
+
+TYPED_TEST( ReductionsTest, wholeArray )
+{
+  this->wholeArray();
+}
+
+TYPED_TEST( ReductionsTest, subRanges )
+{
+  this->subRanges();
+}
+
+TYPED_TEST( ReductionsTest, dot )
+{
+  this->dot();
+}
+
+TEST( Reductions, dotMixedLayouts )
+{
+  ArrayT< INDEX_TYPE, RAJA::PERM_IJK > a( 7, 5, 3 );
+  ArrayT< INDEX_TYPE, RAJA::PERM_KJI > b( 7, 5, 3 );
+  ArrayT< INDEX_TYPE, RAJA::PERM_JIK > c( 7, 5, 3 );
+
+  INDEX_TYPE expected = 0;
+  forValuesInSliceWithIndices( a.toSlice(), [&]( INDEX_TYPE & value, INDEX_TYPE const i, INDEX_TYPE const j, INDEX_TYPE const k )
+  {
+    value = i - 2 * j + 3 * k;
+    b( i, j, k ) = 1 + i * j - k;
+    c( i, j, k ) = b( i, j, k );
+    expected += a( i, j, k ) * b( i, j, k );
+  } );
+
+  EXPECT_EQ( reductions::dot( a, b ), expected );
+  EXPECT_EQ( reductions::dot( b, a ), expected );
+  EXPECT_EQ( reductions::dot( a, c ), expected );
+  EXPECT_EQ( reductions::dot( c, a ), expected );
+}
+
+TEST( Reductions, minMaxLoc )
+{
+  ArrayT< double, RAJA::PERM_I > array( 3 * reductions::internal::CHUNK_SIZE + 11 );
+  for( INDEX_TYPE i = 0; i < array.size(); ++i )
+  {
+    array[ i ] = std::sin( double( i ) );
+  }
+
+  INDEX_TYPE const expectedMin = std::min_element( array.begin(), array.end() ) - array.begin();
+  INDEX_TYPE const expectedMax = std::max_element( array.begin(), array.end() ) - array.begin();
+  EXPECT_EQ( reductions::minLoc( array ), expectedMin );
+  EXPECT_EQ( reductions::maxLoc( array ), expectedMax );
+
+  // Ties go to the first occurrence.
+  array[ 2 * reductions::internal::CHUNK_SIZE + 1 ] = -5;
+  array[ 2 * reductions::internal::CHUNK_SIZE + 5 ] = -5;
+  array[ 7 ] = 5;
+  array[ array.size() - 1 ] = 5;
+  EXPECT_EQ( reductions::minLoc( array.toSliceConst() ), 2 * reductions::internal::CHUNK_SIZE + 1 );
+  EXPECT_EQ( reductions::maxLoc( array.toViewConst() ), 7 );
+
+#if defined(USE_OPENMP)
+  EXPECT_EQ( reductions::minLoc< parallelHostPolicy >( array ), 2 * reductions::internal::CHUNK_SIZE + 1 );
+  EXPECT_EQ( reductions::maxLoc< parallelHostPolicy >( array ), 7 );
+#endif
+}
+
+TEST( Reductions, infinities )
+{
+  double const inf = std::numeric_limits< double >::infinity();
+
+  // Several chunks of a contiguous array.
+  ArrayT< double, RAJA::PERM_I > array( 2 * reductions::internal::CHUNK_SIZE + 3 );
+  array = inf;
+  EXPECT_EQ( reductions::min( array ), inf );
+  EXPECT_EQ( reductions::minLoc( array ), 0 );
+  EXPECT_EQ( reductions::maxLoc( array ), 0 );
+
+  array = -inf;
+  EXPECT_EQ( reductions::max( array ), -inf );
+  EXPECT_EQ( reductions::minLoc( array ), 0 );
+  EXPECT_EQ( reductions::maxLoc( array ), 0 );
+
+#if defined(USE_OPENMP)
+  EXPECT_EQ( reductions::max< parallelHostPolicy >( array ), -inf );
+  EXPECT_EQ( reductions::maxLoc< parallelHostPolicy >( array ), 0 );
+#endif
+
+  // The rows of a non contiguous slice.
+  ArrayT< double, RAJA::PERM_JI > matrix( 5, 7 );
+  auto const rows = matrix.subRange< 0 >( 1, 4 );
+  matrix = inf;
+  EXPECT_EQ( reductions::min( rows.toSlice() ), inf );
+
+  matrix = -inf;
+  EXPECT_EQ( reductions::max( rows.toSlice() ), -inf );
+}
+
+TEST( Reductions, empty )
+{
+  ArrayT< double, RAJA::PERM_IJ > array( 0, 4 );
+  EXPECT_EQ( reductions::sum( array ), 0 );
+  EXPECT_EQ( reductions::l2Norm( array ), 0 );
+  EXPECT_EQ( reductions::infNorm( array ), 0 );
+  EXPECT_EQ( reductions::min( array ), std::numeric_limits< double >::infinity() );
+  EXPECT_EQ( reductions::max( array ), -std::numeric_limits< double >::infinity() );
+  EXPECT_EQ( reductions::dot( array, array ), 0 );
+
+  ArrayT< double, RAJA::PERM_I > empty;
+  EXPECT_EQ( reductions::minLoc( empty ), -1 );
+  EXPECT_EQ( reductions::maxLoc( empty ), -1 );
+}
+
+} // namespace testing
+} // namespace LvArray
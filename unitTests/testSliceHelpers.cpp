@@ -23,6 +23,9 @@
 // TPL inclues
 #include <gtest/gtest.h>
 
+// System includes
+#include <array>
+
 namespace LvArray
 {
 namespace testing
@@ -115,6 +118,63 @@ public:
     } );
   }
 
+  template< typename POLICY >
+  void testPolicy()
+  {
+    initialize();
+
+    ARRAY visits;
+    visits.resize( NDIM, m_array.dims() );
+
+    forValuesInSliceWithIndices< POLICY >( m_array.toSliceConst(),
+                                           [slice=m_array.toSliceConst(), visitsSlice=visits.toSlice()]
+                                             ( auto const & val, auto const ... indices )
+    {
+      EXPECT_EQ( &val, &slice( indices ... ) );
+      ++visitsSlice( indices ... );
+    } );
+
+    forValuesInSlice( visits.toSliceConst(), [] ( auto const & numVisits )
+    {
+      EXPECT_EQ( numVisits, 1 );
+    } );
+
+    forValuesInSlice< POLICY >( m_array.toSlice(), [] ( auto & val )
+    {
+      val *= 2;
+    } );
+
+    INDEX_TYPE offset = 0;
+    forValuesInSlice( m_array.toSliceConst(), [&offset] ( auto const & val )
+    {
+      EXPECT_EQ( val, 2 * offset++ );
+    } );
+  }
+
+  void testMemoryOrder()
+  {
+    initialize();
+
+    // Every permutation is traversed in memory order.
+    auto const * expected = m_array.data();
+    forValuesInSlice< serialPolicy >( m_array.toSliceConst(), [&expected] ( auto const & val )
+    {
+      EXPECT_EQ( &val, expected++ );
+    } );
+
+    // A sub-range of the outer dimension with the smallest stride isn't contiguous but is still traversed
+    // in increasing order.
+    constexpr std::array< camp::idx_t, NDIM > const permutation = RAJA::as_array< typename ARRAY::permutation >::get();
+    constexpr int DIM = permutation[ NDIM > 1 ? NDIM - 2 : 0 ];
+    auto const subRange = m_array.template subRange< DIM >( 1, m_array.size( DIM ) - 1 );
+    auto const * previous = m_array.data();
+    forValuesInSlice< serialPolicy >( subRange.toSlice(), [&previous] ( auto const & val )
+    {
+      EXPECT_LT( previous, &val );
+      previous = &val;
+    } );
+  }
+
 protected:
 
   void initialize()
@@ -164,6 +224,23 @@ TYPED_TEST( ForValuesInSlice, test )
   this->test();
 }
 
+TYPED_TEST( ForValuesInSlice, serialPolicy )
+{
+  this->template testPolicy< serialPolicy >();
+}
+
+#if defined(USE_OPENMP)
+TYPED_TEST( ForValuesInSlice, parallelHostPolicy )
+{
+  this->template testPolicy< parallelHostPolicy >();
+}
+#endif
+
+TYPED_TEST( ForValuesInSlice, memoryOrder )
+{
+  this->testMemoryOrder();
+}
+
 TEST( ForValuesInSlice, scalar )
 {
   int x;
@@ -259,6 +336,23 @@ public:
     checkSums( this->m_array.toSliceConst(), m_sums.toSliceConst() );
   }
 
+  template< typename POLICY >
+  void testPolicy()
+  {
+    this->initialize();
+    INDEX_TYPE dims[ NDIM - 1 ];
+    for( INDEX_TYPE dim = 0; dim < NDIM - 1; ++dim )
+    {
+      dims[ dim ] = this->m_array.size( dim + 1 );
+    }
+
+    m_sums.resize( NDIM - 1, dims );
+
+    sumOverFirstDimension< POLICY >( this->m_array.toSliceConst(), m_sums.toSlice() );
+
+    checkSums( this->m_array.toSliceConst(), m_sums.toSliceConst() );
+  }
+
 private:
   ArrayT< T, PERM > m_sums;
 };
@@ -297,6 +391,13 @@ TYPED_TEST( SumOverFirstDimension, test )
   this->test();
 }
 
+#if defined(USE_OPENMP)
+TYPED_TEST( SumOverFirstDimension, parallelHostPolicy )
+{
+  this->template testPolicy< parallelHostPolicy >();
+}
+#endif
+
 TEST( SumOverFirstDimension, OneDimensional )
 {
   INDEX_TYPE const size = 10;
@@ -312,6 +413,137 @@ TEST( SumOverFirstDimension, OneDimensional )
   EXPECT_EQ( sum, ( size * size + size ) / 2 );
 }
 
+#if defined(USE_OPENMP)
+TEST( SumOverFirstDimension, OneDimensionalParallel )
+{
+  // Not a multiple of the chunk size.
+  INDEX_TYPE const size = 3 * 4096 + 17;
+  ArrayT< INDEX_TYPE, RAJA::PERM_I > array( size );
+
+  for( INDEX_TYPE i = 0; i < size; ++i )
+  {
+    array( i ) = i + 1;
+  }
+
+  INDEX_TYPE sum = 5;
+  sumOverFirstDimension< parallelHostPolicy >( array.toSliceConst(), sum );
+  EXPECT_EQ( sum, 5 + ( size * size + size ) / 2 );
+
+  ArrayT< INDEX_TYPE, RAJA::PERM_I > empty;
+  sumOverFirstDimension< parallelHostPolicy >( empty.toSliceConst(), sum );
+  EXPECT_EQ( sum, 5 + ( size * size + size ) / 2 );
+}
+#endif
+
+
+template< typename ARRAY_PERM_PAIR >
+class PermuteInto : public ::testing::Test
+{
+public:
+  using ARRAY = typename ARRAY_PERM_PAIR::first_type;
+  using T = typename ARRAY::value_type;
+  static constexpr int NDIM = ARRAY::ndim;
+
+  using PERM = typename ARRAY_PERM_PAIR::second_type;
+
+  template< typename POLICY >
+  void test( std::array< INDEX_TYPE, NDIM > const & dims )
+  {
+    m_src.resize( NDIM, dims.data() );
+
+    T offset = 0;
+    forValuesInSlice( m_src.toSlice(), [&offset] ( T & value )
+    {
+      value = offset++;
+    } );
+
+    m_dst.resize( NDIM, dims.data() );
+    permuteInto< POLICY >( m_src.toSliceConst(), m_dst.toSlice() );
+
+    forValuesInSliceWithIndices( m_dst.toSliceConst(), [src=m_src.toSliceConst()] ( T const & value, auto const ... indices )
+    {
+      EXPECT_EQ( value, src( indices ... ) );
+    } );
+  }
+
+  template< typename POLICY >
+  void testPolicy()
+  {
+    // Sizes that aren't multiples of the tile size and sizes that are smaller than it.
+    std::array< INDEX_TYPE, NDIM > dims;
+    for( int dim = 0; dim < NDIM; ++dim )
+    {
+      dims[ dim ] = ( dim < 2 ) ? 45 + 26 * dim : 3 + dim;
+    }
+    test< POLICY >( dims );
+
+    dims.fill( 1 );
+    dims[ NDIM - 1 ] = 5;
+    test< POLICY >( dims );
+
+    dims[ 0 ] = 0;
+    test< POLICY >( dims );
+  }
+
+private:
+  ARRAY m_src;
+  ArrayT< T, PERM > m_dst;
+};
+
+using PermuteIntoTypes = ::testing::Types<
+  // All 2D permutations into each other
+  std::pair< ArrayT< int, RAJA::PERM_IJ >, RAJA::PERM_JI >
+  , std::pair< ArrayT< int, RAJA::PERM_JI >, RAJA::PERM_IJ >
+  , std::pair< ArrayT< int, RAJA::PERM_IJ >, RAJA::PERM_IJ >
+  // RAJA::PERM_IJK into all 3D permutations
+  , std::pair< ArrayT< int, RAJA::PERM_IJK >, RAJA::PERM_IJK >
+  , std::pair< ArrayT< int, RAJA::PERM_IJK >, RAJA::PERM_IKJ >
+  , std::pair< ArrayT< int, RAJA::PERM_IJK >, RAJA::PERM_JIK >
+  , std::pair< ArrayT< int, RAJA::PERM_IJK >, RAJA::PERM_JKI >
+  , std::pair< ArrayT< int, RAJA::PERM_IJK >, RAJA::PERM_KIJ >
+  , std::pair< ArrayT< int, RAJA::PERM_IJK >, RAJA::PERM_KJI >
+  // Some other 3D and 4D pairs
+  , std::pair< ArrayT< double, RAJA::PERM_KJI >, RAJA::PERM_IJK >
+  , std::pair< ArrayT< double, RAJA::PERM_JKI >, RAJA::PERM_KIJ >
+  , std::pair< ArrayT< int, RAJA::PERM_IJKL >, RAJA::PERM_LKJI >
+  , std::pair< ArrayT< int, RAJA::PERM_LJIK >, RAJA::PERM_JKIL >
+  >;
+
+TYPED_TEST_SUITE( PermuteInto, PermuteIntoTypes, );
+
+TYPED_TEST( PermuteInto, serialPolicy )
+{
+  this->template testPolicy< serialPolicy >();
+}
+
+#if defined(USE_OPENMP)
+TYPED_TEST( PermuteInto, parallelHostPolicy )
+{
+  this->template testPolicy< parallelHostPolicy >();
+}
+#endif
+
+TEST( PermuteInto, subRange )
+{
+  ArrayT< int, RAJA::PERM_IJ > src( 50, 60 );
+  forValuesInSliceWithIndices( src.toSlice(), [] ( int & value, INDEX_TYPE const i, INDEX_TYPE const j )
+  {
+    value = 100 * i + j;
+  } );
+
+  ArrayT< int, RAJA::PERM_JI > dst( 20, 60 );
+  auto const rows = src.toSliceConst().subRange< 0 >( 5, 45, 2 );
+  permuteInto( rows.toSlice(), dst.toSlice() );
+
+  for( INDEX_TYPE i = 0; i < dst.size( 0 ); ++i )
+  {
+    for( INDEX_TYPE j = 0; j < dst.size( 1 ); ++j )
+    {
+      EXPECT_EQ( dst( i, j ), 100 * ( 5 + 2 * i ) + j );
+    }
+  }
+}
+
 
 } /// namespace testing
 } /// namespace LvArray
@@ -287,6 +287,21 @@ TYPED_TEST( SortedArrayTest, reserve )
   EXPECT_EQ( ptr, this->m_set.data());
 }
 
+TYPED_TEST( SortedArrayTest, shrinkToFit )
+{
+  this->m_set.reserve( DEFAULT_MAX_VAL + 1 );
+  this->insertTest( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VAL );
+  EXPECT_EQ( this->m_set.capacity(), DEFAULT_MAX_VAL + 1 );
+
+  this->m_set.shrinkToFit();
+  EXPECT_EQ( this->m_set.capacity(), this->m_set.size() );
+
+  this->removeTest( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VAL );
+  this->m_set.shrinkToFit();
+  EXPECT_EQ( this->m_set.capacity(), this->m_set.size() );
+  this->insertTest( DEFAULT_MAX_INSERTS, DEFAULT_MAX_VAL );
+}
+
 TYPED_TEST( SortedArrayTest, insertMultiple )
 {
   for( int i = 0; i < 4; ++i )
@@ -365,13 +365,74 @@ public:
     COMPARE_TO_REFERENCE
   }
 
+  /**
+   * @brief Test the setRowCapacities method of SparsityPattern.
+   */
+  void rowCapacitiesTest()
+  {
+    INDEX_TYPE const numRows = m_sp.numRows();
+    ASSERT_EQ( numRows, INDEX_TYPE( m_ref.size()));
+
+    // Change every other row starting from the back, the new capacity will be the index of the row.
+    std::vector< INDEX_TYPE > rows;
+    for( INDEX_TYPE row = numRows - 1; row >= 0; row -= 2 )
+    {
+      rows.push_back( row );
+    }
+
+    m_sp.setRowCapacities( rows.size(), rows.data(), rows.data() );
+
+    for( INDEX_TYPE const row : rows )
+    {
+      std::set< COL_TYPE > & refRow = m_ref[row];
+      INDEX_TYPE const rowNNZ = refRow.size();
+      INDEX_TYPE const new_capacity = row;
+      if( new_capacity < rowNNZ )
+      {
+        // Erase the last values from the reference.
+        auto erase_pos = refRow.end();
+        std::advance( erase_pos, -( rowNNZ - new_capacity ) );
+        refRow.erase( erase_pos, refRow.end());
+      }
+
+      EXPECT_EQ( m_sp.nonZeroCapacity( row ), std::min( new_capacity, INDEX_TYPE( m_sp.numColumns() ) ) );
+    }
+
+    COMPARE_TO_REFERENCE
+
+    for( INDEX_TYPE const row : rows )
+    {
+      fillRow( row );
+    }
+
+    COMPARE_TO_REFERENCE
+  }
+
   /**
    * @brief Test the compress method of SparsityPattern.
    */
   void compressTest()
   {
     m_sp.compress();
+    checkCompressed();
+  }
+
+  /**
+   * @brief Test the compress method of SparsityPattern with the given policy.
+   * @tparam POLICY The RAJA policy to compress with.
+   */
+  template< typename POLICY >
+  void compressTest()
+  {
+    m_sp.template compress< POLICY >();
+    checkCompressed();
+  }
 
+  /**
+   * @brief Check that the SparsityPattern is compressed.
+   */
+  void checkCompressed()
+  {
     COL_TYPE const * const columns = m_sp.getColumns( 0 );
     INDEX_TYPE const * const offsets = m_sp.getOffsets();
 
@@ -683,6 +744,15 @@ TYPED_TEST( SparsityPatternTest, rowCapacity )
   this->rowCapacityTest();
 }
 
+TYPED_TEST( SparsityPatternTest, rowCapacities )
+{
+  this->resize( NROWS, NCOLS );
+
+  this->insertTest( MAX_INSERTS );
+  this->rowCapacitiesTest();
+  this->insertTest( MAX_INSERTS );
+}
+
 TYPED_TEST( SparsityPatternTest, compress )
 {
   this->resize( NROWS, NCOLS );
@@ -691,6 +761,19 @@ TYPED_TEST( SparsityPatternTest, compress )
   this->compressTest();
 }
 
+TYPED_TEST( SparsityPatternTest, compressWithPolicy )
+{
+  this->resize( NROWS, NCOLS );
+
+  this->insertTest( MAX_INSERTS );
+  this->template compressTest< serialPolicy >();
+
+#if defined( USE_OPENMP )
+  this->insertTest( MAX_INSERTS );
+  this->template compressTest< parallelHostPolicy >();
+#endif
+}
+
 TYPED_TEST( SparsityPatternTest, deepCopy )
 {
   this->resize( NROWS, NCOLS );
@@ -0,0 +1,238 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "TiledArray.hpp"
+#include "Array.hpp"
+#include "MallocBuffer.hpp"
+#include "tensorOps.hpp"
+#include "testUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+namespace LvArray
+{
+namespace testing
+{
+
+template< typename TILED_ARRAY >
+class TiledArrayTest : public ::testing::Test
+{
+public:
+  static constexpr int TILE_SIZE = TILED_ARRAY::tileSize;
+
+  using T = typename TILED_ARRAY::value_type;
+
+  void layout( std::ptrdiff_t const n )
+  {
+    resize( n );
+
+    EXPECT_EQ( m_tiled.size(), n * 3 * 3 );
+    EXPECT_EQ( m_tiled.numTiles(), ( n + TILE_SIZE - 1 ) / TILE_SIZE );
+    EXPECT_EQ( m_tiled.tileStride(), TILE_SIZE * 3 * 3 );
+    EXPECT_EQ( m_tiled.paddedSize(), m_tiled.numTiles() * m_tiled.tileStride() );
+
+    for( std::ptrdiff_t i = 0; i < n; ++i )
+    {
+      for( std::ptrdiff_t j = 0; j < 3; ++j )
+      {
+        for( std::ptrdiff_t k = 0; k < 3; ++k )
+        {
+          std::ptrdiff_t const expectedOffset = ( i / TILE_SIZE ) * TILE_SIZE * 9 + ( 3 * j + k ) * TILE_SIZE + i % TILE_SIZE;
+          EXPECT_EQ( m_tiled.linearIndex( i, j, k ), expectedOffset );
+          EXPECT_EQ( &m_tiled( i, j, k ), m_tiled.data() + expectedOffset );
+          EXPECT_EQ( &m_tiled[ i ][ j ][ k ], m_tiled.data() + expectedOffset );
+          EXPECT_EQ( &m_tiled[ i ]( j, k ), m_tiled.data() + expectedOffset );
+          EXPECT_EQ( &m_tiled.tile( i / TILE_SIZE )( i % TILE_SIZE, j, k ), m_tiled.data() + expectedOffset );
+          EXPECT_EQ( m_tiled( i, j, k ), m_dense( i, j, k ) );
+        }
+      }
+    }
+  }
+
+  void resizePreservesValues()
+  {
+    resize( 2 * TILE_SIZE + 1 );
+
+    m_tiled.resize( std::ptrdiff_t( 5 * TILE_SIZE - 1 ) );
+    checkEqual( 2 * TILE_SIZE + 1 );
+
+    m_tiled.resize( std::ptrdiff_t( 3 ) );
+    checkEqual( 3 );
+
+    m_tiled.clear();
+    EXPECT_EQ( m_tiled.size(), 0 );
+    EXPECT_EQ( m_tiled.size( 1 ), 3 );
+    EXPECT_EQ( m_tiled.numTiles(), 0 );
+  }
+
+  void copyAndMove()
+  {
+    resize( 3 * TILE_SIZE + 2 );
+
+    TILED_ARRAY copy( m_tiled );
+    EXPECT_NE( copy.data(), m_tiled.data() );
+    for( std::ptrdiff_t i = 0; i < m_tiled.paddedSize(); ++i )
+    { EXPECT_EQ( copy.data()[ i ], m_tiled.data()[ i ] ); }
+
+    T * const data = copy.data();
+    TILED_ARRAY moved( std::move( copy ) );
+    EXPECT_EQ( moved.data(), data );
+    EXPECT_EQ( copy.size(), 0 );
+
+    typename TILED_ARRAY::ViewType & view = moved.toView();
+    typename TILED_ARRAY::ViewType viewCopy = view;
+    EXPECT_EQ( viewCopy.data(), data );
+    EXPECT_EQ( &viewCopy( 1, 2, 1 ), &moved( 1, 2, 1 ) );
+  }
+
+  void multiply()
+  {
+    std::ptrdiff_t const n = 4 * TILE_SIZE - 1;
+    resize( n );
+
+    TILED_ARRAY product( n, 3, 3 );
+    Array< T, 3, RAJA::PERM_IJK, std::ptrdiff_t, MallocBuffer > expected( n, 3, 3 );
+
+    // Element wise through ArraySlice.
+    for( std::ptrdiff_t i = 0; i < n; ++i )
+    {
+      tensorOps::AikBkj< 3, 3, 3 >( product[ i ], m_tiled[ i ], m_tiled[ i ] );
+      tensorOps::AikBkj< 3, 3, 3 >( expected[ i ], m_dense[ i ], m_dense[ i ] );
+    }
+
+    checkEqual( product, expected );
+
+    // A whole tile at a time with the lanes innermost.
+    product = T( 0 );
+    for( std::ptrdiff_t t = 0; t < m_tiled.numTiles(); ++t )
+    {
+      typename TILED_ARRAY::TileType const a = m_tiled.tile( t );
+      typename TILED_ARRAY::TileType const c = product.tile( t );
+      for( int j = 0; j < 3; ++j )
+      {
+        for( int k = 0; k < 3; ++k )
+        {
+          for( int l = 0; l < 3; ++l )
+          {
+            for( int lane = 0; lane < TILE_SIZE; ++lane )
+            {
+              c( lane, j, k ) += a( lane, j, l ) * a( lane, l, k );
+            }
+          }
+        }
+      }
+    }
+
+    checkEqual( product, expected );
+  }
+
+private:
+  void resize( std::ptrdiff_t const n )
+  {
+    m_tiled.resize( n, 3, 3 );
+    m_dense.resize( n, 3, 3 );
+    for( std::ptrdiff_t i = 0; i < n; ++i )
+    {
+      for( std::ptrdiff_t j = 0; j < 3; ++j )
+      {
+        for( std::ptrdiff_t k = 0; k < 3; ++k )
+        {
+          m_tiled( i, j, k ) = T( 9 * i + 3 * j + k );
+          m_dense( i, j, k ) = T( 9 * i + 3 * j + k );
+        }
+      }
+    }
+  }
+
+  void checkEqual( std::ptrdiff_t const n ) const
+  {
+    EXPECT_EQ( m_tiled.size( 0 ), m_tiled.size() / 9 );
+    for( std::ptrdiff_t i = 0; i < n; ++i )
+    {
+      for( std::ptrdiff_t j = 0; j < 3; ++j )
+      {
+        for( std::ptrdiff_t k = 0; k < 3; ++k )
+        {
+          EXPECT_EQ( m_tiled( i, j, k ), m_dense( i, j, k ) );
+        }
+      }
+    }
+  }
+
+  template< typename ARRAY >
+  static void checkEqual( TILED_ARRAY const & tiled, ARRAY const & dense )
+  {
+    for( std::ptrdiff_t i = 0; i < dense.size( 0 ); ++i )
+    {
+      for( std::ptrdiff_t j = 0; j < 3; ++j )
+      {
+        for( std::ptrdiff_t k = 0; k < 3; ++k )
+        {
+          EXPECT_EQ( tiled( i, j, k ), dense( i, j, k ) );
+        }
+      }
+    }
+  }
+
+  TILED_ARRAY m_tiled;
+  Array< T, 3, RAJA::PERM_IJK, std::ptrdiff_t, MallocBuffer > m_dense;
+};
+
+using TiledArrayTestTypes = ::testing::Types<
+  TiledArray< int, 3, 1, std::ptrdiff_t, MallocBuffer >
+  , TiledArray< int, 3, 4, std::ptrdiff_t, MallocBuffer >
+  , TiledArray< double, 3, 8, std::ptrdiff_t, MallocBuffer >
+  >;
+
+TYPED_TEST_SUITE( TiledArrayTest, TiledArrayTestTypes, );
+
+TYPED_TEST( TiledArrayTest, layout )
+{
+  this->layout( 0 );
+  this->layout( 1 );
+  this->layout( TestFixture::TILE_SIZE );
+  this->layout( 3 * TestFixture::TILE_SIZE + 1 );
+}
+
+TYPED_TEST( TiledArrayTest, resizePreservesValues )
+{
+  this->resizePreservesValues();
+}
+
+TYPED_TEST( TiledArrayTest, copyAndMove )
+{
+  this->copyAndMove();
+}
+
+TYPED_TEST( TiledArrayTest, multiply )
+{
+  this->multiply();
+}
+
+} // namespace testing
+} // namespace LvArray
+
+// This is the default gtest main method. It is included for ease of debugging.
+int main( int argc, char * * argv )
+{
+  ::testing::InitGoogleTest( &argc, argv );
+  int const result = RUN_ALL_TESTS();
+  return result;
+}
@@ -0,0 +1,165 @@
+/*
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Copyright (c) 2019, Lawrence Livermore National Security, LLC.
+ *
+ * Produced at the Lawrence Livermore National Laboratory
+ *
+ * LLNL-CODE-746361
+ *
+ * All rights reserved. See COPYRIGHT for details.
+ *
+ * This file is part of the GEOSX Simulation Framework.
+ *
+ * GEOSX is a free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License (as published by the
+ * Free Software Foundation) version 2.1 dated February 1999.
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ */
+
+// Source includes
+#include "transpose.hpp"
+#include "Array.hpp"
+#include "ArrayOfArrays.hpp"
+#include "ArrayOfSets.hpp"
+#include "testUtils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <random>
+#include <vector>
+
+namespace LvArray
+{
+namespace testing
+{
+
+using INDEX_TYPE = std::ptrdiff_t;
+
+template< typename T, typename PERMUTATION >
+using ArrayT = Array< T, getDimension( PERMUTATION {} ), PERMUTATION, INDEX_TYPE, DEFAULT_BUFFER >;
+
+template< typename T >
+using ArrayOfArraysT = ArrayOfArrays< T, INDEX_TYPE, DEFAULT_BUFFER >;
+
+template< typename T >
+using ArrayOfSetsT = ArrayOfSets< T, INDEX_TYPE, DEFAULT_BUFFER >;
+
+INDEX_TYPE const NUM_SOURCES = 500;
+INDEX_TYPE const NUM_TARGETS = 300;
+INDEX_TYPE const MAX_TARGETS_PER_SOURCE = 8;
+
+template< typename POLICY_AND_DST >
+class TransposeTest : public ::testing::Test
+{
+public:
+  using POLICY = std::tuple_element_t< 0, POLICY_AND_DST >;
+  using DST = std::tuple_element_t< 1, POLICY_AND_DST >;
+  using ATOMIC_POLICY = typename RAJAHelper< POLICY >::AtomicPolicy;
+
+  static constexpr bool IS_SET = std::is_same< DST, ArrayOfSetsT< INDEX_TYPE > >::value;
+
+  template< typename PERMUTATION >
+  void array2d()
+  {
+    ArrayT< INDEX_TYPE, PERMUTATION > src( NUM_SOURCES, MAX_TARGETS_PER_SOURCE );
+    for( INDEX_TYPE i = 0; i < NUM_SOURCES; ++i )
+    {
+      for( INDEX_TYPE j = 0; j < MAX_TARGETS_PER_SOURCE; ++j )
+      {
+        // Includes -1 padding and repeated targets.
+        src( i, j ) = randomTarget();
+        addToReference( src( i, j ), i );
+      }
+    }
+
+    // Transpose twice to check that the destination is cleared.
+    transpose< POLICY, ATOMIC_POLICY >( src.toSliceConst(), NUM_TARGETS, m_dst );
+    transpose< POLICY, ATOMIC_POLICY >( src.toSliceConst(), NUM_TARGETS, m_dst );
+    compareToReference();
+  }
+
+  void arrayOfArrays()
+  {
+    ArrayOfArraysT< INDEX_TYPE > src( NUM_SOURCES );
+    for( INDEX_TYPE i = 0; i < NUM_SOURCES; ++i )
+    {
+      INDEX_TYPE const numTargets = std::uniform_int_distribution< INDEX_TYPE >( 0, MAX_TARGETS_PER_SOURCE )( m_gen );
+      for( INDEX_TYPE j = 0; j < numTargets; ++j )
+      {
+        INDEX_TYPE const t = randomTarget();
+        src.emplaceBack( i, t );
+        addToReference( t, i );
+      }
+    }
+
+    transpose< POLICY, ATOMIC_POLICY >( src.toViewConst(), NUM_TARGETS, m_dst );
+    compareToReference();
+  }
+
+protected:
+
+  INDEX_TYPE randomTarget()
+  { return std::uniform_int_distribution< INDEX_TYPE >( -1, NUM_TARGETS - 1 )( m_gen ); }
+
+  /**
+   * @brief Add @p source to target @p t of the reference. Since the sources are added in increasing order
+   *   each row of the reference is sorted.
+   */
+  void addToReference( INDEX_TYPE const t, INDEX_TYPE const source )
+  {
+    if( t < 0 ) return;
+
+    std::vector< INDEX_TYPE > & row = m_ref[ t ];
+    if( IS_SET && !row.empty() && row.back() == source ) return;
+    row.push_back( source );
+  }
+
+  void compareToReference() const
+  {
+    ASSERT_EQ( m_dst.size(), NUM_TARGETS );
+    for( INDEX_TYPE t = 0; t < NUM_TARGETS; ++t )
+    {
+      std::vector< INDEX_TYPE > const & row = m_ref[ t ];
+      ASSERT_EQ( m_dst[ t ].size(), row.size() );
+      for( std::size_t j = 0; j < row.size(); ++j )
+      {
+        EXPECT_EQ( m_dst[ t ][ j ], row[ j ] );
+      }
+    }
+  }
+
+  std::mt19937_64 m_gen;
+  std::vector< std::vector< INDEX_TYPE > > m_ref = std::vector< std::vector< INDEX_TYPE > >( NUM_TARGETS );
+  DST m_dst;
+};
+
+using TransposeTestTypes = ::testing::Types<
+  std::tuple< serialPolicy, ArrayOfArraysT< INDEX_TYPE > >
+  , std::tuple< serialPolicy, ArrayOfSetsT< INDEX_TYPE > >
+#if defined(USE_OPENMP)
+  , std::tuple< parallelHostPolicy, ArrayOfArraysT< INDEX_TYPE > >
+  , std::tuple< parallelHostPolicy, ArrayOfSetsT< INDEX_TYPE > >
+#endif
+  >;
+
+TYPED_TEST_SUITE( TransposeTest, TransposeTestTypes, );
+
+TYPED_TEST( TransposeTest, array2dPERM_IJ )
+{
+  this->template array2d< RAJA::PERM_IJ >();
+}
+
+TYPED_TEST( TransposeTest, array2dPERM_JI )
+{
+  this->template array2d< RAJA::PERM_JI >();
+}
+
+TYPED_TEST( TransposeTest, arrayOfArrays )
+{
+  this->arrayOfArrays();
+}
+
+} // namespace testing
+} // namespace LvArray